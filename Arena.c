@@ -0,0 +1,152 @@
+#include "mocc.h"
+
+#define ARENA_CHUNK_SIZE 65536
+#define ARENA_ALIGNMENT 8
+
+typedef struct ArenaChunk ArenaChunk;
+
+struct ArenaChunk {
+    ArenaChunk *next;
+    char *data;
+    size_t size;
+    size_t used;
+};
+
+struct Arena {
+    ArenaChunk *chunks;
+    size_t num_allocations;
+    size_t allocated_bytes;
+    size_t reserved_bytes;
+};
+
+Arena *Arena_new(void) {
+    Arena *a = malloc(sizeof(Arena));
+    a->chunks = NULL;
+    a->num_allocations = 0;
+    a->allocated_bytes = 0;
+    a->reserved_bytes = 0;
+
+    return a;
+}
+
+void Arena_delete(Arena *a) {
+    assert(a);
+
+    Arena_release(a);
+    free(a);
+}
+
+static ArenaChunk *Arena_push_chunk(Arena *a, size_t size) {
+    assert(a);
+
+    if (size < ARENA_CHUNK_SIZE) {
+        size = ARENA_CHUNK_SIZE;
+    }
+
+    ArenaChunk *c = malloc(sizeof(ArenaChunk));
+    c->next = a->chunks;
+    c->data = malloc(sizeof(char) * size);
+    c->size = size;
+    c->used = 0;
+
+    a->chunks = c;
+    a->reserved_bytes = a->reserved_bytes + size;
+
+    return c;
+}
+
+void *Arena_alloc(Arena *a, size_t size) {
+    assert(a);
+
+    // Round up to keep every allocation suitably aligned for pointers
+    size = (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+
+    ArenaChunk *c = a->chunks;
+    if (!c || c->used + size > c->size) {
+        c = Arena_push_chunk(a, size);
+    }
+
+    void *p = &c->data[c->used];
+    c->used = c->used + size;
+
+    a->num_allocations = a->num_allocations + 1;
+    a->allocated_bytes = a->allocated_bytes + size;
+    TimeReport_allocate(size);
+
+    return p;
+}
+
+void Arena_release(Arena *a) {
+    assert(a);
+
+    ArenaChunk *c = a->chunks;
+    while (c) {
+        ArenaChunk *next = c->next;
+
+        free(c->data);
+        free(c);
+
+        c = next;
+    }
+
+    a->chunks = NULL;
+    a->num_allocations = 0;
+    a->allocated_bytes = 0;
+    a->reserved_bytes = 0;
+}
+
+void Arena_mark(const Arena *a, ArenaMark *mark) {
+    assert(a);
+    assert(mark);
+
+    mark->chunk = a->chunks;
+    mark->used = 0;
+    if (a->chunks) {
+        mark->used = a->chunks->used;
+    }
+
+    mark->num_allocations = a->num_allocations;
+    mark->allocated_bytes = a->allocated_bytes;
+}
+
+void Arena_reset(Arena *a, const ArenaMark *mark) {
+    assert(a);
+    assert(mark);
+
+    // Chunks pushed after the mark are in front of the marked one
+    while (a->chunks != mark->chunk) {
+        ArenaChunk *c = a->chunks;
+        assert(c);
+
+        a->chunks = c->next;
+        a->reserved_bytes = a->reserved_bytes - c->size;
+
+        free(c->data);
+        free(c);
+    }
+
+    if (a->chunks) {
+        a->chunks->used = mark->used;
+    }
+
+    a->num_allocations = mark->num_allocations;
+    a->allocated_bytes = mark->allocated_bytes;
+}
+
+size_t Arena_num_allocations(const Arena *a) {
+    assert(a);
+
+    return a->num_allocations;
+}
+
+size_t Arena_allocated_bytes(const Arena *a) {
+    assert(a);
+
+    return a->allocated_bytes;
+}
+
+size_t Arena_reserved_bytes(const Arena *a) {
+    assert(a);
+
+    return a->reserved_bytes;
+}
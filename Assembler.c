@@ -0,0 +1,1596 @@
+#include "mocc.h"
+
+// Only the directives and the instructions that CodeGen writes are known.
+// Labels are resolved within the object; jumps always take a 32-bit
+// displacement, so they are patched once every label is defined. The
+// symbols referenced through the GOT are left to the linker, or looked up in
+// the running process when the code is run in memory.
+//
+// The object has .text, .rodata.str1.1 and .rodata, relocations for .text,
+// and symbol and string tables. Local labels starting with ".L" are not
+// written to the symbol table.
+
+// Sections of the assembly, and their indices among the section headers
+#define ASSEMBLER_TEXT 0
+#define ASSEMBLER_STRINGS 1
+#define ASSEMBLER_RODATA 2
+#define ASSEMBLER_NUM_SECTIONS 3
+
+#define ASSEMBLER_SHNDX_TEXT 1
+#define ASSEMBLER_SHNDX_RELA_TEXT 2
+#define ASSEMBLER_SHNDX_STRINGS 3
+#define ASSEMBLER_SHNDX_RODATA 4
+#define ASSEMBLER_SHNDX_NOTE 5
+#define ASSEMBLER_SHNDX_SYMTAB 6
+#define ASSEMBLER_SHNDX_STRTAB 7
+#define ASSEMBLER_SHNDX_SHSTRTAB 8
+#define ASSEMBLER_NUM_SHDRS 9
+
+// Section of a symbol that is not defined in a section. Values are kept
+// non-negative, since mocc compares ints as 64-bit values.
+#define ASSEMBLER_UNDEFINED 3
+#define ASSEMBLER_COMMON 4
+
+// ELF constants
+#define ELF_HEADER_SIZE 64
+#define ELF_SHDR_SIZE 64
+#define ELF_SYM_SIZE 24
+#define ELF_RELA_SIZE 24
+#define ELF_SHN_COMMON 65522 // 0xfff2
+#define ELF_SHT_PROGBITS 1
+#define ELF_SHT_SYMTAB 2
+#define ELF_SHT_STRTAB 3
+#define ELF_SHT_RELA 4
+#define ELF_SHF_ALLOC 2
+#define ELF_SHF_EXECINSTR 4
+#define ELF_SHF_MERGE 16
+#define ELF_SHF_STRINGS 32
+#define ELF_SHF_INFO_LINK 64
+#define ELF_STB_LOCAL 0
+#define ELF_STB_GLOBAL 1
+#define ELF_STT_NOTYPE 0
+#define ELF_STT_OBJECT 1
+#define ELF_R_X86_64_REX_GOTPCRELX 42
+
+// Operands
+#define ASSEMBLER_REGISTER 0
+#define ASSEMBLER_MEMORY 1
+#define ASSEMBLER_IMMEDIATE 2
+#define ASSEMBLER_LABEL 3
+#define ASSEMBLER_GOTPCREL 4
+
+// Two-byte opcodes, which start with 0x0f
+#define ASSEMBLER_ESCAPE 3840 // 0x0f00
+
+#define ASSEMBLER_NO_REGISTER 16
+#define ASSEMBLER_NUM_REGISTERS 48
+
+struct AssemblerSymbol {
+    const char *name; // Interned
+    int section;      // ASSEMBLER_UNDEFINED or ASSEMBLER_COMMON if none
+    size_t value;     // Offset in the section, or alignment if common
+    size_t size;      // Size if common
+    bool is_global;
+    size_t index; // In the symbol table
+};
+
+typedef struct AssemblerOperand {
+    int kind;
+    int reg;  // Register number, or the base of a memory operand
+    int size; // Register size in bytes
+    int index;
+    int value; // Displacement or immediate
+    AssemblerSymbol *symbol;
+} AssemblerOperand;
+
+typedef struct Assembler {
+    BinaryWriter *sections[ASSEMBLER_NUM_SECTIONS];
+    int section;
+
+    Map(AssemblerSymbol) * symbols;
+    Vec(AssemblerSymbol) * symbol_list; // In the order of appearance
+
+    // GOT loads in .text
+    Vec(size_t) * relocation_offsets;
+    Vec(AssemblerSymbol) * relocation_symbols;
+
+    // Displacements of jumps, patched at the end
+    Vec(size_t) * jump_offsets;
+    Vec(AssemblerSymbol) * jump_symbols;
+
+    // The line being assembled, terminated by NUL
+    char *line;
+    size_t line_cap;
+    const char *p;
+    int line_number;
+
+    const char *register_names[ASSEMBLER_NUM_REGISTERS];
+    int register_numbers[ASSEMBLER_NUM_REGISTERS];
+    int register_sizes[ASSEMBLER_NUM_REGISTERS];
+    int num_registers;
+} Assembler;
+
+static void Assembler_add_register(
+    Assembler *a, const char *name, int number, int size) {
+    assert(a);
+    assert(name);
+    assert(a->num_registers < ASSEMBLER_NUM_REGISTERS);
+
+    a->register_names[a->num_registers] = name;
+    a->register_numbers[a->num_registers] = number;
+    a->register_sizes[a->num_registers] = size;
+    a->num_registers = a->num_registers + 1;
+}
+
+static void Assembler_add_registers(
+    Assembler *a,
+    int number,
+    const char *qword,
+    const char *dword,
+    const char *byte) {
+    assert(a);
+
+    Assembler_add_register(a, qword, number, 8);
+    Assembler_add_register(a, dword, number, 4);
+    Assembler_add_register(a, byte, number, 1);
+}
+
+static Assembler *Assembler_new(void) {
+    Assembler *a = malloc(sizeof(Assembler));
+
+    for (int i = 0; i < ASSEMBLER_NUM_SECTIONS; i = i + 1) {
+        a->sections[i] = BinaryWriter_new();
+    }
+
+    a->section = ASSEMBLER_TEXT;
+    a->symbols = Map_new(AssemblerSymbol)();
+    a->symbol_list = Vec_new(AssemblerSymbol)();
+    a->relocation_offsets = Vec_new(size_t)();
+    a->relocation_symbols = Vec_new(AssemblerSymbol)();
+    a->jump_offsets = Vec_new(size_t)();
+    a->jump_symbols = Vec_new(AssemblerSymbol)();
+    a->line_cap = 256;
+    a->line = malloc(sizeof(char) * a->line_cap);
+    a->p = a->line;
+    a->line_number = 0;
+    a->num_registers = 0;
+
+    // The registers used most come first
+    Assembler_add_registers(a, 0, "rax", "eax", "al");
+    Assembler_add_registers(a, 7, "rdi", "edi", "dil");
+    Assembler_add_registers(a, 5, "rbp", "ebp", "bpl");
+    Assembler_add_registers(a, 4, "rsp", "esp", "spl");
+    Assembler_add_registers(a, 6, "rsi", "esi", "sil");
+    Assembler_add_registers(a, 2, "rdx", "edx", "dl");
+    Assembler_add_registers(a, 1, "rcx", "ecx", "cl");
+    Assembler_add_registers(a, 3, "rbx", "ebx", "bl");
+    Assembler_add_registers(a, 8, "r8", "r8d", "r8b");
+    Assembler_add_registers(a, 9, "r9", "r9d", "r9b");
+    Assembler_add_registers(a, 10, "r10", "r10d", "r10b");
+    Assembler_add_registers(a, 11, "r11", "r11d", "r11b");
+    Assembler_add_registers(a, 12, "r12", "r12d", "r12b");
+    Assembler_add_registers(a, 13, "r13", "r13d", "r13b");
+    Assembler_add_registers(a, 14, "r14", "r14d", "r14b");
+    Assembler_add_registers(a, 15, "r15", "r15d", "r15b");
+
+    return a;
+}
+
+static void Assembler_delete(Assembler *a) {
+    assert(a);
+
+    for (int i = 0; i < ASSEMBLER_NUM_SECTIONS; i = i + 1) {
+        BinaryWriter_delete(a->sections[i]);
+    }
+
+    for (size_t i = 0; i < Vec_len(AssemblerSymbol)(a->symbol_list);
+         i = i + 1) {
+        free(Vec_get(AssemblerSymbol)(a->symbol_list, i));
+    }
+
+    Vec_delete(AssemblerSymbol)(a->symbol_list);
+    Vec_delete(size_t)(a->relocation_offsets);
+    Vec_delete(AssemblerSymbol)(a->relocation_symbols);
+    Vec_delete(size_t)(a->jump_offsets);
+    Vec_delete(AssemblerSymbol)(a->jump_symbols);
+    free(a->line);
+    free(a);
+}
+
+static void Assembler_error(Assembler *a, const char *message) {
+    assert(a);
+    assert(message);
+
+    ERROR("assembler: %s at line %d: %s\n", message, a->line_number, a->line);
+}
+
+static AssemblerSymbol *Assembler_symbol(Assembler *a, const char *name) {
+    assert(a);
+    assert(name);
+
+    AssemblerSymbol *symbol = Map_find(AssemblerSymbol)(a->symbols, name);
+
+    if (!symbol) {
+        symbol = malloc(sizeof(AssemblerSymbol));
+        symbol->name = name;
+        symbol->section = ASSEMBLER_UNDEFINED;
+        symbol->value = 0;
+        symbol->size = 0;
+        symbol->is_global = false;
+        symbol->index = 0;
+
+        Map_insert(AssemblerSymbol)(a->symbols, name, symbol);
+        Vec_push(AssemblerSymbol)(a->symbol_list, symbol);
+    }
+
+    return symbol;
+}
+
+static void Assembler_define(
+    Assembler *a, AssemblerSymbol *symbol, int section, size_t value) {
+    assert(a);
+    assert(symbol);
+
+    if (symbol->section != ASSEMBLER_UNDEFINED) {
+        Assembler_error(a, "symbol is already defined");
+    }
+
+    symbol->section = section;
+    symbol->value = value;
+}
+
+static BinaryWriter *Assembler_text(Assembler *a) {
+    assert(a);
+
+    return a->sections[ASSEMBLER_TEXT];
+}
+
+static void Assembler_byte(Assembler *a, int byte) {
+    assert(a);
+
+    BinaryWriter_write_byte(a->sections[a->section], byte);
+}
+
+// Lexing
+
+static bool Assembler_is_name(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '$';
+}
+
+static void Assembler_skip_spaces(Assembler *a) {
+    assert(a);
+
+    while (a->p[0] == ' ') {
+        a->p = &a->p[1];
+    }
+}
+
+static bool Assembler_consume(Assembler *a, char c) {
+    assert(a);
+
+    Assembler_skip_spaces(a);
+
+    if (a->p[0] != c) {
+        return false;
+    }
+
+    a->p = &a->p[1];
+    return true;
+}
+
+static void Assembler_expect(Assembler *a, char c) {
+    assert(a);
+
+    if (!Assembler_consume(a, c)) {
+        Assembler_error(a, "unexpected character");
+    }
+}
+
+static void Assembler_expect_end(Assembler *a) {
+    assert(a);
+
+    Assembler_skip_spaces(a);
+
+    if (a->p[0] != '\0') {
+        Assembler_error(a, "extra characters");
+    }
+}
+
+// Returns the length of the name at the cursor, without consuming it
+static size_t Assembler_peek_name(Assembler *a) {
+    assert(a);
+
+    Assembler_skip_spaces(a);
+
+    size_t len = 0;
+    while (Assembler_is_name(a->p[len])) {
+        len = len + 1;
+    }
+
+    return len;
+}
+
+static const char *Assembler_name(Assembler *a) {
+    assert(a);
+
+    size_t len = Assembler_peek_name(a);
+
+    if (len == 0) {
+        Assembler_error(a, "name expected");
+    }
+
+    const char *name = Intern_substring(a->p, len);
+    a->p = &a->p[len];
+
+    return name;
+}
+
+static int Assembler_number(Assembler *a) {
+    assert(a);
+
+    Assembler_skip_spaces(a);
+
+    bool negative = a->p[0] == '-';
+    if (negative) {
+        a->p = &a->p[1];
+    }
+
+    if (!(a->p[0] >= '0' && a->p[0] <= '9')) {
+        Assembler_error(a, "number expected");
+    }
+
+    // Accumulated as a negative number, so that INT_MIN fits
+    int x = 0;
+    while (a->p[0] >= '0' && a->p[0] <= '9') {
+        x = x * 10 - (a->p[0] - '0');
+        a->p = &a->p[1];
+    }
+
+    if (negative) {
+        return x;
+    }
+
+    return -x;
+}
+
+static bool Assembler_word_is(Assembler *a, size_t len, const char *word) {
+    assert(a);
+    assert(word);
+
+    return strlen(word) == len && strncmp(a->p, word, len) == 0;
+}
+
+// Returns the index of the register at the cursor, or ASSEMBLER_NUM_REGISTERS
+static int Assembler_find_register(Assembler *a, size_t len) {
+    assert(a);
+
+    for (int i = 0; i < a->num_registers; i = i + 1) {
+        if (Assembler_word_is(a, len, a->register_names[i])) {
+            return i;
+        }
+    }
+
+    return ASSEMBLER_NUM_REGISTERS;
+}
+
+static int Assembler_register(Assembler *a, int size) {
+    assert(a);
+
+    size_t len = Assembler_peek_name(a);
+    int i = Assembler_find_register(a, len);
+
+    if (i == ASSEMBLER_NUM_REGISTERS || a->register_sizes[i] != size) {
+        Assembler_error(a, "register expected");
+    }
+
+    a->p = &a->p[len];
+    return a->register_numbers[i];
+}
+
+// [base], [base+index] or [base+disp]
+static void Assembler_memory(Assembler *a, AssemblerOperand *operand) {
+    assert(a);
+    assert(operand);
+
+    operand->kind = ASSEMBLER_MEMORY;
+    operand->reg = Assembler_register(a, 8);
+    operand->index = ASSEMBLER_NO_REGISTER;
+    operand->value = 0;
+
+    Assembler_skip_spaces(a);
+
+    if (a->p[0] == '-') {
+        operand->value = Assembler_number(a);
+    } else if (Assembler_consume(a, '+')) {
+        Assembler_skip_spaces(a);
+
+        if (a->p[0] >= '0' && a->p[0] <= '9') {
+            operand->value = Assembler_number(a);
+        } else {
+            operand->index = Assembler_register(a, 8);
+        }
+    }
+
+    Assembler_expect(a, ']');
+}
+
+static void Assembler_operand(Assembler *a, AssemblerOperand *operand) {
+    assert(a);
+    assert(operand);
+
+    operand->reg = ASSEMBLER_NO_REGISTER;
+    operand->size = 0;
+    operand->index = ASSEMBLER_NO_REGISTER;
+    operand->value = 0;
+    operand->symbol = NULL;
+
+    Assembler_skip_spaces(a);
+
+    if (Assembler_consume(a, '[')) {
+        Assembler_memory(a, operand);
+        return;
+    }
+
+    if (a->p[0] == '-' || (a->p[0] >= '0' && a->p[0] <= '9')) {
+        operand->kind = ASSEMBLER_IMMEDIATE;
+        operand->value = Assembler_number(a);
+        return;
+    }
+
+    size_t len = Assembler_peek_name(a);
+    int i = Assembler_find_register(a, len);
+
+    if (i != ASSEMBLER_NUM_REGISTERS) {
+        operand->kind = ASSEMBLER_REGISTER;
+        operand->reg = a->register_numbers[i];
+        operand->size = a->register_sizes[i];
+        a->p = &a->p[len];
+        return;
+    }
+
+    operand->kind = ASSEMBLER_LABEL;
+    operand->symbol = Assembler_symbol(a, Assembler_name(a));
+
+    if (Assembler_consume(a, '@')) {
+        if (!Assembler_word_is(a, Assembler_peek_name(a), "GOTPCREL")) {
+            Assembler_error(a, "unknown relocation");
+        }
+
+        a->p = &a->p[8];
+        Assembler_expect(a, '[');
+
+        if (!Assembler_word_is(a, Assembler_peek_name(a), "rip")) {
+            Assembler_error(a, "rip expected");
+        }
+
+        a->p = &a->p[3];
+        Assembler_expect(a, ']');
+        operand->kind = ASSEMBLER_GOTPCREL;
+    }
+}
+
+// Encoding
+
+static void Assembler_int(Assembler *a, int x) {
+    assert(a);
+
+    BinaryWriter_write_int(a->sections[a->section], x);
+}
+
+static bool Assembler_is_int8(int x) {
+    if ((x & (-2147483647 - 1)) != 0) {
+        // Negating x itself would overflow for INT_MIN
+        int magnitude = -(x + 1);
+        return magnitude <= 127;
+    }
+
+    return x <= 127;
+}
+
+// sil, dil, spl and bpl need a REX prefix; without one they are ah to bh
+static bool Assembler_needs_rex(const AssemblerOperand *operand) {
+    assert(operand);
+
+    return operand->kind == ASSEMBLER_REGISTER && operand->size == 1 &&
+           operand->reg >= 4 && operand->reg <= 7;
+}
+
+static int Assembler_low(int reg) {
+    return reg % 8;
+}
+
+static int Assembler_high(int reg) {
+    if (reg >= 8) {
+        return 1;
+    }
+
+    return 0;
+}
+
+// Writes an instruction with a ModRM byte: an optional REX prefix, the
+// opcode and the operand `rm`. The reg field of ModRM is the register `reg`,
+// or `extension` if `reg` is NULL.
+static void Assembler_modrm(
+    Assembler *a,
+    bool rex_w,
+    int opcode,
+    const AssemblerOperand *reg,
+    int extension,
+    const AssemblerOperand *rm) {
+    assert(a);
+    assert(rm);
+
+    int reg_field = extension;
+    bool rex = rex_w || Assembler_needs_rex(rm);
+
+    if (reg) {
+        reg_field = reg->reg;
+        rex = rex || Assembler_needs_rex(reg);
+    }
+
+    int x = 0;
+    if (rm->kind == ASSEMBLER_MEMORY && rm->index != ASSEMBLER_NO_REGISTER) {
+        x = Assembler_high(rm->index);
+    }
+
+    int b = 0;
+    if (rm->kind == ASSEMBLER_REGISTER || rm->kind == ASSEMBLER_MEMORY) {
+        b = Assembler_high(rm->reg);
+    }
+
+    int r = Assembler_high(reg_field);
+
+    if (rex || r + x + b > 0) {
+        int w = 0;
+        if (rex_w) {
+            w = 1;
+        }
+
+        // 0x40 | W << 3 | R << 2 | X << 1 | B
+        Assembler_byte(a, 64 + w * 8 + r * 4 + x * 2 + b);
+    }
+
+    if (opcode >= ASSEMBLER_ESCAPE) {
+        Assembler_byte(a, 15); // 0x0f
+        opcode = opcode - ASSEMBLER_ESCAPE;
+    }
+
+    Assembler_byte(a, opcode);
+
+    int reg_bits = Assembler_low(reg_field) * 8;
+
+    if (rm->kind == ASSEMBLER_REGISTER) {
+        Assembler_byte(a, 192 + reg_bits + Assembler_low(rm->reg)); // mod 11
+        return;
+    }
+
+    if (rm->kind == ASSEMBLER_GOTPCREL) {
+        // rip-relative, mod 00 and r/m 101; the address is relative to the
+        // end of the displacement
+        Assembler_byte(a, reg_bits + 5);
+        Vec_push(size_t)(
+            a->relocation_offsets, BinaryWriter_len(Assembler_text(a)));
+        Vec_push(AssemblerSymbol)(a->relocation_symbols, rm->symbol);
+        Assembler_int(a, 0);
+        return;
+    }
+
+    if (rm->kind != ASSEMBLER_MEMORY) {
+        Assembler_error(a, "invalid operand");
+    }
+
+    // rbp and r13 as a base always take a displacement
+    int mod = 2;
+    if (rm->value == 0 && Assembler_low(rm->reg) != 5) {
+        mod = 0;
+    } else if (Assembler_is_int8(rm->value)) {
+        mod = 1;
+    }
+
+    if (rm->index != ASSEMBLER_NO_REGISTER || Assembler_low(rm->reg) == 4) {
+        // SIB with scale 1; index 100 means none
+        int index = 4;
+        if (rm->index != ASSEMBLER_NO_REGISTER) {
+            index = Assembler_low(rm->index);
+        }
+
+        Assembler_byte(a, mod * 64 + reg_bits + 4);
+        Assembler_byte(a, index * 8 + Assembler_low(rm->reg));
+    } else {
+        Assembler_byte(a, mod * 64 + reg_bits + Assembler_low(rm->reg));
+    }
+
+    if (mod == 1) {
+        Assembler_byte(a, rm->value & 255);
+    } else if (mod == 2) {
+        Assembler_int(a, rm->value);
+    }
+}
+
+// The register number in the low bits of the opcode, as in push and pop
+static void Assembler_opcode_register(
+    Assembler *a, int opcode, const AssemblerOperand *operand) {
+    assert(a);
+    assert(operand);
+
+    if (operand->kind != ASSEMBLER_REGISTER || operand->size != 8) {
+        Assembler_error(a, "64-bit register expected");
+    }
+
+    if (operand->reg >= 8) {
+        Assembler_byte(a, 65); // REX.B
+    }
+
+    Assembler_byte(a, opcode + Assembler_low(operand->reg));
+}
+
+// An immediate operand, in one byte if it fits
+static void Assembler_immediate(
+    Assembler *a,
+    int opcode8,
+    int opcode32,
+    int extension,
+    const AssemblerOperand *dst,
+    const AssemblerOperand *src) {
+    assert(a);
+    assert(dst);
+    assert(src);
+
+    bool rex_w = dst->size == 8;
+
+    if (Assembler_is_int8(src->value)) {
+        Assembler_modrm(a, rex_w, opcode8, NULL, extension, dst);
+        Assembler_byte(a, src->value & 255);
+    } else {
+        Assembler_modrm(a, rex_w, opcode32, NULL, extension, dst);
+        Assembler_int(a, src->value);
+    }
+}
+
+// Returns the condition code of the mnemonic suffix, as in je and setne
+static int Assembler_condition(Assembler *a, const char *suffix) {
+    assert(a);
+    assert(suffix);
+
+    if (strcmp(suffix, "e") == 0) {
+        return 4;
+    } else if (strcmp(suffix, "ne") == 0) {
+        return 5;
+    } else if (strcmp(suffix, "l") == 0) {
+        return 12;
+    } else if (strcmp(suffix, "ge") == 0) {
+        return 13;
+    } else if (strcmp(suffix, "le") == 0) {
+        return 14;
+    } else if (strcmp(suffix, "g") == 0) {
+        return 15;
+    }
+
+    Assembler_error(a, "unknown condition");
+    return 0;
+}
+
+static void
+Assembler_jump(Assembler *a, int opcode, const AssemblerOperand *target) {
+    assert(a);
+    assert(target);
+
+    if (target->kind != ASSEMBLER_LABEL) {
+        Assembler_error(a, "label expected");
+    }
+
+    if (opcode >= ASSEMBLER_ESCAPE) {
+        Assembler_byte(a, 15); // 0x0f
+        opcode = opcode - ASSEMBLER_ESCAPE;
+    }
+
+    Assembler_byte(a, opcode);
+    Vec_push(size_t)(a->jump_offsets, BinaryWriter_len(Assembler_text(a)));
+    Vec_push(AssemblerSymbol)(a->jump_symbols, target->symbol);
+    Assembler_int(a, 0);
+}
+
+// Sets the opcode of an ALU instruction with registers, and the ModRM
+// extension of its form with an immediate
+static bool
+Assembler_alu(const char *mnemonic, int *opcode, int *extension) {
+    assert(mnemonic);
+    assert(opcode);
+    assert(extension);
+
+    if (strcmp(mnemonic, "add") == 0) {
+        *opcode = 1;
+        *extension = 0;
+    } else if (strcmp(mnemonic, "and") == 0) {
+        *opcode = 33;
+        *extension = 4;
+    } else if (strcmp(mnemonic, "sub") == 0) {
+        *opcode = 41;
+        *extension = 5;
+    } else if (strcmp(mnemonic, "cmp") == 0) {
+        *opcode = 57;
+        *extension = 7;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+// mov in any of the forms written by CodeGen
+static void Assembler_mov(
+    Assembler *a, const AssemblerOperand *dst, const AssemblerOperand *src) {
+    assert(a);
+    assert(dst);
+    assert(src);
+
+    if (src->kind == ASSEMBLER_REGISTER) {
+        // mov r/m, reg: 0x88 for bytes, 0x89 otherwise
+        int opcode = 137;
+        if (src->size == 1) {
+            opcode = 136;
+        }
+
+        Assembler_modrm(a, src->size == 8, opcode, src, 0, dst);
+    } else if (
+        src->kind == ASSEMBLER_MEMORY || src->kind == ASSEMBLER_GOTPCREL) {
+        // mov reg, r/m: 0x8a for bytes, 0x8b otherwise
+        int opcode = 139;
+        if (dst->size == 1) {
+            opcode = 138;
+        }
+
+        Assembler_modrm(a, dst->size == 8, opcode, dst, 0, src);
+    } else if (src->kind == ASSEMBLER_IMMEDIATE) {
+        // mov r/m, imm32: 0xc7 /0
+        Assembler_modrm(a, dst->size == 8, 199, NULL, 0, dst);
+        Assembler_int(a, src->value);
+    } else {
+        Assembler_error(a, "invalid operands");
+    }
+}
+
+static void Assembler_instruction(Assembler *a, const char *mnemonic) {
+    assert(a);
+    assert(mnemonic);
+
+    AssemblerOperand operands[2];
+    int num_operands = 0;
+
+    Assembler_skip_spaces(a);
+
+    if (a->p[0] != '\0') {
+        Assembler_operand(a, &operands[0]);
+        num_operands = 1;
+
+        if (Assembler_consume(a, ',')) {
+            Assembler_operand(a, &operands[1]);
+            num_operands = 2;
+        }
+    }
+
+    Assembler_expect_end(a);
+
+    AssemblerOperand *dst = &operands[0];
+    AssemblerOperand *src = &operands[1];
+    int opcode = 0;
+    int extension = 0;
+    bool is_alu = Assembler_alu(mnemonic, &opcode, &extension);
+
+    if (num_operands == 0) {
+        if (strcmp(mnemonic, "ret") == 0) {
+            Assembler_byte(a, 195); // 0xc3
+        } else if (strcmp(mnemonic, "cqo") == 0) {
+            Assembler_byte(a, 72); // REX.W
+            Assembler_byte(a, 153); // 0x99
+        } else {
+            Assembler_error(a, "unknown instruction");
+        }
+    } else if (num_operands == 1) {
+        if (strcmp(mnemonic, "push") == 0 &&
+            dst->kind == ASSEMBLER_IMMEDIATE) {
+            if (Assembler_is_int8(dst->value)) {
+                Assembler_byte(a, 106); // 0x6a
+                Assembler_byte(a, dst->value & 255);
+            } else {
+                Assembler_byte(a, 104); // 0x68
+                Assembler_int(a, dst->value);
+            }
+        } else if (strcmp(mnemonic, "push") == 0) {
+            Assembler_opcode_register(a, 80, dst); // 0x50
+        } else if (strcmp(mnemonic, "pop") == 0) {
+            Assembler_opcode_register(a, 88, dst); // 0x58
+        } else if (strcmp(mnemonic, "jmp") == 0) {
+            Assembler_jump(a, 233, dst); // 0xe9
+        } else if (mnemonic[0] == 'j') {
+            // 0x0f 0x80+cc
+            Assembler_jump(
+                a,
+                ASSEMBLER_ESCAPE + 128 + Assembler_condition(a, &mnemonic[1]),
+                dst);
+        } else if (strncmp(mnemonic, "set", 3) == 0) {
+            // 0x0f 0x90+cc /0
+            Assembler_modrm(
+                a,
+                false,
+                ASSEMBLER_ESCAPE + 144 + Assembler_condition(a, &mnemonic[3]),
+                NULL,
+                0,
+                dst);
+        } else if (strcmp(mnemonic, "neg") == 0) {
+            Assembler_modrm(a, dst->size == 8, 247, NULL, 3, dst);
+        } else if (strcmp(mnemonic, "idiv") == 0) {
+            Assembler_modrm(a, dst->size == 8, 247, NULL, 7, dst);
+        } else if (strcmp(mnemonic, "call") == 0) {
+            // 0xff /2, whose operand size is 64 bits without REX.W
+            Assembler_modrm(a, false, 255, NULL, 2, dst);
+        } else {
+            Assembler_error(a, "unknown instruction");
+        }
+    } else if (dst->kind != ASSEMBLER_REGISTER &&
+               dst->kind != ASSEMBLER_MEMORY) {
+        Assembler_error(a, "invalid destination");
+    } else if (strcmp(mnemonic, "mov") == 0) {
+        Assembler_mov(a, dst, src);
+    } else if (is_alu && src->kind == ASSEMBLER_IMMEDIATE) {
+        // 0x83 with imm8, 0x81 with imm32
+        Assembler_immediate(a, 131, 129, extension, dst, src);
+    } else if (is_alu) {
+        Assembler_modrm(a, src->size == 8, opcode, src, 0, dst);
+    } else if (strcmp(mnemonic, "lea") == 0) {
+        Assembler_modrm(a, dst->size == 8, 141, dst, 0, src);
+    } else if (
+        strcmp(mnemonic, "imul") == 0 && src->kind == ASSEMBLER_IMMEDIATE) {
+        // 0x6b with imm8, 0x69 with imm32; the source is the destination
+        if (Assembler_is_int8(src->value)) {
+            Assembler_modrm(a, dst->size == 8, 107, dst, 0, dst);
+            Assembler_byte(a, src->value & 255);
+        } else {
+            Assembler_modrm(a, dst->size == 8, 105, dst, 0, dst);
+            Assembler_int(a, src->value);
+        }
+    } else if (strcmp(mnemonic, "imul") == 0) {
+        Assembler_modrm(
+            a, dst->size == 8, ASSEMBLER_ESCAPE + 175, dst, 0, src); // 0xaf
+    } else if (strcmp(mnemonic, "movsx") == 0) {
+        Assembler_modrm(
+            a, dst->size == 8, ASSEMBLER_ESCAPE + 190, dst, 0, src); // 0xbe
+    } else {
+        Assembler_error(a, "unknown instruction");
+    }
+}
+
+// Directives
+
+// Writes the bytes of a quoted string, with octal escapes
+static void Assembler_string(Assembler *a) {
+    assert(a);
+
+    Assembler_expect(a, '"');
+
+    while (a->p[0] != '"') {
+        int c = a->p[0];
+
+        if (c == '\0') {
+            Assembler_error(a, "unterminated string");
+        } else if (c != '\\') {
+            a->p = &a->p[1];
+        } else if (a->p[1] == '"' || a->p[1] == '\\') {
+            c = a->p[1];
+            a->p = &a->p[2];
+        } else {
+            a->p = &a->p[1];
+            c = 0;
+
+            for (int i = 0; i < 3; i = i + 1) {
+                if (!(a->p[0] >= '0' && a->p[0] <= '7')) {
+                    Assembler_error(a, "invalid escape");
+                }
+
+                c = c * 8 + (a->p[0] - '0');
+                a->p = &a->p[1];
+            }
+        }
+
+        Assembler_byte(a, c);
+    }
+
+    a->p = &a->p[1];
+    Assembler_expect_end(a);
+}
+
+static void Assembler_section(Assembler *a) {
+    assert(a);
+
+    const char *name = Assembler_name(a);
+
+    if (strcmp(name, ".rodata.str1.1") == 0) {
+        a->section = ASSEMBLER_STRINGS;
+    } else if (strcmp(name, ".rodata") == 0) {
+        a->section = ASSEMBLER_RODATA;
+    } else if (strcmp(name, ".text") == 0) {
+        a->section = ASSEMBLER_TEXT;
+    } else {
+        Assembler_error(a, "unknown section");
+    }
+
+    // The flags are implied by the name
+    a->p = "";
+}
+
+static void Assembler_directive(Assembler *a, const char *directive) {
+    assert(a);
+    assert(directive);
+
+    if (strcmp(directive, ".string") == 0) {
+        Assembler_string(a);
+        Assembler_byte(a, 0);
+    } else if (strcmp(directive, ".ascii") == 0) {
+        Assembler_string(a);
+    } else if (strcmp(directive, ".byte") == 0) {
+        Assembler_byte(a, Assembler_number(a) & 255);
+        Assembler_expect_end(a);
+    } else if (strcmp(directive, ".set") == 0) {
+        AssemblerSymbol *symbol = Assembler_symbol(a, Assembler_name(a));
+        Assembler_expect(a, ',');
+        AssemblerSymbol *target = Assembler_symbol(a, Assembler_name(a));
+
+        if (target->section >= ASSEMBLER_NUM_SECTIONS) {
+            Assembler_error(a, "symbol is not defined yet");
+        }
+
+        int offset = 0;
+        if (Assembler_consume(a, '+')) {
+            offset = Assembler_number(a);
+        }
+
+        Assembler_expect_end(a);
+        Assembler_define(a, symbol, target->section, target->value + offset);
+    } else if (strcmp(directive, ".global") == 0) {
+        Assembler_symbol(a, Assembler_name(a))->is_global = true;
+        Assembler_expect_end(a);
+    } else if (strcmp(directive, ".comm") == 0) {
+        AssemblerSymbol *symbol = Assembler_symbol(a, Assembler_name(a));
+        Assembler_expect(a, ',');
+        size_t size = Assembler_number(a);
+        Assembler_expect(a, ',');
+        size_t align = Assembler_number(a);
+        Assembler_expect_end(a);
+
+        Assembler_define(a, symbol, ASSEMBLER_COMMON, align);
+        symbol->size = size;
+        symbol->is_global = true;
+    } else if (strcmp(directive, ".section") == 0) {
+        Assembler_section(a);
+    } else if (strcmp(directive, ".text") == 0) {
+        a->section = ASSEMBLER_TEXT;
+    } else if (
+        strcmp(directive, ".intel_syntax") == 0 ||
+        strncmp(directive, ".cfi_", 5) == 0) {
+        // Only Intel syntax is written, and no unwind tables are made
+        a->p = "";
+    } else {
+        Assembler_error(a, "unknown directive");
+    }
+}
+
+static void Assembler_line(Assembler *a) {
+    assert(a);
+
+    Assembler_skip_spaces(a);
+
+    if (a->p[0] == '\0') {
+        return;
+    }
+
+    const char *name = Assembler_name(a);
+
+    if (Assembler_consume(a, ':')) {
+        Assembler_define(
+            a,
+            Assembler_symbol(a, name),
+            a->section,
+            BinaryWriter_len(a->sections[a->section]));
+        Assembler_expect_end(a);
+    } else if (name[0] == '.') {
+        Assembler_directive(a, name);
+    } else if (a->section != ASSEMBLER_TEXT) {
+        Assembler_error(a, "instruction outside .text");
+    } else {
+        Assembler_instruction(a, name);
+    }
+}
+
+static void Assembler_patch_jumps(Assembler *a) {
+    assert(a);
+
+    for (size_t i = 0; i < Vec_len(size_t)(a->jump_offsets); i = i + 1) {
+        size_t offset = Vec_get(size_t)(a->jump_offsets, i);
+        AssemblerSymbol *symbol = Vec_get(AssemblerSymbol)(a->jump_symbols, i);
+
+        if (symbol->section != ASSEMBLER_TEXT) {
+            ERROR("assembler: undefined label %s\n", symbol->name);
+        }
+
+        // Relative to the end of the displacement
+        BinaryWriter_patch_int(
+            Assembler_text(a), offset, symbol->value - (offset + 4));
+    }
+}
+
+// Object file
+
+static void Assembler_write_half(BinaryWriter *w, int x) {
+    assert(w);
+
+    BinaryWriter_write_byte(w, x % 256);
+    BinaryWriter_write_byte(w, x / 256);
+}
+
+static void Assembler_write_xword(BinaryWriter *w, int x) {
+    assert(w);
+
+    BinaryWriter_write_int(w, x);
+
+    // Sign extended
+    if ((x & (-2147483647 - 1)) != 0) {
+        BinaryWriter_write_int(w, -1);
+    } else {
+        BinaryWriter_write_int(w, 0);
+    }
+}
+
+static void Assembler_align(BinaryWriter *w, size_t align) {
+    assert(w);
+
+    while (BinaryWriter_len(w) % align != 0) {
+        BinaryWriter_write_byte(w, 0);
+    }
+}
+
+// Appends a NUL-terminated name and returns its offset
+static size_t Assembler_add_name(BinaryWriter *w, const char *name) {
+    assert(w);
+    assert(name);
+
+    size_t offset = BinaryWriter_len(w);
+
+    BinaryWriter_write_bytes(w, name, strlen(name));
+    BinaryWriter_write_byte(w, 0);
+
+    return offset;
+}
+
+static bool Assembler_is_local_label(const AssemblerSymbol *symbol) {
+    assert(symbol);
+
+    return symbol->name[0] == '.' && symbol->name[1] == 'L';
+}
+
+static int Assembler_shndx(const AssemblerSymbol *symbol) {
+    assert(symbol);
+
+    if (symbol->section == ASSEMBLER_TEXT) {
+        return ASSEMBLER_SHNDX_TEXT;
+    } else if (symbol->section == ASSEMBLER_STRINGS) {
+        return ASSEMBLER_SHNDX_STRINGS;
+    } else if (symbol->section == ASSEMBLER_RODATA) {
+        return ASSEMBLER_SHNDX_RODATA;
+    } else if (symbol->section == ASSEMBLER_COMMON) {
+        return ELF_SHN_COMMON;
+    }
+
+    return 0;
+}
+
+static void Assembler_write_symbol(
+    BinaryWriter *symtab, BinaryWriter *strtab, AssemblerSymbol *symbol) {
+    assert(symtab);
+    assert(strtab);
+    assert(symbol);
+
+    int bind = ELF_STB_LOCAL;
+    if (symbol->is_global || symbol->section == ASSEMBLER_UNDEFINED) {
+        bind = ELF_STB_GLOBAL;
+    }
+
+    int type = ELF_STT_NOTYPE;
+    if (symbol->section == ASSEMBLER_COMMON) {
+        type = ELF_STT_OBJECT;
+    }
+
+    symbol->index = BinaryWriter_len(symtab) / ELF_SYM_SIZE;
+
+    BinaryWriter_write_int(symtab, Assembler_add_name(strtab, symbol->name));
+    BinaryWriter_write_byte(symtab, bind * 16 + type);
+    BinaryWriter_write_byte(symtab, 0);
+    Assembler_write_half(symtab, Assembler_shndx(symbol));
+    Assembler_write_xword(symtab, symbol->value);
+    Assembler_write_xword(symtab, symbol->size);
+}
+
+// Writes the symbols, the locals first as ELF requires, and returns the
+// index of the first global one
+static size_t Assembler_write_symbols(
+    Assembler *a, BinaryWriter *symtab, BinaryWriter *strtab) {
+    assert(a);
+    assert(symtab);
+    assert(strtab);
+
+    size_t len = Vec_len(AssemblerSymbol)(a->symbol_list);
+
+    // The null symbol
+    for (int i = 0; i < ELF_SYM_SIZE; i = i + 1) {
+        BinaryWriter_write_byte(symtab, 0);
+    }
+    BinaryWriter_write_byte(strtab, 0);
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        AssemblerSymbol *symbol = Vec_get(AssemblerSymbol)(a->symbol_list, i);
+
+        if (!symbol->is_global && symbol->section != ASSEMBLER_UNDEFINED &&
+            !Assembler_is_local_label(symbol)) {
+            Assembler_write_symbol(symtab, strtab, symbol);
+        }
+    }
+
+    size_t first_global = BinaryWriter_len(symtab) / ELF_SYM_SIZE;
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        AssemblerSymbol *symbol = Vec_get(AssemblerSymbol)(a->symbol_list, i);
+
+        if (symbol->is_global || symbol->section == ASSEMBLER_UNDEFINED) {
+            Assembler_write_symbol(symtab, strtab, symbol);
+        }
+    }
+
+    return first_global;
+}
+
+static void Assembler_write_relocations(Assembler *a, BinaryWriter *rela) {
+    assert(a);
+    assert(rela);
+
+    for (size_t i = 0; i < Vec_len(size_t)(a->relocation_offsets); i = i + 1) {
+        AssemblerSymbol *symbol =
+            Vec_get(AssemblerSymbol)(a->relocation_symbols, i);
+
+        if (Assembler_is_local_label(symbol)) {
+            ERROR("assembler: relocation against %s\n", symbol->name);
+        }
+
+        // r_offset, r_info with the symbol in the upper half, r_addend
+        Assembler_write_xword(
+            rela, Vec_get(size_t)(a->relocation_offsets, i));
+        BinaryWriter_write_int(rela, ELF_R_X86_64_REX_GOTPCRELX);
+        BinaryWriter_write_int(rela, symbol->index);
+        Assembler_write_xword(rela, -4);
+    }
+}
+
+typedef struct AssemblerSectionHeader {
+    int name;
+    int type;
+    int flags;
+    size_t offset;
+    size_t size;
+    int link;
+    int info;
+    int align;
+    int entsize;
+} AssemblerSectionHeader;
+
+// Describes a section without links and with the contents in `part`
+static void Assembler_section_header(
+    AssemblerSectionHeader *h,
+    int name,
+    int type,
+    int flags,
+    size_t offset,
+    const BinaryWriter *part) {
+    assert(h);
+
+    h->name = name;
+    h->type = type;
+    h->flags = flags;
+    h->offset = offset;
+    h->size = 0;
+    h->link = 0;
+    h->info = 0;
+    h->align = 1;
+    h->entsize = 0;
+
+    if (part) {
+        h->size = BinaryWriter_len(part);
+    }
+}
+
+static void Assembler_write_section_header(
+    BinaryWriter *w, const AssemblerSectionHeader *h) {
+    assert(w);
+    assert(h);
+
+    BinaryWriter_write_int(w, h->name);
+    BinaryWriter_write_int(w, h->type);
+    Assembler_write_xword(w, h->flags);
+    Assembler_write_xword(w, 0); // sh_addr
+    Assembler_write_xword(w, h->offset);
+    Assembler_write_xword(w, h->size);
+    BinaryWriter_write_int(w, h->link);
+    BinaryWriter_write_int(w, h->info);
+    Assembler_write_xword(w, h->align);
+    Assembler_write_xword(w, h->entsize);
+}
+
+static void Assembler_write_elf_header(BinaryWriter *w, size_t shoff) {
+    assert(w);
+
+    // e_ident: magic, 64-bit, little-endian, version 1, System V ABI
+    BinaryWriter_write_byte(w, 127);
+    BinaryWriter_write_bytes(w, "ELF", 3);
+    BinaryWriter_write_byte(w, 2);
+    BinaryWriter_write_byte(w, 1);
+    BinaryWriter_write_byte(w, 1);
+    for (int i = 7; i < 16; i = i + 1) {
+        BinaryWriter_write_byte(w, 0);
+    }
+
+    Assembler_write_half(w, 1);  // e_type: relocatable
+    Assembler_write_half(w, 62); // e_machine: x86-64
+    BinaryWriter_write_int(w, 1);
+    Assembler_write_xword(w, 0); // e_entry
+    Assembler_write_xword(w, 0); // e_phoff
+    Assembler_write_xword(w, shoff);
+    BinaryWriter_write_int(w, 0); // e_flags
+    Assembler_write_half(w, ELF_HEADER_SIZE);
+    Assembler_write_half(w, 0); // e_phentsize
+    Assembler_write_half(w, 0); // e_phnum
+    Assembler_write_half(w, ELF_SHDR_SIZE);
+    Assembler_write_half(w, ASSEMBLER_NUM_SHDRS);
+    Assembler_write_half(w, ASSEMBLER_SHNDX_SHSTRTAB);
+}
+
+static void Assembler_write_object(Assembler *a, const char *path) {
+    assert(a);
+    assert(path);
+
+    BinaryWriter *symtab = BinaryWriter_new();
+    BinaryWriter *strtab = BinaryWriter_new();
+    BinaryWriter *rela = BinaryWriter_new();
+    BinaryWriter *shstrtab = BinaryWriter_new();
+
+    size_t first_global = Assembler_write_symbols(a, symtab, strtab);
+    Assembler_write_relocations(a, rela);
+
+    BinaryWriter_write_byte(shstrtab, 0);
+    int text_name = Assembler_add_name(shstrtab, ".text");
+    int rela_name = Assembler_add_name(shstrtab, ".rela.text");
+    int strings_name = Assembler_add_name(shstrtab, ".rodata.str1.1");
+    int rodata_name = Assembler_add_name(shstrtab, ".rodata");
+    int note_name = Assembler_add_name(shstrtab, ".note.GNU-stack");
+    int symtab_name = Assembler_add_name(shstrtab, ".symtab");
+    int strtab_name = Assembler_add_name(shstrtab, ".strtab");
+    int shstrtab_name = Assembler_add_name(shstrtab, ".shstrtab");
+
+    // Contents follow the ELF header, and the section headers come last
+    BinaryWriter *w = BinaryWriter_new();
+    BinaryWriter *parts[7];
+    size_t offsets[7];
+
+    parts[0] = Assembler_text(a);
+    parts[1] = a->sections[ASSEMBLER_STRINGS];
+    parts[2] = a->sections[ASSEMBLER_RODATA];
+    parts[3] = rela;
+    parts[4] = symtab;
+    parts[5] = strtab;
+    parts[6] = shstrtab;
+
+    size_t offset = ELF_HEADER_SIZE;
+    for (int i = 0; i < 7; i = i + 1) {
+        if (i == 3 || i == 4) {
+            offset = (offset + 7) / 8 * 8;
+        }
+
+        offsets[i] = offset;
+        offset = offset + BinaryWriter_len(parts[i]);
+    }
+
+    size_t shoff = (offset + 7) / 8 * 8;
+
+    Assembler_write_elf_header(w, shoff);
+
+    for (int i = 0; i < 7; i = i + 1) {
+        while (BinaryWriter_len(w) < offsets[i]) {
+            BinaryWriter_write_byte(w, 0);
+        }
+
+        BinaryWriter_write_bytes(
+            w, BinaryWriter_data(parts[i]), BinaryWriter_len(parts[i]));
+    }
+
+    Assembler_align(w, 8);
+
+    AssemblerSectionHeader h;
+
+    Assembler_section_header(&h, 0, 0, 0, 0, NULL);
+    h.align = 0;
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h,
+        text_name,
+        ELF_SHT_PROGBITS,
+        ELF_SHF_ALLOC + ELF_SHF_EXECINSTR,
+        offsets[0],
+        parts[0]);
+    h.align = 16;
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h, rela_name, ELF_SHT_RELA, ELF_SHF_INFO_LINK, offsets[3], rela);
+    h.link = ASSEMBLER_SHNDX_SYMTAB;
+    h.info = ASSEMBLER_SHNDX_TEXT;
+    h.align = 8;
+    h.entsize = ELF_RELA_SIZE;
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h,
+        strings_name,
+        ELF_SHT_PROGBITS,
+        ELF_SHF_ALLOC + ELF_SHF_MERGE + ELF_SHF_STRINGS,
+        offsets[1],
+        parts[1]);
+    h.entsize = 1;
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h, rodata_name, ELF_SHT_PROGBITS, ELF_SHF_ALLOC, offsets[2], parts[2]);
+    Assembler_write_section_header(w, &h);
+
+    // Marks the stack as not executable
+    Assembler_section_header(
+        &h, note_name, ELF_SHT_PROGBITS, 0, offsets[3], NULL);
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h, symtab_name, ELF_SHT_SYMTAB, 0, offsets[4], symtab);
+    h.link = ASSEMBLER_SHNDX_STRTAB;
+    h.info = first_global;
+    h.align = 8;
+    h.entsize = ELF_SYM_SIZE;
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h, strtab_name, ELF_SHT_STRTAB, 0, offsets[5], strtab);
+    Assembler_write_section_header(w, &h);
+
+    Assembler_section_header(
+        &h, shstrtab_name, ELF_SHT_STRTAB, 0, offsets[6], shstrtab);
+    Assembler_write_section_header(w, &h);
+
+    if (!BinaryWriter_save(w, path)) {
+        ERROR("cannot write file %s\n", path);
+    }
+
+    BinaryWriter_delete(symtab);
+    BinaryWriter_delete(strtab);
+    BinaryWriter_delete(rela);
+    BinaryWriter_delete(shstrtab);
+    BinaryWriter_delete(w);
+}
+
+// Assembles `text`, whose lines are terminated by newlines
+static Assembler *Assembler_parse(const char *text, size_t len) {
+    assert(text);
+
+    Assembler *a = Assembler_new();
+    size_t start = 0;
+
+    while (start < len) {
+        size_t end = start;
+        while (end < len && text[end] != '\n') {
+            end = end + 1;
+        }
+
+        if (end - start + 1 > a->line_cap) {
+            while (end - start + 1 > a->line_cap) {
+                a->line_cap = a->line_cap * 2;
+            }
+
+            a->line = realloc(a->line, sizeof(char) * a->line_cap);
+        }
+
+        memcpy(a->line, &text[start], end - start);
+        a->line[end - start] = '\0';
+        a->p = a->line;
+        a->line_number = a->line_number + 1;
+
+        Assembler_line(a);
+
+        start = end + 1;
+    }
+
+    Assembler_patch_jumps(a);
+    return a;
+}
+
+void Assembler_assemble(const char *text, size_t len, const char *path) {
+    assert(text);
+    assert(path);
+
+#ifdef __APPLE__
+    // CodeGen writes Mach-O sections and names there
+    ERROR("-c is not supported on this host: objects are written as ELF\n");
+#endif
+
+    Assembler *a = Assembler_parse(text, len);
+
+    Assembler_write_object(a, path);
+    Assembler_delete(a);
+}
+
+// Execution in memory
+
+#ifndef MOCC
+#include <dlfcn.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// The sections and a GOT slot for each load are mapped at once, so that the
+// slots are in reach of the 32-bit displacements. Common symbols follow on
+// their own pages, which stay writable.
+typedef struct AssemblerImage {
+    char *base;
+    size_t offsets[ASSEMBLER_NUM_SECTIONS];
+    size_t got_offset;
+    size_t code_size; // Made read-only and executable
+    size_t size;
+} AssemblerImage;
+
+static size_t Assembler_round_up(size_t x, size_t align) {
+    return (x + align - 1) / align * align;
+}
+
+static void Assembler_layout(Assembler *a, AssemblerImage *image) {
+    assert(a);
+    assert(image);
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t offset = 0;
+
+    for (int i = 0; i < ASSEMBLER_NUM_SECTIONS; i = i + 1) {
+        offset = Assembler_round_up(offset, 16);
+        image->offsets[i] = offset;
+        offset = offset + BinaryWriter_len(a->sections[i]);
+    }
+
+    image->got_offset = Assembler_round_up(offset, 8);
+    offset = image->got_offset +
+             sizeof(void *) * Vec_len(size_t)(a->relocation_offsets);
+
+    image->code_size = Assembler_round_up(offset, page_size);
+    offset = image->code_size;
+
+    // The offset of the storage of a common symbol replaces its alignment
+    for (size_t i = 0; i < Vec_len(AssemblerSymbol)(a->symbol_list);
+         i = i + 1) {
+        AssemblerSymbol *symbol = Vec_get(AssemblerSymbol)(a->symbol_list, i);
+
+        if (symbol->section == ASSEMBLER_COMMON) {
+            offset = Assembler_round_up(offset, symbol->value);
+            symbol->value = offset;
+            offset = offset + symbol->size;
+        }
+    }
+
+    image->size = Assembler_round_up(offset, page_size);
+}
+
+static void *Assembler_address(
+    const AssemblerImage *image, const AssemblerSymbol *symbol) {
+    assert(image);
+    assert(symbol);
+
+    if (symbol->section == ASSEMBLER_UNDEFINED) {
+        void *address = dlsym(RTLD_DEFAULT, symbol->name);
+
+        if (!address) {
+            ERROR("undefined symbol %s\n", symbol->name);
+        }
+
+        return address;
+    } else if (symbol->section == ASSEMBLER_COMMON) {
+        return image->base + symbol->value;
+    }
+
+    return image->base + image->offsets[symbol->section] + symbol->value;
+}
+
+// Fills the GOT and points each load at its slot
+static void Assembler_relocate(Assembler *a, const AssemblerImage *image) {
+    assert(a);
+    assert(image);
+
+    char *text = image->base + image->offsets[ASSEMBLER_TEXT];
+
+    for (size_t i = 0; i < Vec_len(size_t)(a->relocation_offsets); i = i + 1) {
+        size_t offset = Vec_get(size_t)(a->relocation_offsets, i);
+        AssemblerSymbol *symbol =
+            Vec_get(AssemblerSymbol)(a->relocation_symbols, i);
+        char *slot = image->base + image->got_offset + sizeof(void *) * i;
+        void *address = Assembler_address(image, symbol);
+
+        memcpy(slot, &address, sizeof(void *));
+
+        // Relative to the end of the displacement
+        int32_t displacement = (int32_t)(slot - (text + offset + 4));
+        memcpy(text + offset, &displacement, sizeof(int32_t));
+    }
+}
+
+int Assembler_run(const char *text, size_t len, int argc, char **argv) {
+    assert(text);
+    assert(argv);
+
+#ifdef __APPLE__
+    // The names there start with '_', and only ELF hosts are supported
+    ERROR("--run is not supported on this host\n");
+#endif
+
+    Assembler *a = Assembler_parse(text, len);
+    AssemblerSymbol *main_symbol =
+        Map_find(AssemblerSymbol)(a->symbols, Intern_string("main"));
+
+    if (!main_symbol || main_symbol->section != ASSEMBLER_TEXT) {
+        ERROR("main is not defined\n");
+    }
+
+    AssemblerImage image;
+    Assembler_layout(a, &image);
+
+    image.base = mmap(
+        NULL,
+        image.size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (image.base == MAP_FAILED) {
+        ERROR("cannot map memory for the code\n");
+    }
+
+    for (int i = 0; i < ASSEMBLER_NUM_SECTIONS; i = i + 1) {
+        memcpy(
+            image.base + image.offsets[i],
+            BinaryWriter_data(a->sections[i]),
+            BinaryWriter_len(a->sections[i]));
+    }
+
+    Assembler_relocate(a, &image);
+
+    if (mprotect(image.base, image.code_size, PROT_READ | PROT_EXEC) != 0) {
+        ERROR("cannot make the code executable\n");
+    }
+
+    // ISO C has no conversion from an object pointer to a function pointer
+    int (*main_function)(int, char **);
+    void *main_address = Assembler_address(&image, main_symbol);
+    memcpy(&main_function, &main_address, sizeof(main_function));
+
+    Assembler_delete(a);
+
+    // The image is kept, as the program may have registered exit handlers
+    return main_function(argc, argv);
+}
+#else
+int Assembler_run(const char *text, size_t len, int argc, char **argv) {
+    assert(text);
+    assert(argv);
+
+    ERROR("running in memory is not supported\n");
+    return 0;
+}
+#endif
@@ -39,9 +39,27 @@
     }
 #include "Ast.def"
 
+// Every node lives in the AST arena until the whole tree is dropped at once.
+// Each worker thread builds its own trees.
+static THREAD_LOCAL Arena *Node_current_arena;
+
+Arena *Node_arena(void) {
+    if (!Node_current_arena) {
+        Node_current_arena = Arena_new();
+    }
+
+    return Node_current_arena;
+}
+
+void Node_release_arena(void) {
+    if (Node_current_arena) {
+        Arena_release(Node_current_arena);
+    }
+}
+
 #define NODE(name, base)                                                       \
     static name##base##Node *name##base##Node_alloc(void) {                    \
-        name##base##Node *p = malloc(sizeof(*p));                              \
+        name##base##Node *p = Arena_alloc(Node_arena(), sizeof(*p));           \
         p->kind = NodeKind_##name##base;                                       \
         return p;                                                              \
     }
@@ -50,7 +68,7 @@
     static name##ExprNode *name##ExprNode_alloc(                               \
         Type *result_type, ValueCategory value_category) {                     \
         assert(result_type);                                                   \
-        name##ExprNode *p = malloc(sizeof(*p));                                \
+        name##ExprNode *p = Arena_alloc(Node_arena(), sizeof(*p));             \
         p->kind = NodeKind_##name##Expr;                                       \
         p->result_type = result_type;                                          \
         p->value_category = value_category;                                    \
@@ -0,0 +1,169 @@
+#include "mocc.h"
+
+// Ints are written as 4 bytes, least significant first. Strings are written
+// as their length followed by their bytes, without a terminating NUL.
+
+struct BinaryWriter {
+    char *data;
+    size_t len;
+    size_t cap;
+};
+
+struct BinaryReader {
+    const char *data;
+    size_t size;
+    size_t pos;
+};
+
+BinaryWriter *BinaryWriter_new(void) {
+    BinaryWriter *w = malloc(sizeof(BinaryWriter));
+    w->len = 0;
+    w->cap = 256;
+    w->data = malloc(sizeof(char) * w->cap);
+
+    return w;
+}
+
+void BinaryWriter_delete(BinaryWriter *w) {
+    assert(w);
+
+    free(w->data);
+    free(w);
+}
+
+void BinaryWriter_write_byte(BinaryWriter *w, int byte) {
+    assert(w);
+
+    if (w->len == w->cap) {
+        w->cap = w->cap * 2;
+        w->data = realloc(w->data, sizeof(char) * w->cap);
+        TimeReport_allocate(sizeof(char) * w->cap);
+    }
+
+    w->data[w->len] = byte;
+    w->len = w->len + 1;
+}
+
+void BinaryWriter_write_int(BinaryWriter *w, int x) {
+    assert(w);
+
+    // Extracted with masks so that negative values need no shifts
+    BinaryWriter_write_byte(w, x & 255);
+    BinaryWriter_write_byte(w, (x & 65280) / 256);
+    BinaryWriter_write_byte(w, (x & 16711680) / 65536);
+    BinaryWriter_write_byte(w, ((x & -16777216) / 16777216) & 255);
+}
+
+void BinaryWriter_write_bytes(BinaryWriter *w, const char *s, size_t len) {
+    assert(w);
+    assert(s);
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        BinaryWriter_write_byte(w, s[i]);
+    }
+}
+
+void BinaryWriter_write_string(BinaryWriter *w, const char *s) {
+    assert(w);
+    assert(s);
+
+    size_t len = strlen(s);
+
+    BinaryWriter_write_int(w, len);
+    BinaryWriter_write_bytes(w, s, len);
+}
+
+void BinaryWriter_patch_int(BinaryWriter *w, size_t pos, int x) {
+    assert(w);
+    assert(pos + 4 <= w->len);
+
+    size_t len = w->len;
+
+    w->len = pos;
+    BinaryWriter_write_int(w, x);
+    w->len = len;
+}
+
+const char *BinaryWriter_data(const BinaryWriter *w) {
+    assert(w);
+
+    return w->data;
+}
+
+size_t BinaryWriter_len(const BinaryWriter *w) {
+    assert(w);
+
+    return w->len;
+}
+
+bool BinaryWriter_save(const BinaryWriter *w, const char *path) {
+    assert(w);
+    assert(path);
+
+    FILE *fp = fopen(path, "wb");
+    if (fp == (FILE *)NULL) {
+        return false;
+    }
+
+    size_t written = fwrite(w->data, 1, w->len, fp);
+    fclose(fp);
+
+    return written == w->len;
+}
+
+BinaryReader *BinaryReader_new(const char *data, size_t size) {
+    assert(data);
+
+    BinaryReader *r = malloc(sizeof(BinaryReader));
+    r->data = data;
+    r->size = size;
+    r->pos = 0;
+
+    return r;
+}
+
+const char *BinaryReader_read_bytes(BinaryReader *r, size_t len) {
+    assert(r);
+
+    if (len > r->size - r->pos) {
+        ERROR("unexpected end of binary data\n");
+    }
+
+    const char *p = &r->data[r->pos];
+    r->pos = r->pos + len;
+
+    return p;
+}
+
+int BinaryReader_read_int(BinaryReader *r) {
+    assert(r);
+
+    const char *p = BinaryReader_read_bytes(r, 4);
+    int b0 = p[0] & 255;
+    int b1 = p[1] & 255;
+    int b2 = p[2] & 255;
+    int b3 = p[3] & 255;
+
+    if (b3 >= 128) {
+        b3 = b3 - 256;
+    }
+
+    return b3 * 16777216 + b2 * 65536 + b1 * 256 + b0;
+}
+
+const char *BinaryReader_read_string(BinaryReader *r) {
+    assert(r);
+
+    int len = BinaryReader_read_int(r);
+    if ((len & (-2147483647 - 1)) != 0) {
+        ERROR("invalid string length in binary data\n");
+    }
+
+    return Intern_substring(BinaryReader_read_bytes(r, len), len);
+}
+
+bool BinaryReader_at_end(const BinaryReader *r) {
+    assert(r);
+
+    return r->pos == r->size;
+}
@@ -25,6 +25,7 @@ typedef struct NativeAddress {
 
 static NativeAddress *NativeAddress_new(enum NativeAddressType type) {
     NativeAddress *a = malloc(sizeof(NativeAddress));
+    TimeReport_allocate(sizeof(NativeAddress));
     a->type = type;
     a->offset = 0;
 
@@ -47,18 +48,31 @@ static NativeAddress *NativeAddress_new_stack(int offset) {
 
 #define NUM_REGISTERS 6
 
-typedef struct CodeGen {
-    FILE *fp;
+struct CodeGen {
+    Emitter *out;
+
+    // Labels and string literals are numbered within each function, so that
+    // functions can be generated independently
+    int num_functions;
+    int function_index;
     int next_label;
     int return_label;
 
+    // String literals of the current function
     Vec(String) * list_of_string;
     Vec(size_t) * list_of_length;
 
+    // String literals of the finished functions, and for each label, the
+    // function index, the index within the function and the pool entry
+    StringPool *pool;
+    Vec(size_t) * pool_functions;
+    Vec(size_t) * pool_indices;
+    Vec(size_t) * pool_entries;
+
     const char *registers_qword[NUM_REGISTERS];
     const char *registers_dword[NUM_REGISTERS];
     const char *registers_byte[NUM_REGISTERS];
-} CodeGen;
+};
 
 static int CodeGen_next_label(CodeGen *g) {
     assert(g);
@@ -68,12 +82,70 @@ static int CodeGen_next_label(CodeGen *g) {
     return label;
 }
 
+// Writes `.L<function>_<label>`
+static void CodeGen_write_label(CodeGen *g, int label) {
+    assert(g);
+
+    Emitter_write(g->out, ".L");
+    Emitter_write_int(g->out, g->function_index);
+    Emitter_write_char(g->out, '_');
+    Emitter_write_int(g->out, label);
+}
+
+static void CodeGen_label(CodeGen *g, int label) {
+    assert(g);
+
+    CodeGen_write_label(g, label);
+    Emitter_write(g->out, ":\n");
+}
+
+static void CodeGen_jump(CodeGen *g, const char *instruction, int label) {
+    assert(g);
+    assert(instruction);
+
+    Emitter_write(g->out, "  ");
+    Emitter_write(g->out, instruction);
+    Emitter_write_char(g->out, ' ');
+    CodeGen_write_label(g, label);
+    Emitter_write_char(g->out, '\n');
+}
+
+// Writes an instruction whose last operand is an integer, such as
+// `  push 42`
+static void CodeGen_emit_int(CodeGen *g, const char *instruction, int x) {
+    assert(g);
+    assert(instruction);
+
+    Emitter_write(g->out, instruction);
+    Emitter_write_int(g->out, x);
+    Emitter_write_char(g->out, '\n');
+}
+
+static void
+CodeGen_emit_size(CodeGen *g, const char *instruction, size_t x) {
+    assert(g);
+    assert(instruction);
+
+    Emitter_write(g->out, instruction);
+    Emitter_write_size(g->out, x);
+    Emitter_write_char(g->out, '\n');
+}
+
+// Writes `[rbp-<offset>]`
+static void CodeGen_write_stack(CodeGen *g, int offset) {
+    assert(g);
+
+    Emitter_write(g->out, "[rbp");
+    Emitter_write_signed_int(g->out, -offset);
+    Emitter_write_char(g->out, ']');
+}
+
 static size_t
 CodeGen_add_string(CodeGen *g, const char *string, size_t length) {
     assert(g);
     assert(string);
 
-    // TODO: dedup
+    // Equal literals are merged in the constant pool
     size_t label = Vec_len(String)(g->list_of_string);
 
     Vec_push(String)(g->list_of_string, string);
@@ -82,41 +154,139 @@ CodeGen_add_string(CodeGen *g, const char *string, size_t length) {
     return label;
 }
 
+// Writes the bytes as the contents of a string directive
+static void
+CodeGen_write_string_contents(CodeGen *g, const char *s, size_t len) {
+    assert(g);
+    assert(s);
+
+    Emitter_write_char(g->out, '"');
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        int c = s[i] & 255;
+
+        if (c == '"' || c == '\\') {
+            Emitter_write_char(g->out, '\\');
+            Emitter_write_char(g->out, c);
+        } else if (c >= ' ' && c <= '~') {
+            Emitter_write_char(g->out, c);
+        } else {
+            // Always three octal digits, so that a digit after it is not read
+            // as a part of the escape
+            Emitter_write_char(g->out, '\\');
+            Emitter_write_char(g->out, '0' + c / 64);
+            Emitter_write_char(g->out, '0' + c / 8 % 8);
+            Emitter_write_char(g->out, '0' + c % 8);
+        }
+    }
+
+    Emitter_write(g->out, "\"\n");
+}
+
+static void CodeGen_write_pool_entry_label(CodeGen *g, size_t entry) {
+    assert(g);
+
+    Emitter_write(g->out, ".LS");
+    Emitter_write_size(g->out, entry);
+}
+
+// Writes the literals that are not merged into another one. Literals without
+// NUL go to a mergeable section, where the linker also merges them across
+// translation units; the others are written as raw bytes.
+static void CodeGen_gen_pool_entries(CodeGen *g, bool has_nul) {
+    assert(g);
+
+    for (size_t i = 0; i < StringPool_len(g->pool); i = i + 1) {
+        size_t offset;
+
+        if (StringPool_has_nul(g->pool, i) == has_nul &&
+            StringPool_root(g->pool, i, &offset) == i) {
+            CodeGen_write_pool_entry_label(g, i);
+            Emitter_write(g->out, ":\n");
+
+            if (has_nul) {
+                // The string literal is not terminated in the source
+                Emitter_write(g->out, "  .ascii ");
+                CodeGen_write_string_contents(
+                    g,
+                    StringPool_string(g->pool, i),
+                    StringPool_length(g->pool, i));
+                Emitter_write(g->out, "  .byte 0\n");
+            } else {
+                Emitter_write(g->out, "  .string ");
+                CodeGen_write_string_contents(
+                    g,
+                    StringPool_string(g->pool, i),
+                    StringPool_length(g->pool, i));
+            }
+        }
+    }
+}
+
 static void CodeGen_gen_constant_pool(CodeGen *g) {
     assert(g);
 
+    StringPool_merge_suffixes(g->pool);
+
 #ifdef __APPLE__
-    fprintf(g->fp, "  .section __DATA,__data\n");
+    Emitter_write(g->out, "  .section __TEXT,__cstring,cstring_literals\n");
 #else
-    fprintf(g->fp, "  .section .rodata\n");
+    Emitter_write(g->out, "  .section .rodata.str1.1,");
+    Emitter_write(g->out, "\"aMS\",@progbits,1\n");
 #endif
+    CodeGen_gen_pool_entries(g, false);
 
-    for (size_t i = 0; i < Vec_len(String)(g->list_of_string); i = i + 1) {
-        const char *s = Vec_get(String)(g->list_of_string, i);
-        size_t len = Vec_get(size_t)(g->list_of_length, i);
-
-        fprintf(g->fp, ".S%zu:\n", i);
-
-        for (size_t j = 0; j < len; j = j + 1) {
-            fprintf(g->fp, "  .byte 0x%02x\n", s[j] & 255);
+#ifdef __APPLE__
+    Emitter_write(g->out, "  .section __TEXT,__const\n");
+#else
+    Emitter_write(g->out, "  .section .rodata\n");
+#endif
+    CodeGen_gen_pool_entries(g, true);
+
+    // The labels used by the functions point into the entries
+    for (size_t i = 0; i < Vec_len(size_t)(g->pool_entries); i = i + 1) {
+        size_t offset;
+        size_t root = StringPool_root(
+            g->pool, Vec_get(size_t)(g->pool_entries, i), &offset);
+
+        Emitter_write(g->out, "  .set .S");
+        Emitter_write_size(g->out, Vec_get(size_t)(g->pool_functions, i));
+        Emitter_write_char(g->out, '_');
+        Emitter_write_size(g->out, Vec_get(size_t)(g->pool_indices, i));
+        Emitter_write(g->out, ", ");
+        CodeGen_write_pool_entry_label(g, root);
+
+        if (offset > 0) {
+            Emitter_write_char(g->out, '+');
+            Emitter_write_size(g->out, offset);
         }
+
+        Emitter_write_char(g->out, '\n');
     }
 }
 
+static void CodeGen_load_label(CodeGen *g, const char *label) {
+    assert(g);
+    assert(label);
+
+    Emitter_write(g->out, "  mov rax, ");
+    Emitter_write(g->out, GLOBAL_PREFIX);
+    Emitter_write(g->out, label);
+    Emitter_write(g->out, GLOBAL_POSTFIX);
+    Emitter_write(g->out, "[rip]\n");
+    Emitter_write(g->out, "  push rax\n");
+}
+
 static void CodeGen_load_address(CodeGen *g, const NativeAddress *address) {
     assert(address);
 
     if (address->type == NativeAddressType_label) {
-        fprintf(
-            g->fp,
-            "  mov rax, %s%s%s[rip]\n",
-            GLOBAL_PREFIX,
-            address->label,
-            GLOBAL_POSTFIX);
-        fprintf(g->fp, "  push rax\n");
+        CodeGen_load_label(g, address->label);
     } else if (address->type == NativeAddressType_stack) {
-        fprintf(g->fp, "  lea rax, [rbp%+d]\n", -address->offset);
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  lea rax, ");
+        CodeGen_write_stack(g, address->offset);
+        Emitter_write_char(g->out, '\n');
+        Emitter_write(g->out, "  push rax\n");
     } else {
         ERROR("unknown address type %d\n", address->type);
     }
@@ -127,17 +297,17 @@ static void CodeGen_store(CodeGen *g, const Type *type) {
     assert(type);
 
     if (type->kind == TypeKind_char) {
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  mov [rdi], al\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  mov [rdi], al\n");
     } else if (type->kind == TypeKind_int || type->kind == TypeKind_enum) {
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  mov [rdi], eax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  mov [rdi], eax\n");
     } else if (type->kind == TypeKind_pointer) {
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  mov [rdi], rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  mov [rdi], rax\n");
     } else {
         ERROR("unknown type\n");
     }
@@ -183,6 +353,14 @@ static void CodeGen_gen_IdentifierExpr(CodeGen *g, IdentifierExprNode *p) {
     assert(g);
     assert(p);
 
+    // Functions declared only in a precompiled header have no address. The
+    // symbol is left untouched, since functions may be generated in parallel.
+    if (!p->symbol->address) {
+        assert(p->symbol->type->kind == TypeKind_function);
+        CodeGen_load_label(g, p->symbol->name);
+        return;
+    }
+
     CodeGen_load_address(g, p->symbol->address);
 }
 
@@ -190,14 +368,14 @@ static void CodeGen_gen_EnumeratorExpr(CodeGen *g, EnumeratorExprNode *p) {
     assert(g);
     assert(p);
 
-    fprintf(g->fp, "  push %d\n", p->value);
+    CodeGen_emit_int(g, "  push ", p->value);
 }
 
 static void CodeGen_gen_IntegerExpr(CodeGen *g, IntegerExprNode *p) {
     assert(g);
     assert(p);
 
-    fprintf(g->fp, "  push %d\n", p->value);
+    CodeGen_emit_int(g, "  push ", p->value);
 }
 
 static void CodeGen_gen_StringExpr(CodeGen *g, StringExprNode *p) {
@@ -206,8 +384,13 @@ static void CodeGen_gen_StringExpr(CodeGen *g, StringExprNode *p) {
 
     size_t string_label = CodeGen_add_string(g, p->value, p->length);
 
-    fprintf(g->fp, "  mov rax, .S%zu%s[rip]\n", string_label, GLOBAL_POSTFIX);
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  mov rax, .S");
+    Emitter_write_int(g->out, g->function_index);
+    Emitter_write_char(g->out, '_');
+    Emitter_write_size(g->out, string_label);
+    Emitter_write(g->out, GLOBAL_POSTFIX);
+    Emitter_write(g->out, "[rip]\n");
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_SubscriptExpr(CodeGen *g, SubscriptExprNode *p) {
@@ -219,11 +402,11 @@ static void CodeGen_gen_SubscriptExpr(CodeGen *g, SubscriptExprNode *p) {
 
     size_t size = Type_sizeof(p->result_type);
 
-    fprintf(g->fp, "  pop rax\n");
-    fprintf(g->fp, "  pop rdi\n");
-    fprintf(g->fp, "  imul rdi, %zu\n", size);
-    fprintf(g->fp, "  lea rax, [rax+rdi]\n");
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  pop rax\n");
+    Emitter_write(g->out, "  pop rdi\n");
+    CodeGen_emit_size(g, "  imul rdi, ", size);
+    Emitter_write(g->out, "  lea rax, [rax+rdi]\n");
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_CallExpr(CodeGen *g, CallExprNode *p) {
@@ -245,23 +428,25 @@ static void CodeGen_gen_CallExpr(CodeGen *g, CallExprNode *p) {
     }
 
     for (size_t i = 0; i < num_arguments; i = i + 1) {
-        fprintf(g->fp, "  pop %s\n", g->registers_qword[i]);
+        Emitter_write(g->out, "  pop ");
+        Emitter_write(g->out, g->registers_qword[i]);
+        Emitter_write_char(g->out, '\n');
     }
 
     // Callee
     CodeGen_gen_expr(g, p->callee);
 
-    fprintf(g->fp, "  pop r10\n");
+    Emitter_write(g->out, "  pop r10\n");
 
     Type *pointer_type = p->callee->result_type;
     Type *function_type = PointerType_pointee_type(pointer_type);
 
     if (FunctionType_is_var_arg(function_type)) {
-        fprintf(g->fp, "  mov rax, 0\n");
+        Emitter_write(g->out, "  mov rax, 0\n");
     }
 
-    fprintf(g->fp, "  call r10\n");
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  call r10\n");
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_DotExpr(CodeGen *g, DotExprNode *p) {
@@ -279,9 +464,9 @@ static void CodeGen_gen_DotExpr(CodeGen *g, DotExprNode *p) {
 
     size_t offset = CodeGen_member_offset(g, struct_type, p->member_symbol);
 
-    fprintf(g->fp, "  pop rax\n");
-    fprintf(g->fp, "  add rax, %zu\n", offset);
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  pop rax\n");
+    CodeGen_emit_size(g, "  add rax, ", offset);
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_ArrowExpr(CodeGen *g, ArrowExprNode *p) {
@@ -296,16 +481,16 @@ static void CodeGen_gen_ArrowExpr(CodeGen *g, ArrowExprNode *p) {
 
     size_t offset = CodeGen_member_offset(g, struct_type, p->member_symbol);
 
-    fprintf(g->fp, "  pop rax\n");
-    fprintf(g->fp, "  add rax, %zu\n", offset);
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  pop rax\n");
+    CodeGen_emit_size(g, "  add rax, ", offset);
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_SizeofExpr(CodeGen *g, SizeofExprNode *p) {
     assert(g);
     assert(p);
 
-    fprintf(g->fp, "  push %zu\n", Type_sizeof(p->type));
+    CodeGen_emit_size(g, "  push ", Type_sizeof(p->type));
 }
 
 static void CodeGen_gen_CastExpr(CodeGen *g, CastExprNode *p) {
@@ -324,15 +509,15 @@ static void CodeGen_gen_UnaryExpr(CodeGen *g, UnaryExprNode *p) {
     if (p->operator== UnaryOp_positive) {
         // Do nothing
     } else if (p->operator== UnaryOp_negative) {
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  neg rax\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  neg rax\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== UnaryOp_not) {
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  sete al\n");
-        fprintf(g->fp, "  movsx rax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        Emitter_write(g->out, "  sete al\n");
+        Emitter_write(g->out, "  movsx rax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== UnaryOp_address_of) {
         // Do nothing
     } else if (p->operator== UnaryOp_indirection) {
@@ -350,150 +535,150 @@ static void CodeGen_gen_BinaryExpr(CodeGen *g, BinaryExprNode *p) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  add rax, rdi\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  add rax, rdi\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_sub) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  sub rax, rdi\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  sub rax, rdi\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_mul) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  imul rax, rdi\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  imul rax, rdi\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_div) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cqo\n");
-        fprintf(g->fp, "  idiv rdi\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cqo\n");
+        Emitter_write(g->out, "  idiv rdi\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_mod) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cqo\n");
-        fprintf(g->fp, "  idiv rdi\n");
-        fprintf(g->fp, "  push rdx\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cqo\n");
+        Emitter_write(g->out, "  idiv rdi\n");
+        Emitter_write(g->out, "  push rdx\n");
     } else if (p->operator== BinaryOp_lesser_than) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  setl al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  setl al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_lesser_equal) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  setle al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  setle al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_greater_than) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  setg al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  setg al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_greater_equal) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  setge al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  setge al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_equal) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  sete al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  sete al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_not_equal) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, rdi\n");
-        fprintf(g->fp, "  setne al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, rdi\n");
+        Emitter_write(g->out, "  setne al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_and) {
         CodeGen_gen_expr(g, p->lhs);
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rdi\n");
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  and rax, rdi\n");
-        fprintf(g->fp, "  push rax\n");
+        Emitter_write(g->out, "  pop rdi\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  and rax, rdi\n");
+        Emitter_write(g->out, "  push rax\n");
     } else if (p->operator== BinaryOp_logical_and) {
         int end_label = CodeGen_next_label(g);
 
         CodeGen_gen_expr(g, p->lhs);
 
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  push 0\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  je .L%d\n", end_label);
-        fprintf(g->fp, "  pop rax\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  push 0\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        CodeGen_jump(g, "je", end_label);
+        Emitter_write(g->out, "  pop rax\n");
 
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  setne al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
-        fprintf(g->fp, ".L%d:\n", end_label);
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        Emitter_write(g->out, "  setne al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
+        CodeGen_label(g, end_label);
     } else if (p->operator== BinaryOp_logical_or) {
         int end_label = CodeGen_next_label(g);
 
         CodeGen_gen_expr(g, p->lhs);
 
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  push 1\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  jne .L%d\n", end_label);
-        fprintf(g->fp, "  pop rax\n");
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  push 1\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        CodeGen_jump(g, "jne", end_label);
+        Emitter_write(g->out, "  pop rax\n");
 
         CodeGen_gen_expr(g, p->rhs);
 
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  setne al\n");
-        fprintf(g->fp, "  movsx eax, al\n");
-        fprintf(g->fp, "  push rax\n");
-        fprintf(g->fp, ".L%d:\n", end_label);
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        Emitter_write(g->out, "  setne al\n");
+        Emitter_write(g->out, "  movsx eax, al\n");
+        Emitter_write(g->out, "  push rax\n");
+        CodeGen_label(g, end_label);
     } else {
         ERROR("unknown binary op %d\n", p->operator);
     }
@@ -508,7 +693,7 @@ static void CodeGen_gen_AssignExpr(CodeGen *g, AssignExprNode *p) {
 
     CodeGen_store(g, p->lhs->result_type);
 
-    fprintf(g->fp, "  push rax\n");
+    Emitter_write(g->out, "  push rax\n");
 }
 
 static void CodeGen_gen_ImplicitCastExpr(CodeGen *g, ImplicitCastExprNode *p) {
@@ -519,19 +704,19 @@ static void CodeGen_gen_ImplicitCastExpr(CodeGen *g, ImplicitCastExprNode *p) {
 
     if (p->operator== ImplicitCastOp_lvalue_to_rvalue) {
         if (p->result_type->kind == TypeKind_char) {
-            fprintf(g->fp, "  pop rax\n");
-            fprintf(g->fp, "  mov al, [rax]\n");
-            fprintf(g->fp, "  push rax\n");
+            Emitter_write(g->out, "  pop rax\n");
+            Emitter_write(g->out, "  mov al, [rax]\n");
+            Emitter_write(g->out, "  push rax\n");
         } else if (
             p->result_type->kind == TypeKind_int ||
             p->result_type->kind == TypeKind_enum) {
-            fprintf(g->fp, "  pop rax\n");
-            fprintf(g->fp, "  mov eax, [rax]\n");
-            fprintf(g->fp, "  push rax\n");
+            Emitter_write(g->out, "  pop rax\n");
+            Emitter_write(g->out, "  mov eax, [rax]\n");
+            Emitter_write(g->out, "  push rax\n");
         } else if (p->result_type->kind == TypeKind_pointer) {
-            fprintf(g->fp, "  pop rax\n");
-            fprintf(g->fp, "  mov rax, [rax]\n");
-            fprintf(g->fp, "  push rax\n");
+            Emitter_write(g->out, "  pop rax\n");
+            Emitter_write(g->out, "  mov rax, [rax]\n");
+            Emitter_write(g->out, "  push rax\n");
         } else {
             ERROR("unknown type\n");
         }
@@ -552,9 +737,9 @@ static void CodeGen_gen_ImplicitCastExpr(CodeGen *g, ImplicitCastExprNode *p) {
             p->result_type->kind == TypeKind_enum) {
             if (p->expression->result_type->kind == TypeKind_char) {
                 // char -> int
-                fprintf(g->fp, "  pop rax\n");
-                fprintf(g->fp, "  movsx eax, al\n");
-                fprintf(g->fp, "  push rax\n");
+                Emitter_write(g->out, "  pop rax\n");
+                Emitter_write(g->out, "  movsx eax, al\n");
+                Emitter_write(g->out, "  push rax\n");
             } else if (
                 p->expression->result_type->kind == TypeKind_int ||
                 p->expression->result_type->kind == TypeKind_enum) {
@@ -609,24 +794,24 @@ static void CodeGen_gen_IfStmt(CodeGen *g, IfStmtNode *p) {
     // Condition
     CodeGen_gen_expr(g, p->condition);
 
-    fprintf(g->fp, "  pop rax\n");
-    fprintf(g->fp, "  cmp rax, 0\n");
-    fprintf(g->fp, "  je .L%d\n", else_label);
+    Emitter_write(g->out, "  pop rax\n");
+    Emitter_write(g->out, "  cmp rax, 0\n");
+    CodeGen_jump(g, "je", else_label);
 
     // Then
     CodeGen_gen_stmt(g, p->if_true);
 
-    fprintf(g->fp, "  jmp .L%d\n", end_label);
+    CodeGen_jump(g, "jmp", end_label);
 
     // Else
-    fprintf(g->fp, ".L%d:\n", else_label);
+    CodeGen_label(g, else_label);
 
     if (p->if_false) {
         CodeGen_gen_stmt(g, p->if_false);
     }
 
     // End if
-    fprintf(g->fp, ".L%d:\n", end_label);
+    CodeGen_label(g, end_label);
 }
 
 static void CodeGen_gen_WhileStmt(CodeGen *g, WhileStmtNode *p) {
@@ -637,23 +822,23 @@ static void CodeGen_gen_WhileStmt(CodeGen *g, WhileStmtNode *p) {
     int condition_label = CodeGen_next_label(g);
     int end_label = CodeGen_next_label(g);
 
-    fprintf(g->fp, "  jmp .L%d\n", condition_label);
+    CodeGen_jump(g, "jmp", condition_label);
 
     // Body
-    fprintf(g->fp, ".L%d:\n", loop_label);
+    CodeGen_label(g, loop_label);
 
     CodeGen_gen_stmt(g, p->body);
 
     // Condition
-    fprintf(g->fp, ".L%d:\n", condition_label);
+    CodeGen_label(g, condition_label);
 
     CodeGen_gen_expr(g, p->condition);
 
-    fprintf(g->fp, "  pop rax\n");
-    fprintf(g->fp, "  cmp rax, 0\n");
-    fprintf(g->fp, "  jne .L%d\n", loop_label);
+    Emitter_write(g->out, "  pop rax\n");
+    Emitter_write(g->out, "  cmp rax, 0\n");
+    CodeGen_jump(g, "jne", loop_label);
 
-    fprintf(g->fp, ".L%d:\n", end_label);
+    CodeGen_label(g, end_label);
 }
 
 static void CodeGen_gen_ForStmt(CodeGen *g, ForStmtNode *p) {
@@ -670,36 +855,36 @@ static void CodeGen_gen_ForStmt(CodeGen *g, ForStmtNode *p) {
         CodeGen_gen_stmt(g, p->initializer);
     }
 
-    fprintf(g->fp, "  jmp .L%d\n", condition_label);
+    CodeGen_jump(g, "jmp", condition_label);
 
     // Body
-    fprintf(g->fp, ".L%d:\n", loop_label);
+    CodeGen_label(g, loop_label);
 
     CodeGen_gen_stmt(g, p->body);
 
     // Step
-    fprintf(g->fp, ".L%d:\n", step_label);
+    CodeGen_label(g, step_label);
 
     if (p->step) {
         CodeGen_gen_expr(g, p->step);
 
-        fprintf(g->fp, "  pop rax\n");
+        Emitter_write(g->out, "  pop rax\n");
     }
 
     // Condition
-    fprintf(g->fp, ".L%d:\n", condition_label);
+    CodeGen_label(g, condition_label);
 
     if (p->condition) {
         CodeGen_gen_expr(g, p->condition);
 
-        fprintf(g->fp, "  pop rax\n");
-        fprintf(g->fp, "  cmp rax, 0\n");
-        fprintf(g->fp, "  jne .L%d\n", loop_label);
+        Emitter_write(g->out, "  pop rax\n");
+        Emitter_write(g->out, "  cmp rax, 0\n");
+        CodeGen_jump(g, "jne", loop_label);
     } else {
-        fprintf(g->fp, "  jmp .L%d\n", loop_label);
+        CodeGen_jump(g, "jmp", loop_label);
     }
 
-    fprintf(g->fp, ".L%d:\n", end_label);
+    CodeGen_label(g, end_label);
 }
 
 static void CodeGen_gen_ReturnStmt(CodeGen *g, ReturnStmtNode *p) {
@@ -709,10 +894,10 @@ static void CodeGen_gen_ReturnStmt(CodeGen *g, ReturnStmtNode *p) {
     if (p->return_value) {
         CodeGen_gen_expr(g, p->return_value);
 
-        fprintf(g->fp, "  pop rax\n");
+        Emitter_write(g->out, "  pop rax\n");
     }
 
-    fprintf(g->fp, "  jmp .L%d\n", g->return_label);
+    CodeGen_jump(g, "jmp", g->return_label);
 }
 
 static void CodeGen_gen_DeclStmt(CodeGen *g, DeclStmtNode *p) {
@@ -740,7 +925,7 @@ static void CodeGen_gen_ExprStmt(CodeGen *g, ExprStmtNode *p) {
 
     CodeGen_gen_expr(g, p->expression);
 
-    fprintf(g->fp, "  pop rax\n");
+    Emitter_write(g->out, "  pop rax\n");
 }
 
 static void CodeGen_gen_stmt(CodeGen *g, StmtNode *p) {
@@ -831,29 +1016,34 @@ CodeGen_store_parameters(CodeGen *g, Vec(DeclaratorNode) * parameters) {
         NativeAddress *address = symbol->address;
         assert(address->type == NativeAddressType_stack);
 
+        const char *reg;
+
         if (symbol->type->kind == TypeKind_char) {
-            fprintf(
-                g->fp,
-                "  mov [rbp%+d], %s\n",
-                -address->offset,
-                g->registers_byte[index]);
+            reg = g->registers_byte[index];
         } else if (
             symbol->type->kind == TypeKind_int ||
             symbol->type->kind == TypeKind_enum) {
-            fprintf(
-                g->fp,
-                "  mov [rbp%+d], %s\n",
-                -address->offset,
-                g->registers_dword[index]);
+            reg = g->registers_dword[index];
         } else if (symbol->type->kind == TypeKind_pointer) {
-            fprintf(
-                g->fp,
-                "  mov [rbp%+d], %s\n",
-                -address->offset,
-                g->registers_qword[index]);
+            reg = g->registers_qword[index];
         } else {
             ERROR("unknown type\n");
         }
+
+        Emitter_write(g->out, "  mov ");
+        CodeGen_write_stack(g, address->offset);
+        Emitter_write(g->out, ", ");
+        Emitter_write(g->out, reg);
+        Emitter_write_char(g->out, '\n');
+    }
+}
+
+// Gives a function its label address, unless a prototype already did
+static void CodeGen_declare_function(Symbol *symbol) {
+    assert(symbol);
+
+    if (!symbol->address) {
+        symbol->address = NativeAddress_new_label(symbol->name);
     }
 }
 
@@ -871,22 +1061,21 @@ static void CodeGen_gen_global_decl(CodeGen *g, GlobalDeclNode *p) {
             Type *type = symbol->type;
 
             if (type->kind == TypeKind_function) {
-                if (!symbol->address) {
-                    symbol->address = NativeAddress_new_label(symbol->name);
-                }
+                CodeGen_declare_function(symbol);
             } else {
                 assert(!Type_is_incomplete_type(type));
 
                 symbol->address = NativeAddress_new_label(symbol->name);
 
                 // TODO: initializer
-                fprintf(
-                    g->fp,
-                    "  .comm %s%s, %zu, %zu\n",
-                    GLOBAL_PREFIX,
-                    symbol->name,
-                    Type_sizeof(type),
-                    Type_alignof(type));
+                Emitter_write(g->out, "  .comm ");
+                Emitter_write(g->out, GLOBAL_PREFIX);
+                Emitter_write(g->out, symbol->name);
+                Emitter_write(g->out, ", ");
+                Emitter_write_size(g->out, Type_sizeof(type));
+                Emitter_write(g->out, ", ");
+                Emitter_write_size(g->out, Type_alignof(type));
+                Emitter_write_char(g->out, '\n');
             }
         }
     }
@@ -898,20 +1087,25 @@ static void CodeGen_gen_function_decl(CodeGen *g, FunctionDeclNode *p) {
 
     // Function label
     Symbol *symbol = DeclaratorNode_symbol(p->declarator);
-    symbol->address = NativeAddress_new_label(symbol->name);
+    CodeGen_declare_function(symbol);
 
     if (symbol->storage_class != StorageClass_static) {
-        fprintf(g->fp, "  .global %s%s\n", GLOBAL_PREFIX, symbol->name);
+        Emitter_write(g->out, "  .global ");
+        Emitter_write(g->out, GLOBAL_PREFIX);
+        Emitter_write(g->out, symbol->name);
+        Emitter_write_char(g->out, '\n');
     }
-    fprintf(g->fp, "%s%s:\n", GLOBAL_PREFIX, symbol->name);
-    fprintf(g->fp, "  .cfi_startproc\n");
+    Emitter_write(g->out, GLOBAL_PREFIX);
+    Emitter_write(g->out, symbol->name);
+    Emitter_write(g->out, ":\n");
+    Emitter_write(g->out, "  .cfi_startproc\n");
 
     // Prolog
-    fprintf(g->fp, "  push rbp\n");
-    fprintf(g->fp, "  .cfi_def_cfa_offset 16\n");
-    fprintf(g->fp, "  .cfi_offset rbp, -16\n");
-    fprintf(g->fp, "  mov rbp, rsp\n");
-    fprintf(g->fp, "  .cfi_def_cfa_register rbp\n");
+    Emitter_write(g->out, "  push rbp\n");
+    Emitter_write(g->out, "  .cfi_def_cfa_offset 16\n");
+    Emitter_write(g->out, "  .cfi_offset rbp, -16\n");
+    Emitter_write(g->out, "  mov rbp, rsp\n");
+    Emitter_write(g->out, "  .cfi_def_cfa_register rbp\n");
 
     int stack_top = 0;
 
@@ -923,7 +1117,7 @@ static void CodeGen_gen_function_decl(CodeGen *g, FunctionDeclNode *p) {
         stack_top = (stack_top / 16 + 1) * 16;
     }
 
-    fprintf(g->fp, "  sub rsp, %d\n", stack_top);
+    CodeGen_emit_int(g, "  sub rsp, ", stack_top);
 
     CodeGen_store_parameters(g, parameters);
 
@@ -933,71 +1127,264 @@ static void CodeGen_gen_function_decl(CodeGen *g, FunctionDeclNode *p) {
     CodeGen_gen_stmt(g, p->body);
 
     // Epilog
-    fprintf(g->fp, ".L%d:\n", g->return_label);
-    fprintf(g->fp, "  mov rsp, rbp\n");
-    fprintf(g->fp, "  pop rbp\n");
-    fprintf(g->fp, "  ret\n");
-    fprintf(g->fp, "  .cfi_endproc\n");
+    CodeGen_label(g, g->return_label);
+    Emitter_write(g->out, "  mov rsp, rbp\n");
+    Emitter_write(g->out, "  pop rbp\n");
+    Emitter_write(g->out, "  ret\n");
+    Emitter_write(g->out, "  .cfi_endproc\n");
+}
+
+// Writes to `fp`, or to memory if `fp` is NULL
+static CodeGen *CodeGen_alloc(FILE *fp) {
+    CodeGen *g = malloc(sizeof(CodeGen));
+    g->out = Emitter_new(fp);
+    g->num_functions = 0;
+    g->function_index = -1;
+    g->next_label = 0;
+    g->return_label = -1;
+    g->list_of_string = Vec_new(String)();
+    g->list_of_length = Vec_new(size_t)();
+    g->pool = StringPool_new();
+    g->pool_functions = Vec_new(size_t)();
+    g->pool_indices = Vec_new(size_t)();
+    g->pool_entries = Vec_new(size_t)();
+
+    g->registers_qword[0] = "rdi";
+    g->registers_qword[1] = "rsi";
+    g->registers_qword[2] = "rdx";
+    g->registers_qword[3] = "rcx";
+    g->registers_qword[4] = "r8";
+    g->registers_qword[5] = "r9";
+
+    g->registers_dword[0] = "edi";
+    g->registers_dword[1] = "esi";
+    g->registers_dword[2] = "edx";
+    g->registers_dword[3] = "ecx";
+    g->registers_dword[4] = "r8d";
+    g->registers_dword[5] = "r9d";
+
+    g->registers_byte[0] = "dil";
+    g->registers_byte[1] = "sil";
+    g->registers_byte[2] = "dl";
+    g->registers_byte[3] = "cl";
+    g->registers_byte[4] = "r8b";
+    g->registers_byte[5] = "r9b";
+
+    return g;
 }
 
-static void CodeGen_gen_top_level_decl(CodeGen *g, DeclNode *p) {
+void CodeGen_delete(CodeGen *g) {
+    assert(g);
+
+    Vec_delete(String)(g->list_of_string);
+    Vec_delete(size_t)(g->list_of_length);
+    StringPool_delete(g->pool);
+    Vec_delete(size_t)(g->pool_functions);
+    Vec_delete(size_t)(g->pool_indices);
+    Vec_delete(size_t)(g->pool_entries);
+    Emitter_delete(g->out);
+    free(g);
+}
+
+CodeGen *CodeGen_new(FILE *fp) {
+    CodeGen *g = CodeGen_alloc(fp);
+
+    Emitter_write(g->out, "  .intel_syntax noprefix\n");
+    Emitter_write(g->out, "  .text\n");
+
+    return g;
+}
+
+// Generates the function numbered `function_index` in the translation unit
+static void
+CodeGen_gen_function(CodeGen *g, FunctionDeclNode *p, int function_index) {
+    assert(g);
+    assert(p);
+
+    g->function_index = function_index;
+    g->next_label = 0;
+    Vec_resize(String)(g->list_of_string, 0);
+    Vec_resize(size_t)(g->list_of_length, 0);
+
+    CodeGen_gen_function_decl(g, p);
+}
+
+// Moves the string literals of the function generated last by `f` into the
+// constant pool of `g`
+static void CodeGen_pool_strings(CodeGen *g, const CodeGen *f) {
+    assert(g);
+    assert(f);
+
+    for (size_t i = 0; i < Vec_len(String)(f->list_of_string); i = i + 1) {
+        const char *string = Vec_get(String)(f->list_of_string, i);
+        size_t length = Vec_get(size_t)(f->list_of_length, i);
+
+        Vec_push(size_t)(g->pool_functions, f->function_index);
+        Vec_push(size_t)(g->pool_indices, i);
+        Vec_push(size_t)(
+            g->pool_entries, StringPool_add(g->pool, string, length));
+    }
+}
+
+void CodeGen_gen_decl(CodeGen *g, DeclNode *p) {
     assert(g);
     assert(p);
 
     if (p->kind == NodeKind_GlobalDecl) {
         CodeGen_gen_global_decl(g, GlobalDeclNode_cast(p));
     } else if (p->kind == NodeKind_FunctionDecl) {
-        CodeGen_gen_function_decl(g, FunctionDeclNode_cast(p));
+        CodeGen_gen_function(g, FunctionDeclNode_cast(p), g->num_functions);
+        CodeGen_pool_strings(g, g);
+        g->num_functions = g->num_functions + 1;
     } else {
         UNREACHABLE();
     }
 }
 
-static void CodeGen_gen_translation_unit(CodeGen *g, TranslationUnitNode *p) {
+// The string literals are referenced by the generated code, so they are
+// written after every declaration
+void CodeGen_finish(CodeGen *g) {
     assert(g);
+
+    CodeGen_gen_constant_pool(g);
+    Emitter_flush(g->out);
+}
+
+const char *CodeGen_output(const CodeGen *g, size_t *len) {
+    assert(g);
+    assert(len);
+
+    return Emitter_data(g->out, len);
+}
+
+void CodeGen_gen(TranslationUnitNode *p, FILE *fp) {
     assert(p);
+    assert(fp);
 
-    fprintf(g->fp, "  .intel_syntax noprefix\n");
-    fprintf(g->fp, "  .text\n");
+    CodeGen *g = CodeGen_new(fp);
 
     for (size_t i = 0; i < Vec_len(DeclNode)(p->declarations); i = i + 1) {
-        CodeGen_gen_top_level_decl(g, Vec_get(DeclNode)(p->declarations, i));
+        CodeGen_gen_decl(g, Vec_get(DeclNode)(p->declarations, i));
     }
 
-    CodeGen_gen_constant_pool(g);
+    CodeGen_finish(g);
+    CodeGen_delete(g);
 }
 
-void CodeGen_gen(TranslationUnitNode *p, FILE *fp) {
+#ifndef MOCC
+#include <pthread.h>
+
+// The output of one declaration, generated into memory
+typedef struct CodeGenJob {
+    DeclNode *decl;
+    int function_index;
+    CodeGen *g; // Writes to memory
+} CodeGenJob;
+
+typedef struct CodeGenQueue {
+    pthread_mutex_t mutex;
+    CodeGenJob *jobs;
+    size_t num_jobs;
+    size_t next;
+} CodeGenQueue;
+
+static void *CodeGen_worker(void *arg) {
+    CodeGenQueue *q = arg;
+
+    while (true) {
+        pthread_mutex_lock(&q->mutex);
+        size_t i = q->next;
+        if (i < q->num_jobs) {
+            q->next = i + 1;
+        }
+        pthread_mutex_unlock(&q->mutex);
+
+        if (i == q->num_jobs) {
+            return NULL;
+        }
+
+        CodeGenJob *job = &q->jobs[i];
+        if (job->decl->kind == NodeKind_FunctionDecl) {
+            job->g = CodeGen_alloc(NULL);
+            CodeGen_gen_function(
+                job->g, FunctionDeclNode_cast(job->decl), job->function_index);
+        }
+    }
+}
+
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs) {
+    assert(g);
     assert(p);
-    assert(fp);
+    assert(num_jobs >= 1);
+
+    size_t len = Vec_len(DeclNode)(p->declarations);
+    CodeGenQueue q;
+    pthread_mutex_init(&q.mutex, NULL);
+    q.jobs = malloc(sizeof(CodeGenJob) * (len + 1));
+    q.num_jobs = len;
+    q.next = 0;
+
+    // Global declarations give the symbols their addresses, so they are
+    // generated before any function
+    int num_functions = 0;
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        CodeGenJob *job = &q.jobs[i];
+        job->decl = Vec_get(DeclNode)(p->declarations, i);
+        job->function_index = -1;
+
+        if (job->decl->kind == NodeKind_GlobalDecl) {
+            job->g = CodeGen_alloc(NULL);
+            CodeGen_gen_global_decl(job->g, GlobalDeclNode_cast(job->decl));
+        } else {
+            FunctionDeclNode *function = FunctionDeclNode_cast(job->decl);
+            Symbol *symbol = DeclaratorNode_symbol(function->declarator);
+
+            CodeGen_declare_function(symbol);
+            job->function_index = g->num_functions + num_functions;
+            num_functions = num_functions + 1;
+        }
+    }
+
+    pthread_t *threads = malloc(sizeof(pthread_t) * (size_t)num_jobs);
+
+    for (int i = 0; i < num_jobs; i = i + 1) {
+        if (pthread_create(&threads[i], NULL, CodeGen_worker, &q) != 0) {
+            ERROR("cannot create a worker thread\n");
+        }
+    }
+
+    for (int i = 0; i < num_jobs; i = i + 1) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // Concatenate the outputs in the source order, as CodeGen_gen_decl()
+    // writes them
+    for (size_t i = 0; i < len; i = i + 1) {
+        CodeGenJob *job = &q.jobs[i];
+
+        Emitter_append(g->out, job->g->out);
+        CodeGen_pool_strings(g, job->g);
+
+        CodeGen_delete(job->g);
+    }
+
+    g->num_functions = g->num_functions + num_functions;
 
-    CodeGen g;
-    g.fp = fp;
-    g.next_label = 0;
-    g.return_label = -1;
-    g.list_of_string = Vec_new(String)();
-    g.list_of_length = Vec_new(size_t)();
-
-    g.registers_qword[0] = "rdi";
-    g.registers_qword[1] = "rsi";
-    g.registers_qword[2] = "rdx";
-    g.registers_qword[3] = "rcx";
-    g.registers_qword[4] = "r8";
-    g.registers_qword[5] = "r9";
-
-    g.registers_dword[0] = "edi";
-    g.registers_dword[1] = "esi";
-    g.registers_dword[2] = "edx";
-    g.registers_dword[3] = "ecx";
-    g.registers_dword[4] = "r8d";
-    g.registers_dword[5] = "r9d";
-
-    g.registers_byte[0] = "dil";
-    g.registers_byte[1] = "sil";
-    g.registers_byte[2] = "dl";
-    g.registers_byte[3] = "cl";
-    g.registers_byte[4] = "r8b";
-    g.registers_byte[5] = "r9b";
-
-    CodeGen_gen_translation_unit(&g, p);
+    free(threads);
+    free(q.jobs);
+    pthread_mutex_destroy(&q.mutex);
 }
+#else
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs) {
+    assert(g);
+    assert(p);
+
+    // Without threads, the functions are generated one after another
+    (void)num_jobs;
+
+    for (size_t i = 0; i < Vec_len(DeclNode)(p->declarations); i = i + 1) {
+        CodeGen_gen_decl(g, Vec_get(DeclNode)(p->declarations, i));
+    }
+}
+#endif
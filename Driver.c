@@ -0,0 +1,365 @@
+#include "mocc.h"
+
+static TokenSource *Driver_open(
+    Vec(String) * include_paths,
+    const PrecompiledHeader *pch,
+    const char *input) {
+    assert(include_paths);
+    assert(input);
+
+    size_t size;
+    const char *text = File_read_with_size(input, &size);
+    if (text == (const char *)NULL) {
+        ERROR("cannot open file %s\n", input);
+    }
+
+    if (TokenStream_is_binary(text, size)) {
+        // Already preprocessed
+        return TokenSource_from_vec(TokenStream_read(text, size));
+    }
+
+    Preprocessor *pp = Preprocessor_new(include_paths);
+    if (pch) {
+        PrecompiledHeader_define_macros(pch, pp);
+    }
+
+    // Tokens are preprocessed as the parser asks for them
+    Preprocessor_begin(pp, input, text);
+    return TokenSource_from_preprocessor(pp);
+}
+
+// Each compilation loads its own precompiled header, since the symbols
+// declared from it are modified by Sema and CodeGen
+static PrecompiledHeader *Driver_load_pch(const char *pch_path) {
+    if (!pch_path) {
+        return NULL;
+    }
+
+    return PrecompiledHeader_load(pch_path);
+}
+
+void Driver_preprocess(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    bool binary) {
+    assert(include_paths);
+    assert(input);
+    assert(output);
+
+    PrecompiledHeader *pch = Driver_load_pch(pch_path);
+    TokenSource *source = Driver_open(include_paths, pch, input);
+
+    if (binary) {
+        BinaryWriter *w = BinaryWriter_new();
+        TokenStream_write(w, TokenSource_read_all(source));
+
+        if (!BinaryWriter_save(w, output)) {
+            ERROR("cannot write file %s\n", output);
+        }
+
+        return;
+    }
+
+    FILE *fp = fopen(output, "w");
+    if (fp == (FILE *)NULL) {
+        ERROR("cannot open file %s\n", output);
+    }
+
+    TokenStream_print(TokenSource_read_all(source), fp);
+    fclose(fp);
+}
+
+// Parses the next declaration, or returns NULL at the end
+static DeclNode *Driver_parse_next_decl(Parser *p) {
+    assert(p);
+
+    TimeReport_begin(TimeReportPhase_parse);
+    DeclNode *decl = Parser_parse_next_decl(p);
+    TimeReport_end(TimeReportPhase_parse);
+
+    return decl;
+}
+
+// Generates the code of `input` into `fp`, or into memory if it is NULL
+static CodeGen *Driver_generate(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    FILE *fp,
+    int num_jobs) {
+    assert(include_paths);
+    assert(input);
+
+    TimeReport_begin(TimeReportPhase_preprocess);
+
+    PrecompiledHeader *pch = Driver_load_pch(pch_path);
+    TokenSource *source = Driver_open(include_paths, pch, input);
+
+    if (TimeReport_is_enabled()) {
+        // Preprocessed ahead, so that it is timed apart from parsing
+        source = TokenSource_from_vec(TokenSource_read_all(source));
+    }
+
+    TimeReport_end(TimeReportPhase_preprocess);
+    TimeReport_begin(TimeReportPhase_parse);
+
+    Parser *p = Parser_new_from_source(source);
+
+    if (pch) {
+        PrecompiledHeader_declare_symbols(pch, Parser_sema(p));
+    }
+
+    TimeReport_end(TimeReportPhase_parse);
+
+    CodeGen *g = CodeGen_new(fp);
+
+    if (num_jobs > 1) {
+        // The whole tree is kept until its functions are generated
+        TimeReport_begin(TimeReportPhase_parse);
+        TranslationUnitNode *tu = Parser_parse(p);
+        TimeReport_end(TimeReportPhase_parse);
+
+        TimeReport_begin(TimeReportPhase_codegen);
+        CodeGen_gen_parallel(g, tu, num_jobs);
+        TimeReport_end(TimeReportPhase_codegen);
+    } else {
+        // Each function is generated as soon as it is parsed, and then its
+        // body is released
+        DeclNode *decl = Driver_parse_next_decl(p);
+
+        while (decl) {
+            TimeReport_begin(TimeReportPhase_codegen);
+            CodeGen_gen_decl(g, decl);
+            TimeReport_end(TimeReportPhase_codegen);
+
+            if (decl->kind == NodeKind_FunctionDecl) {
+                Parser_release_function_decl(p, FunctionDeclNode_cast(decl));
+            }
+
+            decl = Driver_parse_next_decl(p);
+        }
+    }
+
+    TimeReport_begin(TimeReportPhase_codegen);
+    CodeGen_finish(g);
+    TimeReport_end(TimeReportPhase_codegen);
+
+    // The rest of the tree is no longer referenced
+    Node_release_arena();
+
+    return g;
+}
+
+void Driver_compile(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    int num_jobs,
+    bool object) {
+    assert(include_paths);
+    assert(input);
+    assert(output);
+
+    // An object is assembled from the text kept in memory
+    FILE *fp = NULL;
+    if (!object) {
+        fp = fopen(output, "w");
+        if (fp == (FILE *)NULL) {
+            ERROR("cannot open file %s\n", output);
+        }
+    }
+
+    CodeGen *g = Driver_generate(include_paths, pch_path, input, fp, num_jobs);
+
+    if (object) {
+        size_t len;
+        const char *text = CodeGen_output(g, &len);
+
+        TimeReport_begin(TimeReportPhase_assemble);
+        Assembler_assemble(text, len, output);
+        TimeReport_end(TimeReportPhase_assemble);
+    } else {
+        fclose(fp);
+    }
+
+    CodeGen_delete(g);
+}
+
+int Driver_run(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    int num_jobs,
+    int argc,
+    char **argv) {
+    assert(include_paths);
+    assert(input);
+    assert(argv);
+
+    CodeGen *g =
+        Driver_generate(include_paths, pch_path, input, NULL, num_jobs);
+
+    size_t len;
+    const char *text = CodeGen_output(g, &len);
+    int status = Assembler_run(text, len, argc, argv);
+
+    CodeGen_delete(g);
+    return status;
+}
+
+#ifndef MOCC
+#include <pthread.h>
+
+// Inputs are handed out to the workers in order, one at a time
+typedef struct DriverQueue {
+    pthread_mutex_t mutex;
+    Vec(String) * include_paths;
+    const char *pch_path;
+    Vec(String) * inputs;
+    Vec(String) * outputs;
+    bool object;
+    size_t next;
+} DriverQueue;
+
+static void *Driver_worker(void *arg) {
+    DriverQueue *q = arg;
+    size_t len = Vec_len(String)(q->inputs);
+
+    while (true) {
+        pthread_mutex_lock(&q->mutex);
+        size_t i = q->next;
+        if (i < len) {
+            q->next = i + 1;
+        }
+        pthread_mutex_unlock(&q->mutex);
+
+        if (i == len) {
+            return NULL;
+        }
+
+        Driver_compile(
+            q->include_paths,
+            q->pch_path,
+            Vec_get(String)(q->inputs, i),
+            Vec_get(String)(q->outputs, i),
+            1,
+            q->object);
+    }
+}
+
+static void Driver_compile_parallel(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    Vec(String) * inputs,
+    Vec(String) * outputs,
+    int num_jobs,
+    bool object) {
+    DriverQueue q;
+    pthread_mutex_init(&q.mutex, NULL);
+    q.include_paths = include_paths;
+    q.pch_path = pch_path;
+    q.inputs = inputs;
+    q.outputs = outputs;
+    q.object = object;
+    q.next = 0;
+
+    // The tables built on first use are shared; build them before the
+    // workers start
+    Scan_level();
+    Lexer_init_tables();
+
+    pthread_t *threads = malloc(sizeof(pthread_t) * (size_t)num_jobs);
+
+    for (int i = 0; i < num_jobs; i = i + 1) {
+        if (pthread_create(&threads[i], NULL, Driver_worker, &q) != 0) {
+            ERROR("cannot create a worker thread\n");
+        }
+    }
+
+    for (int i = 0; i < num_jobs; i = i + 1) {
+        pthread_join(threads[i], NULL);
+    }
+
+    free(threads);
+    pthread_mutex_destroy(&q.mutex);
+}
+#endif
+
+void Driver_compile_all(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    Vec(String) * inputs,
+    const char *output_dir,
+    int num_jobs,
+    bool object) {
+    assert(include_paths);
+    assert(inputs);
+    assert(output_dir);
+
+    size_t len = Vec_len(String)(inputs);
+    Vec(String) *outputs = Vec_new(String)();
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        char *base = Path_base(Vec_get(String)(inputs, i));
+        char *name = malloc(sizeof(char) * (strlen(base) + 3));
+
+        strcpy(name, base);
+        if (object) {
+            strcat(name, ".o");
+        } else {
+            strcat(name, ".s");
+        }
+
+        Vec_push(String)(outputs, Path_join(output_dir, name));
+
+        free(base);
+        free(name);
+    }
+
+    // Outputs are named after the base name of the input; two inputs with
+    // the same base name would overwrite each other's output
+    Map(String) *written = Map_new(String)();
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        const char *output = Intern_string(Vec_get(String)(outputs, i));
+        const char *input = Map_find(String)(written, output);
+
+        if (input) {
+            ERROR(
+                "%s and %s would both be written to %s\n",
+                input,
+                Vec_get(String)(inputs, i),
+                output);
+        }
+
+        Map_insert(String)(written, output, Vec_get(String)(inputs, i));
+    }
+
+#ifndef MOCC
+    if ((size_t)num_jobs > len) {
+        num_jobs = (int)len;
+    }
+
+    if (num_jobs > 1) {
+        Driver_compile_parallel(
+            include_paths, pch_path, inputs, outputs, num_jobs, object);
+        return;
+    }
+#else
+    // Without threads, the files are compiled one after another
+    (void)num_jobs;
+#endif
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        Driver_compile(
+            include_paths,
+            pch_path,
+            Vec_get(String)(inputs, i),
+            Vec_get(String)(outputs, i),
+            1,
+            object);
+    }
+}
@@ -0,0 +1,161 @@
+#include "mocc.h"
+
+// Output is written out once this much is buffered
+#define EMITTER_FLUSH_SIZE 1048576
+
+struct Emitter {
+    FILE *fp; // NULL to keep the output in memory
+    char *data;
+    size_t len;
+    size_t cap;
+};
+
+Emitter *Emitter_new(FILE *fp) {
+    Emitter *e = malloc(sizeof(Emitter));
+    e->fp = fp;
+    e->len = 0;
+    e->cap = 4096;
+    e->data = malloc(sizeof(char) * e->cap);
+
+    return e;
+}
+
+void Emitter_delete(Emitter *e) {
+    assert(e);
+
+    free(e->data);
+    free(e);
+}
+
+void Emitter_flush(Emitter *e) {
+    assert(e);
+
+    if (!e->fp || e->len == 0) {
+        return;
+    }
+
+    if (fwrite(e->data, 1, e->len, e->fp) != e->len) {
+        ERROR("cannot write the output\n");
+    }
+
+    e->len = 0;
+}
+
+static char *Emitter_reserve(Emitter *e, size_t len) {
+    assert(e);
+
+    if (e->fp && e->len + len > EMITTER_FLUSH_SIZE) {
+        Emitter_flush(e);
+    }
+
+    if (e->len + len > e->cap) {
+        while (e->len + len > e->cap) {
+            e->cap = e->cap * 2;
+        }
+
+        e->data = realloc(e->data, sizeof(char) * e->cap);
+        TimeReport_allocate(sizeof(char) * e->cap);
+    }
+
+    char *p = &e->data[e->len];
+    e->len = e->len + len;
+
+    return p;
+}
+
+void Emitter_write_bytes(Emitter *e, const char *s, size_t len) {
+    assert(e);
+    assert(s);
+
+    memcpy(Emitter_reserve(e, len), s, len);
+}
+
+void Emitter_write(Emitter *e, const char *s) {
+    assert(e);
+    assert(s);
+
+    Emitter_write_bytes(e, s, strlen(s));
+}
+
+void Emitter_write_char(Emitter *e, char c) {
+    assert(e);
+
+    char *p = Emitter_reserve(e, 1);
+    p[0] = c;
+}
+
+void Emitter_write_size(Emitter *e, size_t x) {
+    assert(e);
+
+    // Digits are produced from the least significant one
+    char digits[24];
+    size_t n = 0;
+
+    digits[0] = '0';
+    if (x == 0) {
+        n = 1;
+    }
+
+    while (x != 0) {
+        digits[n] = '0' + x % 10;
+        x = x / 10;
+        n = n + 1;
+    }
+
+    char *p = Emitter_reserve(e, n);
+    for (size_t i = 0; i < n; i = i + 1) {
+        p[i] = digits[n - 1 - i];
+    }
+}
+
+void Emitter_write_int(Emitter *e, int x) {
+    assert(e);
+
+    if ((x & (-2147483647 - 1)) != 0) {
+        // -x does not fit in an int for INT_MIN, so the magnitude is widened
+        Emitter_write_char(e, '-');
+        Emitter_write_size(e, (size_t)(-(x + 1)) + 1);
+        return;
+    }
+
+    Emitter_write_size(e, x);
+}
+
+void Emitter_write_signed_int(Emitter *e, int x) {
+    assert(e);
+
+    if ((x & (-2147483647 - 1)) == 0) {
+        Emitter_write_char(e, '+');
+    }
+
+    Emitter_write_int(e, x);
+}
+
+void Emitter_write_hex_byte(Emitter *e, int x) {
+    assert(e);
+
+    const char *hex_digits = "0123456789abcdef";
+    char *p = Emitter_reserve(e, 4);
+
+    p[0] = '0';
+    p[1] = 'x';
+    p[2] = hex_digits[(x & 240) / 16];
+    p[3] = hex_digits[x & 15];
+}
+
+const char *Emitter_data(const Emitter *e, size_t *len) {
+    assert(e);
+    assert(!e->fp);
+    assert(len);
+
+    *len = e->len;
+    return e->data;
+}
+
+void Emitter_append(Emitter *e, const Emitter *other) {
+    assert(e);
+    assert(other);
+    assert(!other->fp);
+
+    Emitter_write_bytes(e, other->data, other->len);
+}
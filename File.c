@@ -1,7 +1,102 @@
 #include "mocc.h"
 
-char *File_read(const char *path) {
+#ifndef MOCC
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Files at least this large are mapped instead of read into a buffer
+#define FILE_MAP_THRESHOLD 65536
+
+// Maps `size` bytes of `fd` read-only, followed by at least one zero byte.
+static const char *File_map(int fd, size_t size) {
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    if (size % page_size != 0) {
+        // The rest of the last page is filled with zeros
+        void *p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            return NULL;
+        }
+
+        return p;
+    }
+
+    // Reserve an extra zero page for the sentinel, then map the file over the
+    // pages in front of it
+    char *p = mmap(
+        NULL,
+        size + page_size,
+        PROT_READ,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+
+    if (mmap(p, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+        MAP_FAILED) {
+        munmap(p, size + page_size);
+        return NULL;
+    }
+
+    return p;
+}
+
+static const char *File_read_buffered(int fd, size_t size) {
+    char *s = malloc(sizeof(char) * (size + 1));
+    TimeReport_allocate(sizeof(char) * (size + 1));
+
+    size_t len = 0;
+    while (len < size) {
+        ssize_t n = read(fd, &s[len], size - len);
+        if (n <= 0) {
+            free(s);
+            return NULL;
+        }
+
+        len = len + (size_t)n;
+    }
+
+    s[size] = '\0';
+    return s;
+}
+
+static const char *File_read_contents(const char *path, size_t *size_out) {
+    assert(path);
+    assert(size_out);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t)st.st_size;
+    const char *s;
+
+    if (size >= FILE_MAP_THRESHOLD) {
+        s = File_map(fd, size);
+    } else {
+        s = File_read_buffered(fd, size);
+    }
+
+    close(fd);
+
+    *size_out = size;
+    return s;
+}
+#else
+static const char *File_read_contents(const char *path, size_t *size_out) {
     assert(path);
+    assert(size_out);
 
     FILE *fp = fopen(path, "rb");
     if (fp == (FILE *)NULL) {
@@ -19,6 +114,7 @@ char *File_read(const char *path) {
 
     size_t size = (size_t)ssize;
     char *s = malloc(sizeof(char) * (size + 1));
+    TimeReport_allocate(sizeof(char) * (size + 1));
     if (fread(s, 1, size, fp) != size) {
         fclose(fp);
         return NULL;
@@ -27,5 +123,26 @@ char *File_read(const char *path) {
     s[size] = '\0';
 
     fclose(fp);
+
+    *size_out = size;
+    return s;
+}
+#endif
+
+const char *File_read_with_size(const char *path, size_t *size_out) {
+    assert(path);
+    assert(size_out);
+
+    TimeReport_begin(TimeReportPhase_read);
+    const char *s = File_read_contents(path, size_out);
+    TimeReport_end(TimeReportPhase_read);
+
     return s;
 }
+
+const char *File_read(const char *path) {
+    assert(path);
+
+    size_t size;
+    return File_read_with_size(path, &size);
+}
@@ -0,0 +1,188 @@
+#include "mocc.h"
+
+// A hidden set is an immutable list of interned macro names, sorted by
+// their hash (then by spelling), where NULL is the empty set. Sets are
+// hash-consed: every (name, rest) pair is created only once per table, so
+// equal sets are the same pointer and tokens can share a set freely.
+//
+// The table finds an existing node by hashing (name, rest) into an open
+// addressing table, so adding a name costs the same however many sets exist.
+
+#define HIDDEN_SET_MASK_BITS 30
+#define HIDDEN_SET_TABLE_INITIAL_CAP 64
+
+struct HiddenSet {
+    const char *name;
+    HiddenSet *rest;
+    size_t mask; // One bit per name, to reject most lookups at once
+    size_t id;   // Hashed in place of the address of the set
+};
+
+struct HiddenSetTable {
+    Arena *arena;
+    HiddenSet **slots; // Indexed by the hash of (name, rest); a power of 2
+    size_t cap;
+    size_t len;
+};
+
+static HiddenSet **HiddenSetTable_new_slots(size_t cap) {
+    HiddenSet **slots = malloc(sizeof(HiddenSet *) * cap);
+    TimeReport_allocate(sizeof(HiddenSet *) * cap);
+
+    for (size_t i = 0; i < cap; i = i + 1) {
+        slots[i] = NULL;
+    }
+
+    return slots;
+}
+
+HiddenSetTable *HiddenSetTable_new(void) {
+    HiddenSetTable *t = malloc(sizeof(HiddenSetTable));
+    t->arena = Arena_new();
+    t->slots = HiddenSetTable_new_slots(HIDDEN_SET_TABLE_INITIAL_CAP);
+    t->cap = HIDDEN_SET_TABLE_INITIAL_CAP;
+    t->len = 0;
+
+    return t;
+}
+
+static size_t HiddenSet_hash(const char *name, const HiddenSet *rest) {
+    assert(name);
+
+    size_t hash = Intern_hash(name);
+    if (rest) {
+        hash = hash * 31 + rest->id;
+    }
+
+    return hash;
+}
+
+static void HiddenSetTable_grow(HiddenSetTable *t) {
+    assert(t);
+
+    size_t cap = t->cap * 2;
+    HiddenSet **slots = HiddenSetTable_new_slots(cap);
+
+    for (size_t i = 0; i < t->cap; i = i + 1) {
+        HiddenSet *s = t->slots[i];
+        if (s) {
+            size_t j = HiddenSet_hash(s->name, s->rest) & (cap - 1);
+            while (slots[j]) {
+                j = (j + 1) & (cap - 1);
+            }
+
+            slots[j] = s;
+        }
+    }
+
+    free(t->slots);
+    t->slots = slots;
+    t->cap = cap;
+}
+
+static size_t HiddenSet_bit(const char *name) {
+    assert(name);
+
+    size_t bit = 1;
+    size_t n = Intern_hash(name) % HIDDEN_SET_MASK_BITS;
+    for (size_t i = 0; i < n; i = i + 1) {
+        bit = bit * 2;
+    }
+
+    return bit;
+}
+
+static bool HiddenSet_precedes(const char *a, const char *b) {
+    assert(a);
+    assert(b);
+
+    if (Intern_hash(a) != Intern_hash(b)) {
+        return Intern_hash(a) < Intern_hash(b);
+    }
+
+    return strcmp(a, b) < 0;
+}
+
+// Returns the unique set {name} + rest
+static HiddenSet *
+HiddenSet_cons(HiddenSetTable *t, const char *name, HiddenSet *rest) {
+    assert(t);
+    assert(name);
+
+    size_t i = HiddenSet_hash(name, rest) & (t->cap - 1);
+    while (t->slots[i]) {
+        HiddenSet *s = t->slots[i];
+        if (s->name == name && s->rest == rest) {
+            return s;
+        }
+
+        i = (i + 1) & (t->cap - 1);
+    }
+
+    HiddenSet *s = Arena_alloc(t->arena, sizeof(HiddenSet));
+    s->name = name;
+    s->rest = rest;
+    s->mask = HiddenSet_bit(name);
+    s->id = t->len + 1;
+
+    if (rest && (rest->mask & s->mask) == 0) {
+        s->mask = rest->mask + s->mask;
+    } else if (rest) {
+        s->mask = rest->mask;
+    }
+
+    t->slots[i] = s;
+    t->len = t->len + 1;
+
+    // Keep the table at most half full
+    if (t->len * 2 > t->cap) {
+        HiddenSetTable_grow(t);
+    }
+
+    return s;
+}
+
+HiddenSet *HiddenSet_add(HiddenSetTable *t, HiddenSet *set, const char *name) {
+    assert(t);
+    assert(name);
+    assert(Intern_string(name) == name);
+
+    if (!set || HiddenSet_precedes(name, set->name)) {
+        return HiddenSet_cons(t, name, set);
+    }
+
+    if (set->name == name) {
+        return set;
+    }
+
+    return HiddenSet_cons(t, set->name, HiddenSet_add(t, set->rest, name));
+}
+
+bool HiddenSet_contains(const HiddenSet *set, const char *name) {
+    assert(name);
+    assert(Intern_string(name) == name);
+
+    if (!set || (set->mask & HiddenSet_bit(name)) == 0) {
+        return false;
+    }
+
+    while (set) {
+        if (set->name == name) {
+            return true;
+        }
+
+        set = set->rest;
+    }
+
+    return false;
+}
+
+size_t HiddenSet_len(const HiddenSet *set) {
+    size_t len = 0;
+    while (set) {
+        len = len + 1;
+        set = set->rest;
+    }
+
+    return len;
+}
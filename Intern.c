@@ -0,0 +1,161 @@
+#include "mocc.h"
+
+// Interned strings are stored in an arena, each prefixed by a header that
+// holds its hash and length:
+//
+//   [size_t hash][size_t length][char text[length]]['\0']
+//
+// The returned pointer points to `text`, so an interned string is still an
+// ordinary NUL-terminated C string, while Intern_hash() and Intern_length()
+// are O(1).
+
+#define INTERN_INITIAL_CAPACITY 1024
+#define INTERN_HASH_MASK 16777215
+
+typedef struct InternTable {
+    Arena *arena;
+    const char **slots;
+    size_t capacity;
+    size_t len;
+} InternTable;
+
+static InternTable *Intern_table;
+
+// The table is shared by the worker threads. Interned strings are never
+// moved, so only the insertion needs the lock.
+#ifndef MOCC
+#include <pthread.h>
+
+static pthread_mutex_t Intern_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+#define INTERN_LOCK() pthread_mutex_lock(&Intern_mutex)
+#define INTERN_UNLOCK() pthread_mutex_unlock(&Intern_mutex)
+#else
+#define INTERN_LOCK() ((void)0)
+#define INTERN_UNLOCK() ((void)0)
+#endif
+
+static size_t Intern_compute_hash(const char *s, size_t len) {
+    assert(s);
+
+    // Keep the hash below 2^24 so that it never overflows, and so that it is
+    // the same whatever the width of size_t is.
+    size_t h = 0;
+    for (size_t i = 0; i < len; i = i + 1) {
+        h = (h * 31 + (s[i] & 255)) & INTERN_HASH_MASK;
+    }
+
+    return h;
+}
+
+static const char **Intern_new_slots(size_t capacity) {
+    const char **slots = malloc(sizeof(const char *) * capacity);
+    TimeReport_allocate(sizeof(const char *) * capacity);
+    for (size_t i = 0; i < capacity; i = i + 1) {
+        slots[i] = NULL;
+    }
+
+    return slots;
+}
+
+static InternTable *Intern_get_table(void) {
+    if (!Intern_table) {
+        Intern_table = malloc(sizeof(InternTable));
+        Intern_table->arena = Arena_new();
+        Intern_table->slots = Intern_new_slots(INTERN_INITIAL_CAPACITY);
+        Intern_table->capacity = INTERN_INITIAL_CAPACITY;
+        Intern_table->len = 0;
+    }
+
+    return Intern_table;
+}
+
+static void Intern_grow(InternTable *t) {
+    assert(t);
+
+    size_t capacity = t->capacity * 2;
+    const char **slots = Intern_new_slots(capacity);
+
+    for (size_t i = 0; i < t->capacity; i = i + 1) {
+        const char *s = t->slots[i];
+
+        if (s) {
+            size_t index = Intern_hash(s) & (capacity - 1);
+            while (slots[index]) {
+                index = (index + 1) & (capacity - 1);
+            }
+
+            slots[index] = s;
+        }
+    }
+
+    free(t->slots);
+    t->slots = slots;
+    t->capacity = capacity;
+}
+
+static const char *Intern_insert(InternTable *t, const char *s, size_t len) {
+    assert(t);
+    assert(s);
+
+    size_t hash = Intern_compute_hash(s, len);
+    size_t index = hash & (t->capacity - 1);
+
+    while (t->slots[index]) {
+        const char *x = t->slots[index];
+
+        if (Intern_hash(x) == hash && Intern_length(x) == len &&
+            memcmp(x, s, len) == 0) {
+            return x;
+        }
+
+        index = (index + 1) & (t->capacity - 1);
+    }
+
+    size_t *header =
+        Arena_alloc(t->arena, sizeof(size_t) * 2 + sizeof(char) * (len + 1));
+    header[0] = hash;
+    header[1] = len;
+
+    char *text = (char *)&header[2];
+    memcpy(text, s, len);
+    text[len] = '\0';
+
+    t->slots[index] = text;
+    t->len = t->len + 1;
+
+    // Keep the load factor at most 1/2
+    if (t->len * 2 > t->capacity) {
+        Intern_grow(t);
+    }
+
+    return text;
+}
+
+const char *Intern_string(const char *s) {
+    assert(s);
+
+    return Intern_substring(s, strlen(s));
+}
+
+const char *Intern_substring(const char *s, size_t len) {
+    assert(s);
+
+    INTERN_LOCK();
+    const char *interned = Intern_insert(Intern_get_table(), s, len);
+    INTERN_UNLOCK();
+
+    return interned;
+}
+
+size_t Intern_hash(const char *interned) {
+    assert(interned);
+
+    return ((const size_t *)interned)[-2];
+}
+
+size_t Intern_length(const char *interned) {
+    assert(interned);
+
+    return ((const size_t *)interned)[-1];
+}
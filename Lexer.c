@@ -1,12 +1,147 @@
 #include "mocc.h"
 
+#define LEXER_NUM_CHARS 256
+
+// Classes of the first character of a token
+typedef enum CharClass {
+    CharClass_punctuator, // Anything else
+    CharClass_nul,
+    CharClass_newline,
+    CharClass_space,
+    CharClass_digit,
+    CharClass_identifier,
+    CharClass_quote,
+    CharClass_double_quote,
+} CharClass;
+
+// Tables generated from Token.def, shared by every lexer.
+//
+// Punctuators are read by a DFA whose states are the prefixes of the
+// TOKEN_DELIM entries. Any other character is a punctuator by itself.
+typedef struct LexerTables {
+    CharClass *char_classes; // Indexed by (c & 255)
+
+    // State 0 is the start state. A transition to 0 means there is none.
+    size_t *transitions; // Indexed by state * LEXER_NUM_CHARS + (c & 255)
+    TokenKind *accepts;  // Kind of the punctuator ending at a state, or 0
+    size_t num_states;
+} LexerTables;
+
+static LexerTables *Lexer_tables;
+
 struct Lexer {
     const char *filename;
     const char *text;
     size_t cursor;
     bool is_bol;
+    const LexerTables *tables;
 };
 
+static size_t LexerTables_add_state(LexerTables *t, TokenKind accept) {
+    assert(t);
+
+    size_t state = t->num_states;
+
+    t->num_states = t->num_states + 1;
+    t->transitions = realloc(
+        t->transitions, sizeof(size_t) * LEXER_NUM_CHARS * t->num_states);
+    t->accepts = realloc(t->accepts, sizeof(TokenKind) * t->num_states);
+
+    for (size_t c = 0; c < LEXER_NUM_CHARS; c = c + 1) {
+        t->transitions[state * LEXER_NUM_CHARS + c] = 0;
+    }
+    t->accepts[state] = accept;
+
+    return state;
+}
+
+static void
+LexerTables_add_punctuator(LexerTables *t, const char *text, TokenKind kind) {
+    assert(t);
+    assert(text);
+    assert(text[0] != '\0');
+
+    size_t state = 0;
+
+    for (size_t i = 0; text[i] != '\0'; i = i + 1) {
+        size_t c = text[i] & 255;
+        size_t next = t->transitions[state * LEXER_NUM_CHARS + c];
+
+        if (next == 0) {
+            // A single character is a punctuator by itself
+            TokenKind accept = 0;
+            if (i == 0) {
+                accept = text[i];
+            }
+
+            next = LexerTables_add_state(t, accept);
+            t->transitions[state * LEXER_NUM_CHARS + c] = next;
+        }
+
+        state = next;
+    }
+
+    t->accepts[state] = kind;
+}
+
+static void LexerTables_set_class(
+    LexerTables *t, const char *chars, CharClass char_class) {
+    assert(t);
+    assert(chars);
+
+    for (size_t i = 0; chars[i] != '\0'; i = i + 1) {
+        t->char_classes[chars[i] & 255] = char_class;
+    }
+}
+
+static const LexerTables *Lexer_get_tables(void) {
+    if (Lexer_tables) {
+        return Lexer_tables;
+    }
+
+    LexerTables *t = malloc(sizeof(LexerTables));
+    t->char_classes = malloc(sizeof(CharClass) * LEXER_NUM_CHARS);
+    t->transitions = NULL;
+    t->accepts = NULL;
+    t->num_states = 0;
+
+    for (size_t c = 0; c < LEXER_NUM_CHARS; c = c + 1) {
+        t->char_classes[c] = CharClass_punctuator;
+    }
+
+    t->char_classes[0] = CharClass_nul;
+    t->char_classes['\n'] = CharClass_newline;
+    t->char_classes[' '] = CharClass_space;
+    for (size_t c = 9; c <= 13; c = c + 1) {
+        if (c != '\n') {
+            t->char_classes[c] = CharClass_space;
+        }
+    }
+
+    LexerTables_set_class(t, "0123456789", CharClass_digit);
+    LexerTables_set_class(
+        t, "abcdefghijklmnopqrstuvwxyz", CharClass_identifier);
+    LexerTables_set_class(
+        t, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", CharClass_identifier);
+    LexerTables_set_class(t, "_", CharClass_identifier);
+    t->char_classes['\''] = CharClass_quote;
+    t->char_classes['\"'] = CharClass_double_quote;
+
+    // The start state
+    LexerTables_add_state(t, 0);
+
+#define TOKEN_DELIM(name, text)                                                \
+    LexerTables_add_punctuator(t, text, TokenKind_##name);
+#include "Token.def"
+
+    Lexer_tables = t;
+    return t;
+}
+
+void Lexer_init_tables(void) {
+    Lexer_get_tables();
+}
+
 Lexer *Lexer_new(const char *filename, const char *text) {
     assert(filename);
     assert(text);
@@ -16,6 +151,7 @@ Lexer *Lexer_new(const char *filename, const char *text) {
     l->text = text;
     l->cursor = 0;
     l->is_bol = true;
+    l->tables = Lexer_get_tables();
 
     return l;
 }
@@ -34,7 +170,7 @@ static char Lexer_consume(Lexer *l) {
     return l->text[l->cursor - 1];
 }
 
-static char Lexer_read_char(Lexer *l, char *buffer, size_t *len) {
+static char Lexer_read_char(Lexer *l) {
     assert(l);
 
     if (Lexer_current(l) == '\0' || Lexer_current(l) == '\n') {
@@ -43,11 +179,9 @@ static char Lexer_read_char(Lexer *l, char *buffer, size_t *len) {
 
     if (Lexer_current(l) == '\\') {
         // '\\'
-        buffer[*len] = Lexer_consume(l);
-        *len = *len + 1;
+        Lexer_consume(l);
 
-        char c = buffer[*len] = Lexer_consume(l);
-        *len = *len + 1;
+        char c = Lexer_consume(l);
         if (c == '0') {
             return '\0';
         } else if (c == 'n') {
@@ -63,218 +197,199 @@ static char Lexer_read_char(Lexer *l, char *buffer, size_t *len) {
         }
     } else {
         // .
-        char c = Lexer_consume(l);
-        buffer[*len] = c;
-        *len = *len + 1;
-        return c;
+        return Lexer_consume(l);
+    }
+}
+
+// Reads the contents of a character or string literal up to (but not
+// including) the closing quote. The contents are returned as a view into the
+// source text, and copied only when they contain escape sequences.
+static const char *Lexer_read_literal(Lexer *l, char quote, int *len) {
+    assert(l);
+    assert(len);
+
+    size_t begin = l->cursor;
+    bool has_escapes = false;
+
+    *len = 0;
+    while (Lexer_current(l) != quote) {
+        // Skip the plain characters at once
+        size_t n = Scan_literal(&l->text[l->cursor], quote);
+
+        if (n > 0) {
+            l->cursor = l->cursor + n;
+            *len = *len + n;
+        } else {
+            if (Lexer_current(l) == '\\') {
+                has_escapes = true;
+            }
+
+            Lexer_read_char(l);
+            *len = *len + 1;
+        }
+    }
+
+    if (!has_escapes) {
+        return &l->text[begin];
+    }
+
+    // Decode the escape sequences
+    char *s = malloc(sizeof(char) * (*len + 1));
+    TimeReport_allocate(sizeof(char) * (*len + 1));
+
+    l->cursor = begin;
+    for (int i = 0; i < *len; i = i + 1) {
+        s[i] = Lexer_read_char(l);
+    }
+    s[*len] = '\0';
+
+    return s;
+}
+
+// Follows the punctuator DFA as far as it goes, then backs up to the end of
+// the longest punctuator
+static void Lexer_read_punctuator(Lexer *l, Token *t) {
+    assert(l);
+    assert(t);
+
+    const LexerTables *tables = l->tables;
+    size_t state = tables->transitions[Lexer_current(l) & 255];
+
+    t->kind = Lexer_consume(l);
+    size_t end = l->cursor;
+
+    while (state != 0) {
+        if (tables->accepts[state] != 0) {
+            t->kind = tables->accepts[state];
+            end = l->cursor;
+        }
+
+        state = tables->transitions
+                    [state * LEXER_NUM_CHARS + (Lexer_current(l) & 255)];
+        if (state != 0) {
+            Lexer_consume(l);
+        }
     }
+
+    l->cursor = end;
 }
 
 Token *Lexer_read(Lexer *l) {
     assert(l);
 
     Token *t = malloc(sizeof(Token));
+    TimeReport_allocate(sizeof(Token));
     t->kind = -1;
     t->text = NULL;
+    t->source = l->text;
+    t->offset = 0;
+    t->length = 0;
     t->string = NULL;
     t->string_len = 0;
     t->is_bol = false;
     t->has_spaces = false;
-    t->hidden_set = Vec_new(String)();
-
-    char buffer[1024]; // TODO: Dynamic buffer
-    char str[1024];    // TODO: Dynamic buffer
-    size_t len = 0;
+    t->hidden_set = NULL;
 
     bool ended = false;
     while (!ended) {
         const char c = Lexer_current(l);
+        CharClass char_class = l->tables->char_classes[c & 255];
+        t->offset = l->cursor;
 
-        if (c == '\0') {
+        if (char_class == CharClass_nul) {
             l->is_bol = true;
             t->kind = '\0';
             ended = true;
-        } else if (c == '\n') {
+        } else if (char_class == CharClass_newline) {
             // \s
             Lexer_consume(l);
 
             l->is_bol = true;
             t->has_spaces = true;
-        } else if (isspace(c)) {
-            // \s
+        } else if (char_class == CharClass_space) {
+            // \s (but \n)
             Lexer_consume(l);
+            l->cursor = l->cursor + Scan_spaces(&l->text[l->cursor]);
 
             t->has_spaces = true;
-        } else if (c == '\'') {
+        } else if (char_class == CharClass_quote) {
             // '\''
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
+            Lexer_consume(l);
 
-            while (Lexer_current(l) != '\'') {
-                str[t->string_len] = Lexer_read_char(l, buffer, &len);
-                t->string_len = t->string_len + 1;
-            }
+            t->kind = TokenKind_character;
+            t->string = Lexer_read_literal(l, '\'', &t->string_len);
 
             // '\''
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            t->kind = TokenKind_character;
-            t->string = strndup(str, t->string_len);
+            Lexer_consume(l);
             ended = true;
-        } else if (c == '\"') {
+        } else if (char_class == CharClass_double_quote) {
             // '\"'
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
+            Lexer_consume(l);
 
-            while (Lexer_current(l) != '\"') {
-                str[t->string_len] = Lexer_read_char(l, buffer, &len);
-                t->string_len = t->string_len + 1;
-            }
+            t->kind = TokenKind_string;
+            t->string = Lexer_read_literal(l, '\"', &t->string_len);
 
             // '\"'
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            str[t->string_len] = '\0';
-            t->string_len = t->string_len + 1;
-
-            t->kind = TokenKind_string;
-            t->string = strndup(str, t->string_len);
+            Lexer_consume(l);
             ended = true;
-        } else if (isdigit(c)) {
+        } else if (char_class == CharClass_digit) {
             // [0-9]*
-            while (isdigit(Lexer_current(l))) {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-            }
+            l->cursor = l->cursor + Scan_digits(&l->text[l->cursor]);
 
             t->kind = TokenKind_number;
             ended = true;
-        } else if (isalpha(c) || c == '_') {
-            // [0-9A-Za-z]*
-            while (isalnum(Lexer_current(l)) || Lexer_current(l) == '_') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-            }
+        } else if (char_class == CharClass_identifier) {
+            // [0-9A-Za-z_]*
+            l->cursor = l->cursor + Scan_identifier(&l->text[l->cursor]);
 
             t->kind = TokenKind_identifier;
             ended = true;
-        } else if (c == '-') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '>') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_arrow;
-            } else {
-                t->kind = '-';
-            }
-            ended = true;
-        } else if (c == '<') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '=') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_lesser_equal;
-            } else {
-                t->kind = '<';
-            }
-            ended = true;
-        } else if (c == '>') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '=') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_greater_equal;
-            } else {
-                t->kind = '>';
-            }
-            ended = true;
-        } else if (c == '=') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '=') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_equal;
-            } else {
-                t->kind = '=';
-            }
-            ended = true;
-        } else if (c == '!') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '=') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_not_equal;
-            } else {
-                t->kind = '!';
-            }
-            ended = true;
-        } else if (c == '&') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '&') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_and_and;
-            } else {
-                t->kind = '&';
-            }
-            ended = true;
-        } else if (c == '|') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '|') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-                t->kind = TokenKind_or_or;
-            } else {
-                t->kind = '|';
-            }
-            ended = true;
-        } else if (c == '.') {
-            buffer[len] = Lexer_consume(l);
-            len = len + 1;
-
-            if (Lexer_current(l) == '.') {
-                buffer[len] = Lexer_consume(l);
-                len = len + 1;
-
-                if (Lexer_current(l) == '.') {
-                    buffer[len] = Lexer_consume(l);
-                    len = len + 1;
-                    t->kind = TokenKind_var_arg;
-                } else {
-                    t->kind = TokenKind_dot_dot;
-                }
-            } else {
-                t->kind = '.';
-            }
-            ended = true;
         } else {
-            // .
-            t->kind = buffer[len] = Lexer_consume(l);
-            len = len + 1;
+            Lexer_read_punctuator(l, t);
             ended = true;
         }
     }
 
-    buffer[len] = '\0';
-    t->text = strdup(buffer);
+    t->length = l->cursor - t->offset;
+    t->text = Intern_substring(&l->text[t->offset], t->length);
     t->is_bol = l->is_bol;
 
     l->is_bol = false;
     return t;
 }
+
+Vec(Token) * Lexer_read_all(Lexer *l) {
+    assert(l);
+
+    TimeReport_begin(TimeReportPhase_lex);
+
+    Vec(Token) *tokens = Vec_new(Token)();
+
+    Token *t = Lexer_read(l);
+    Vec_push(Token)(tokens, t);
+
+    while (t->kind != '\0') {
+        t = Lexer_read(l);
+        Vec_push(Token)(tokens, t);
+    }
+
+    TimeReport_end(TimeReportPhase_lex);
+    return tokens;
+}
+
+const char *Lexer_directive_at(const Vec(Token) * tokens, size_t i) {
+    assert(tokens);
+    assert(i < Vec_len(Token)(tokens));
+
+    const Token *t = Vec_get(Token)(tokens, i);
+    if (t->kind != '#' || !t->is_bol) {
+        return NULL;
+    }
+
+    const Token *name = Vec_get(Token)(tokens, i + 1);
+    if (name->is_bol || name->kind != TokenKind_identifier) {
+        return NULL;
+    }
+
+    return name->text;
+}
@@ -0,0 +1,7 @@
+#include "mocc.h"
+
+MAP_DEFINE(Symbol)
+MAP_DEFINE(Macro)
+MAP_DEFINE(SourceFile)
+MAP_DEFINE(String)
+MAP_DEFINE(AssemblerSymbol)
@@ -1,40 +1,72 @@
 #include "mocc.h"
 
+// Tokens are pulled from the source only as far as the parser looks ahead,
+// which is at most one token past the current one
 struct Parser {
     Sema *sema;
-    const Vec(Token) * tokens;
-    size_t cursor;
+    TokenSource *source;
+    const Token *current; // NULL until it is pulled
+    const Token *next;    // NULL until it is pulled
+
+    // The AST arena before the body of the last function
+    ArenaMark *body_mark;
+    FunctionDeclNode *last_function;
 };
 
-Parser *Parser_new(const Vec(Token) * tokens) {
-    assert(tokens);
+Parser *Parser_new_from_source(TokenSource *source) {
+    assert(source);
 
     Parser *p = malloc(sizeof(Parser));
     p->sema = Sema_new();
-    p->tokens = tokens;
-    p->cursor = 0;
+    p->source = source;
+    p->current = NULL;
+    p->next = NULL;
+    p->body_mark = malloc(sizeof(ArenaMark));
+    p->last_function = NULL;
 
     return p;
 }
 
-static const Token *Parser_current(const Parser *p) {
+Parser *Parser_new(const Vec(Token) * tokens) {
+    assert(tokens);
+
+    return Parser_new_from_source(TokenSource_from_vec(tokens));
+}
+
+Sema *Parser_sema(Parser *p) {
     assert(p);
 
-    return Vec_get(Token)(p->tokens, p->cursor);
+    return p->sema;
 }
 
-static const Token *Parser_peek(const Parser *p) {
+static const Token *Parser_current(Parser *p) {
     assert(p);
 
-    return Vec_get(Token)(p->tokens, p->cursor + 1);
+    if (!p->current) {
+        p->current = TokenSource_next(p->source);
+    }
+
+    return p->current;
+}
+
+static const Token *Parser_peek(Parser *p) {
+    assert(p);
+
+    if (!p->next) {
+        Parser_current(p);
+        p->next = TokenSource_next(p->source);
+    }
+
+    return p->next;
 }
 
 static const Token *Parser_consume(Parser *p) {
     assert(p);
     assert(Parser_current(p)->kind != '\0');
 
-    const Token *t = Vec_get(Token)(p->tokens, p->cursor);
-    p->cursor = p->cursor + 1;
+    const Token *t = Parser_current(p);
+    p->current = p->next;
+    p->next = NULL;
     return t;
 }
 
@@ -1437,11 +1469,16 @@ static DeclNode *Parser_parse_top_level_decl(Parser *p) {
         // function_decl
         Sema_act_on_function_decl_start_of_body(p->sema, decl_spec, declarator);
 
+        Arena_mark(Node_arena(), p->body_mark);
+
         // compound_stmt
         StmtNode *body = Parser_parse_compound_stmt(p);
 
-        return Sema_act_on_function_decl_end_of_body(
+        DeclNode *decl = Sema_act_on_function_decl_end_of_body(
             p->sema, decl_spec, declarator, body);
+
+        p->last_function = FunctionDeclNode_cast(decl);
+        return decl;
     }
 
     // (',' init_declarator)*
@@ -1463,6 +1500,40 @@ static DeclNode *Parser_parse_top_level_decl(Parser *p) {
     return Sema_act_on_global_decl(p->sema, decl_spec, declarators);
 }
 
+DeclNode *Parser_parse_next_decl(Parser *p) {
+    assert(p);
+
+    if (Parser_current(p)->kind == '\0') {
+        return NULL;
+    }
+
+    p->last_function = NULL;
+    return Parser_parse_top_level_decl(p);
+}
+
+void Parser_release_function_decl(Parser *p, FunctionDeclNode *node) {
+    assert(p);
+    assert(node);
+    assert(node == p->last_function);
+
+    // Local variables are referenced only from the body
+    Vec(Symbol) *local_variables = node->local_variables;
+
+    for (size_t i = 0; i < Vec_len(Symbol)(local_variables); i = i + 1) {
+        Symbol *symbol = Vec_get(Symbol)(local_variables, i);
+
+        free(symbol->address);
+        free(symbol);
+    }
+
+    Vec_delete(Symbol)(local_variables);
+
+    // The body and the function node are allocated after the mark. The
+    // declarator stays, since the function symbol keeps being referenced.
+    Arena_reset(Node_arena(), p->body_mark);
+    p->last_function = NULL;
+}
+
 // top_level_decls:
 //  top_level_decl*
 static Vec(DeclNode) * Parser_parse_top_level_decls(Parser *p) {
@@ -1471,11 +1542,12 @@ static Vec(DeclNode) * Parser_parse_top_level_decls(Parser *p) {
     // top_level_decl*
     Vec(DeclNode) *declarations = Vec_new(DeclNode)();
 
-    while (Parser_current(p)->kind != '\0') {
-        // top_level_decl
-        DeclNode *decl = Parser_parse_top_level_decl(p);
+    // top_level_decl
+    DeclNode *decl = Parser_parse_next_decl(p);
 
+    while (decl) {
         Vec_push(DeclNode)(declarations, decl);
+        decl = Parser_parse_next_decl(p);
     }
 
     return declarations;
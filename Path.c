@@ -32,3 +32,80 @@ char *Path_dir(const char *path) {
 
     return strndup(path, len);
 }
+
+char *Path_base(const char *path) {
+    assert(path);
+
+    size_t len = strlen(path);
+    size_t start = len;
+    while (start > 0 && path[start - 1] != '/') {
+        start = start - 1;
+    }
+
+    return strdup(&path[start]);
+}
+
+char *Path_normalize(const char *path) {
+    assert(path);
+
+    size_t len = strlen(path);
+    char *normalized = malloc(sizeof(char) * (len + 2));
+    size_t normalized_len = 0;
+    size_t num_names = 0; // Trailing components that '..' can remove
+    bool is_absolute = len > 0 && path[0] == '/';
+
+    if (is_absolute) {
+        normalized[0] = '/';
+        normalized_len = 1;
+    }
+
+    size_t root_len = normalized_len;
+    size_t i = 0;
+    while (i < len) {
+        size_t start = i;
+        while (i < len && path[i] != '/') {
+            i = i + 1;
+        }
+
+        size_t n = i - start;
+        bool is_dot = n == 1 && path[start] == '.';
+        bool is_dot_dot =
+            n == 2 && path[start] == '.' && path[start + 1] == '.';
+
+        if (n == 0 || is_dot || (is_dot_dot && is_absolute && num_names == 0)) {
+            // Skip empty components, '.', and '..' of the root
+        } else if (is_dot_dot && num_names > 0) {
+            // Remove the last component and the '/' before it
+            while (normalized_len > root_len &&
+                   normalized[normalized_len - 1] != '/') {
+                normalized_len = normalized_len - 1;
+            }
+            if (normalized_len > root_len) {
+                normalized_len = normalized_len - 1;
+            }
+            num_names = num_names - 1;
+        } else {
+            if (normalized_len > root_len) {
+                normalized[normalized_len] = '/';
+                normalized_len = normalized_len + 1;
+            }
+            memcpy(&normalized[normalized_len], &path[start], n);
+            normalized_len = normalized_len + n;
+
+            if (!is_dot_dot) {
+                num_names = num_names + 1;
+            }
+        }
+
+        i = i + 1;
+    }
+
+    if (normalized_len == 0) {
+        normalized[0] = '.';
+        normalized_len = 1;
+    }
+
+    normalized[normalized_len] = '\0';
+
+    return normalized;
+}
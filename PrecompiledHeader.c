@@ -0,0 +1,520 @@
+#include "mocc.h"
+
+// A precompiled header is a binary file with:
+//
+//  - a magic string and a version,
+//  - the paths of the files marked with #pragma once,
+//  - the macros defined at the end of the header,
+//  - the file-scope ordinary identifiers, struct tags and enum tags.
+//
+// Struct and enum types are identified by their index in the order they
+// are first written. A type is defined in full at its first occurrence and
+// only referred to by index afterwards, which also handles self-referential
+// structs.
+
+#define PRECOMPILED_HEADER_MAGIC "mocc-pch"
+#define PRECOMPILED_HEADER_VERSION 1
+
+// Token flags
+#define PRECOMPILED_HEADER_IS_BOL 1
+#define PRECOMPILED_HEADER_HAS_SPACES 2
+#define PRECOMPILED_HEADER_HAS_STRING 4
+
+struct PrecompiledHeader {
+    Vec(String) * once_files;
+    Vec(Macro) * macros;
+    Vec(Symbol) * variable_symbols;
+    Vec(Symbol) * struct_symbols;
+    Vec(Symbol) * enum_symbols;
+};
+
+// Writing
+static void
+PrecompiledHeader_write_token(BinaryWriter *w, const Token *t) {
+    assert(w);
+    assert(t);
+
+    int flags = 0;
+    if (t->is_bol) {
+        flags = flags + PRECOMPILED_HEADER_IS_BOL;
+    }
+    if (t->has_spaces) {
+        flags = flags + PRECOMPILED_HEADER_HAS_SPACES;
+    }
+    if (t->string) {
+        flags = flags + PRECOMPILED_HEADER_HAS_STRING;
+    }
+
+    BinaryWriter_write_int(w, t->kind);
+    BinaryWriter_write_int(w, flags);
+    BinaryWriter_write_string(w, t->text);
+
+    if (t->string) {
+        BinaryWriter_write_int(w, t->string_len);
+        BinaryWriter_write_bytes(w, t->string, t->string_len);
+    }
+}
+
+static void PrecompiledHeader_write_macro(BinaryWriter *w, const Macro *m) {
+    assert(w);
+    assert(m);
+
+    BinaryWriter_write_string(w, m->name);
+    BinaryWriter_write_int(w, Macro_is_function(m));
+
+    if (Macro_is_function(m)) {
+        size_t num_parameters = Vec_len(String)(m->parameters);
+
+        BinaryWriter_write_int(w, num_parameters);
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            BinaryWriter_write_string(w, Vec_get(String)(m->parameters, i));
+        }
+    }
+
+    BinaryWriter_write_int(w, Vec_len(Token)(m->contents));
+    for (size_t i = 0; i < Vec_len(Token)(m->contents); i = i + 1) {
+        PrecompiledHeader_write_token(w, Vec_get(Token)(m->contents, i));
+    }
+}
+
+static void
+PrecompiledHeader_write_type(BinaryWriter *w, Vec(Type) * types, Type *type) {
+    assert(w);
+    assert(types);
+    assert(type);
+
+    BinaryWriter_write_int(w, type->kind);
+
+    if (type->kind == TypeKind_pointer) {
+        PrecompiledHeader_write_type(w, types, type->pointee_type);
+    } else if (type->kind == TypeKind_function) {
+        size_t num_parameters = Vec_len(Type)(type->parameter_types);
+
+        PrecompiledHeader_write_type(w, types, type->return_type);
+        BinaryWriter_write_int(w, num_parameters);
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            PrecompiledHeader_write_type(
+                w, types, Vec_get(Type)(type->parameter_types, i));
+        }
+        BinaryWriter_write_int(w, type->is_var_arg);
+    } else if (type->kind == TypeKind_array) {
+        PrecompiledHeader_write_type(w, types, type->element_type);
+        BinaryWriter_write_int(w, type->array_length);
+    } else if (
+        type->kind == TypeKind_struct || type->kind == TypeKind_enum) {
+        // Refer to a type that is already written
+        for (size_t i = 0; i < Vec_len(Type)(types); i = i + 1) {
+            if (Vec_get(Type)(types, i) == type) {
+                BinaryWriter_write_int(w, i);
+                return;
+            }
+        }
+
+        BinaryWriter_write_int(w, Vec_len(Type)(types));
+        Vec_push(Type)(types, type);
+
+        if (type->kind == TypeKind_struct) {
+            assert(type->struct_symbol);
+
+            BinaryWriter_write_string(w, type->struct_symbol->name);
+            BinaryWriter_write_int(w, StructType_is_defined(type));
+
+            if (StructType_is_defined(type)) {
+                size_t num_members = Vec_len(Symbol)(type->member_symbols);
+
+                BinaryWriter_write_int(w, num_members);
+                for (size_t i = 0; i < num_members; i = i + 1) {
+                    Symbol *member = Vec_get(Symbol)(type->member_symbols, i);
+
+                    BinaryWriter_write_string(w, member->name);
+                    PrecompiledHeader_write_type(w, types, member->type);
+                }
+            }
+        } else {
+            BinaryWriter_write_int(w, type->enum_symbol != (Symbol *)NULL);
+            if (type->enum_symbol) {
+                BinaryWriter_write_string(w, type->enum_symbol->name);
+            }
+
+            PrecompiledHeader_write_type(w, types, type->underlying_type);
+        }
+    }
+}
+
+static void PrecompiledHeader_write_symbol(
+    BinaryWriter *w, Vec(Type) * types, const Symbol *symbol) {
+    assert(w);
+    assert(types);
+    assert(symbol);
+
+    if (symbol->has_body) {
+        ERROR(
+            "cannot precompile a header that defines function %s\n",
+            symbol->name);
+    }
+
+    if (symbol->type->kind != TypeKind_function &&
+        (symbol->storage_class == StorageClass_none ||
+         symbol->storage_class == StorageClass_static)) {
+        ERROR(
+            "cannot precompile a header that defines variable %s\n",
+            symbol->name);
+    }
+
+    BinaryWriter_write_string(w, symbol->name);
+    BinaryWriter_write_int(w, symbol->storage_class);
+    PrecompiledHeader_write_type(w, types, symbol->type);
+    BinaryWriter_write_int(w, symbol->enum_value);
+}
+
+// Writes the types of tag symbols, whose symbols are found from the types
+static void PrecompiledHeader_write_tags(
+    BinaryWriter *w, Vec(Type) * types, Vec(Symbol) * symbols) {
+    assert(w);
+    assert(types);
+    assert(symbols);
+
+    BinaryWriter_write_int(w, Vec_len(Symbol)(symbols));
+    for (size_t i = 0; i < Vec_len(Symbol)(symbols); i = i + 1) {
+        PrecompiledHeader_write_type(
+            w, types, Vec_get(Symbol)(symbols, i)->type);
+    }
+}
+
+static void PrecompiledHeader_write(
+    BinaryWriter *w, const Preprocessor *pp, const Sema *s) {
+    assert(w);
+    assert(pp);
+    assert(s);
+
+    BinaryWriter_write_string(w, PRECOMPILED_HEADER_MAGIC);
+    BinaryWriter_write_int(w, PRECOMPILED_HEADER_VERSION);
+
+    // #pragma once files
+    const Map(String) *once_files = Preprocessor_once_files(pp);
+
+    BinaryWriter_write_int(w, Map_len(String)(once_files));
+    for (size_t i = 0; i < Map_cap(String)(once_files); i = i + 1) {
+        const char *path = Map_value_at(String)(once_files, i);
+        if (path) {
+            BinaryWriter_write_string(w, path);
+        }
+    }
+
+    // Macros
+    const Map(Macro) *macros = Preprocessor_macros(pp);
+
+    BinaryWriter_write_int(w, Map_len(Macro)(macros));
+    for (size_t i = 0; i < Map_cap(Macro)(macros); i = i + 1) {
+        const Macro *m = Map_value_at(Macro)(macros, i);
+        if (m) {
+            PrecompiledHeader_write_macro(w, m);
+        }
+    }
+
+    // Declarations
+    Vec(Type) *types = Vec_new(Type)();
+    Vec(Symbol) *symbols = Scope_symbols(Sema_global_variable_scope(s));
+
+    BinaryWriter_write_int(w, Vec_len(Symbol)(symbols));
+    for (size_t i = 0; i < Vec_len(Symbol)(symbols); i = i + 1) {
+        PrecompiledHeader_write_symbol(w, types, Vec_get(Symbol)(symbols, i));
+    }
+
+    PrecompiledHeader_write_tags(
+        w, types, Scope_symbols(Sema_global_struct_scope(s)));
+    PrecompiledHeader_write_tags(
+        w, types, Scope_symbols(Sema_global_enum_scope(s)));
+}
+
+void PrecompiledHeader_emit(
+    Vec(String) * include_paths, const char *header_path, const char *output) {
+    assert(include_paths);
+    assert(header_path);
+    assert(output);
+
+    const char *text = File_read(header_path);
+    if (text == (const char *)NULL) {
+        ERROR("cannot open file %s\n", header_path);
+    }
+
+    Preprocessor *pp = Preprocessor_new(include_paths);
+    Vec(Token) *tokens = Preprocessor_run(pp, header_path, text);
+
+    Parser *p = Parser_new(tokens);
+    Parser_parse(p);
+
+    BinaryWriter *w = BinaryWriter_new();
+    PrecompiledHeader_write(w, pp, Parser_sema(p));
+
+    // Only the declarations are kept
+    Node_release_arena();
+
+    if (!BinaryWriter_save(w, output)) {
+        ERROR("cannot write file %s\n", output);
+    }
+}
+
+// Reading
+static Token *PrecompiledHeader_read_token(BinaryReader *r) {
+    assert(r);
+
+    Token *t = malloc(sizeof(Token));
+    t->kind = BinaryReader_read_int(r);
+
+    int flags = BinaryReader_read_int(r);
+    t->is_bol = (flags & PRECOMPILED_HEADER_IS_BOL) != 0;
+    t->has_spaces = (flags & PRECOMPILED_HEADER_HAS_SPACES) != 0;
+
+    t->text = BinaryReader_read_string(r);
+    t->source = t->text;
+    t->offset = 0;
+    t->length = Intern_length(t->text);
+    t->string = NULL;
+    t->string_len = 0;
+    t->hidden_set = NULL;
+
+    if ((flags & PRECOMPILED_HEADER_HAS_STRING) != 0) {
+        // The contents stay in the file buffer, which is never released
+        t->string_len = BinaryReader_read_int(r);
+        t->string = BinaryReader_read_bytes(r, t->string_len);
+    }
+
+    return t;
+}
+
+static Macro *PrecompiledHeader_read_macro(BinaryReader *r) {
+    assert(r);
+
+    const char *name = BinaryReader_read_string(r);
+    Vec(String) *parameters = NULL;
+
+    if (BinaryReader_read_int(r)) {
+        size_t num_parameters = BinaryReader_read_int(r);
+
+        parameters = Vec_new(String)();
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            Vec_push(String)(parameters, BinaryReader_read_string(r));
+        }
+    }
+
+    size_t num_tokens = BinaryReader_read_int(r);
+    Vec(Token) *contents = Vec_new(Token)();
+
+    Vec_reserve(Token)(contents, num_tokens);
+    for (size_t i = 0; i < num_tokens; i = i + 1) {
+        Vec_push(Token)(contents, PrecompiledHeader_read_token(r));
+    }
+
+    return Macro_new(name, parameters, contents);
+}
+
+static Type *PrecompiledHeader_read_type(BinaryReader *r, Vec(Type) * types) {
+    assert(r);
+    assert(types);
+
+    TypeKind kind = BinaryReader_read_int(r);
+
+    if (kind == TypeKind_void) {
+        return VoidType_new();
+    } else if (kind == TypeKind_char) {
+        return CharType_new();
+    } else if (kind == TypeKind_int) {
+        return IntType_new();
+    } else if (kind == TypeKind_pointer) {
+        return PointerType_new(PrecompiledHeader_read_type(r, types));
+    } else if (kind == TypeKind_function) {
+        Type *return_type = PrecompiledHeader_read_type(r, types);
+        size_t num_parameters = BinaryReader_read_int(r);
+        Vec(Type) *parameter_types = Vec_new(Type)();
+
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            Vec_push(Type)(
+                parameter_types, PrecompiledHeader_read_type(r, types));
+        }
+
+        bool is_var_arg = BinaryReader_read_int(r);
+        return FunctionType_new(return_type, parameter_types, is_var_arg);
+    } else if (kind == TypeKind_array) {
+        Type *element_type = PrecompiledHeader_read_type(r, types);
+        size_t array_length = BinaryReader_read_int(r);
+
+        return ArrayType_new(element_type, array_length);
+    } else if (kind != TypeKind_struct && kind != TypeKind_enum) {
+        ERROR("unknown type kind %d in precompiled header\n", kind);
+    }
+
+    size_t index = BinaryReader_read_int(r);
+    if (index < Vec_len(Type)(types)) {
+        return Vec_get(Type)(types, index);
+    } else if (index != Vec_len(Type)(types)) {
+        ERROR("invalid type index %zu in precompiled header\n", index);
+    }
+
+    if (kind == TypeKind_struct) {
+        Type *type = StructType_new();
+        Vec_push(Type)(types, type);
+
+        type->struct_symbol = Symbol_new(
+            BinaryReader_read_string(r), StorageClass_none, type);
+
+        if (BinaryReader_read_int(r)) {
+            size_t num_members = BinaryReader_read_int(r);
+            Vec(Symbol) *member_symbols = Vec_new(Symbol)();
+
+            for (size_t i = 0; i < num_members; i = i + 1) {
+                const char *name = BinaryReader_read_string(r);
+                Type *member_type = PrecompiledHeader_read_type(r, types);
+
+                Vec_push(Symbol)(
+                    member_symbols,
+                    Symbol_new(name, StorageClass_none, member_type));
+            }
+
+            type->member_symbols = member_symbols;
+        }
+
+        return type;
+    }
+
+    // The enumerators are declared as ordinary identifiers
+    Type *type = EnumType_new(IntType_new(), Vec_new(EnumeratorDeclNode)());
+    Vec_push(Type)(types, type);
+
+    if (BinaryReader_read_int(r)) {
+        type->enum_symbol = Symbol_new(
+            BinaryReader_read_string(r), StorageClass_none, type);
+    }
+
+    type->underlying_type = PrecompiledHeader_read_type(r, types);
+    return type;
+}
+
+static Symbol *
+PrecompiledHeader_read_symbol(BinaryReader *r, Vec(Type) * types) {
+    assert(r);
+    assert(types);
+
+    const char *name = BinaryReader_read_string(r);
+    StorageClass storage_class = BinaryReader_read_int(r);
+    Type *type = PrecompiledHeader_read_type(r, types);
+
+    Symbol *symbol = Symbol_new(name, storage_class, type);
+    symbol->enum_value = BinaryReader_read_int(r);
+
+    return symbol;
+}
+
+PrecompiledHeader *PrecompiledHeader_load(const char *path) {
+    assert(path);
+
+    size_t size;
+    const char *data = File_read_with_size(path, &size);
+    if (data == (const char *)NULL) {
+        ERROR("cannot open file %s\n", path);
+    }
+
+    BinaryReader *r = BinaryReader_new(data, size);
+
+    // Check the length of the magic string before reading it, so that other
+    // files are rejected without reading past their end
+    size_t magic_len = strlen(PRECOMPILED_HEADER_MAGIC);
+    if (size < 4 + magic_len || (size_t)BinaryReader_read_int(r) != magic_len ||
+        memcmp(
+            BinaryReader_read_bytes(r, magic_len),
+            PRECOMPILED_HEADER_MAGIC,
+            magic_len) != 0) {
+        ERROR("%s is not a precompiled header\n", path);
+    }
+
+    if (BinaryReader_read_int(r) != PRECOMPILED_HEADER_VERSION) {
+        ERROR("%s is precompiled by another version\n", path);
+    }
+
+    PrecompiledHeader *pch = malloc(sizeof(PrecompiledHeader));
+    pch->once_files = Vec_new(String)();
+    pch->macros = Vec_new(Macro)();
+    pch->variable_symbols = Vec_new(Symbol)();
+    pch->struct_symbols = Vec_new(Symbol)();
+    pch->enum_symbols = Vec_new(Symbol)();
+
+    size_t num_once_files = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_once_files; i = i + 1) {
+        Vec_push(String)(pch->once_files, BinaryReader_read_string(r));
+    }
+
+    size_t num_macros = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_macros; i = i + 1) {
+        Vec_push(Macro)(pch->macros, PrecompiledHeader_read_macro(r));
+    }
+
+    Vec(Type) *types = Vec_new(Type)();
+
+    size_t num_symbols = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_symbols; i = i + 1) {
+        Vec_push(Symbol)(
+            pch->variable_symbols, PrecompiledHeader_read_symbol(r, types));
+    }
+
+    size_t num_structs = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_structs; i = i + 1) {
+        Type *type = PrecompiledHeader_read_type(r, types);
+        Vec_push(Symbol)(pch->struct_symbols, type->struct_symbol);
+    }
+
+    size_t num_enums = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_enums; i = i + 1) {
+        Type *type = PrecompiledHeader_read_type(r, types);
+        Vec_push(Symbol)(pch->enum_symbols, type->enum_symbol);
+    }
+
+    if (!BinaryReader_at_end(r)) {
+        ERROR("extra data at the end of precompiled header %s\n", path);
+    }
+
+    return pch;
+}
+
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp) {
+    assert(pch);
+    assert(pp);
+
+    for (size_t i = 0; i < Vec_len(String)(pch->once_files); i = i + 1) {
+        Preprocessor_mark_once(pp, Vec_get(String)(pch->once_files, i));
+    }
+
+    for (size_t i = 0; i < Vec_len(Macro)(pch->macros); i = i + 1) {
+        Preprocessor_define_macro(pp, Vec_get(Macro)(pch->macros, i));
+    }
+}
+
+static void PrecompiledHeader_declare(
+    Scope *scope, Vec(Symbol) * symbols, const char *kind) {
+    assert(scope);
+    assert(symbols);
+    assert(kind);
+
+    for (size_t i = 0; i < Vec_len(Symbol)(symbols); i = i + 1) {
+        Symbol *symbol = Vec_get(Symbol)(symbols, i);
+
+        if (!Scope_try_register(scope, symbol)) {
+            ERROR(
+                "%s%s is already declared in this scope\n",
+                kind,
+                symbol->name);
+        }
+    }
+}
+
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s) {
+    assert(pch);
+    assert(s);
+
+    PrecompiledHeader_declare(
+        Sema_global_variable_scope(s), pch->variable_symbols, "");
+    PrecompiledHeader_declare(
+        Sema_global_struct_scope(s), pch->struct_symbols, "struct ");
+    PrecompiledHeader_declare(
+        Sema_global_enum_scope(s), pch->enum_symbols, "enum ");
+}
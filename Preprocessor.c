@@ -1,44 +1,31 @@
 #include "mocc.h"
 
-static Token *
-Token_clone_with_hidden(const Token *t, Vec(String) * hidden_set) {
+static Token *Token_clone_with_hidden(const Token *t, HiddenSet *hidden_set) {
     assert(t);
 
     Token *p = malloc(sizeof(Token));
+    TimeReport_allocate(sizeof(Token));
     p->kind = t->kind;
     p->text = t->text;
+    p->source = t->source;
+    p->offset = t->offset;
+    p->length = t->length;
     p->string = t->string;
     p->string_len = t->string_len;
     p->is_bol = t->is_bol;
     p->has_spaces = t->has_spaces;
-    p->hidden_set = Vec_new(String)();
-
-    for (size_t i = 0; i < Vec_len(String)(hidden_set); i = i + 1) {
-        Vec_push(String)(p->hidden_set, Vec_get(String)(hidden_set, i));
-    }
+    p->hidden_set = hidden_set;
 
     return p;
 }
 
-static bool Token_contains_in_hidden_set(const Token *t, const char *name) {
-    assert(t);
-    assert(name);
-
-    for (size_t i = 0; i < Vec_len(String)(t->hidden_set); i = i + 1) {
-        if (strcmp(Vec_get(String)(t->hidden_set, i), name) == 0) {
-            return true;
-        }
-    }
-
-    return false;
-}
-
 Macro *
 Macro_new(const char *name, Vec(String) * parameters, Vec(Token) * contents) {
     assert(name);
     assert(contents);
 
     Macro *m = malloc(sizeof(Macro));
+    TimeReport_allocate(sizeof(Macro));
     m->name = name;
     m->parameters = parameters;
     m->contents = contents;
@@ -51,40 +38,176 @@ bool Macro_is_function(const Macro *m) {
     return m->parameters != (Vec(String) *)NULL;
 }
 
-typedef struct Preprocessor {
+// Keywords are looked up by the hash stored in the interner, so that
+// classifying an identifier costs a probe or two and a pointer compare.
+#define PREPROCESSOR_KEYWORD_TABLE_SIZE 64
+
+// States of the conditional directives being processed
+typedef enum ConditionState {
+    ConditionState_taken, // In the group that was taken, before #else
+    ConditionState_else,  // In the #else group
+} ConditionState;
+
+// The state of an including file while an included file is read
+typedef struct PreprocessorFrame PreprocessorFrame;
+
+struct PreprocessorFrame {
+    PreprocessorFrame *parent;
+    Vec(Token) * queue;
+    const char *path;
+    const Vec(Token) * tokens;
+    size_t cursor;
+    size_t conditions_base;
+};
+
+struct Preprocessor {
     Vec(String) * include_paths;
-    Vec(Macro) * macros;
+    Map(Macro) * macros;
+    Map(String) * once_files; // Files that contain #pragma once
+    const char **keyword_texts;
+    TokenKind *keyword_kinds;
+    HiddenSetTable *hidden_sets;
+
+    // Tokens produced but not yet handed out from `output_cursor`. The
+    // buffer is reused once every token in it has been handed out.
     Vec(Token) * output;
+    size_t output_cursor;
+    Token *eof; // Set when the main file is done
 
+    PreprocessorFrame *frames; // NULL before the main file is entered
+
+    // Lookahead tokens in reverse order, so that both consuming the front
+    // token and pushing an expansion in front are cheap
     Vec(Token) * queue;
     const char *path;
-    Lexer *lexer;
-} Preprocessor;
+    const Vec(Token) * tokens; // Raw tokens of the current file
+    size_t cursor;
+
+    // ConditionState of every open conditional, from the outermost one.
+    // Those below `conditions_base` belong to the including files.
+    Vec(size_t) * conditions;
+    size_t conditions_base;
+
+    // Interned names
+    const char *name_define;
+    const char *name_undef;
+    const char *name_include;
+    const char *name_if;
+    const char *name_ifdef;
+    const char *name_ifndef;
+    const char *name_elif;
+    const char *name_else;
+    const char *name_endif;
+    const char *name_pragma;
+    const char *name_defined;
+    const char *name_once;
+};
+
+static void Preprocessor_enter_file(
+    Preprocessor *pp, const char *path, const Vec(Token) * tokens);
+static void Preprocessor_expand_identifier(Preprocessor *pp);
+
+static void Preprocessor_register_keyword(
+    Preprocessor *pp, const char *text, TokenKind kind) {
+    assert(pp);
+    assert(text);
+
+    const char *name = Intern_string(text);
+    size_t index = Intern_hash(name) & (PREPROCESSOR_KEYWORD_TABLE_SIZE - 1);
+
+    while (pp->keyword_texts[index]) {
+        index = (index + 1) & (PREPROCESSOR_KEYWORD_TABLE_SIZE - 1);
+    }
+
+    pp->keyword_texts[index] = name;
+    pp->keyword_kinds[index] = kind;
+}
+
+static void Preprocessor_init_keywords(Preprocessor *pp) {
+    assert(pp);
+
+    pp->keyword_texts =
+        malloc(sizeof(const char *) * PREPROCESSOR_KEYWORD_TABLE_SIZE);
+    pp->keyword_kinds =
+        malloc(sizeof(TokenKind) * PREPROCESSOR_KEYWORD_TABLE_SIZE);
 
-static Token *
-Preprocessor_read_file(Preprocessor *pp, const char *path, const char *text);
+    for (size_t i = 0; i < PREPROCESSOR_KEYWORD_TABLE_SIZE; i = i + 1) {
+        pp->keyword_texts[i] = NULL;
+        pp->keyword_kinds[i] = TokenKind_identifier;
+    }
+
+#define TOKEN_KW(name, text)                                                   \
+    Preprocessor_register_keyword(pp, text, TokenKind_##name);
+#include "Token.def"
+}
+
+static TokenKind Preprocessor_keyword_kind(Preprocessor *pp, const char *text) {
+    assert(pp);
+    assert(text);
+    assert(Intern_string(text) == text);
+
+    size_t index = Intern_hash(text) & (PREPROCESSOR_KEYWORD_TABLE_SIZE - 1);
+
+    while (pp->keyword_texts[index]) {
+        if (pp->keyword_texts[index] == text) {
+            return pp->keyword_kinds[index];
+        }
+
+        index = (index + 1) & (PREPROCESSOR_KEYWORD_TABLE_SIZE - 1);
+    }
+
+    return TokenKind_identifier;
+}
 
 static void Preprocessor_init(Preprocessor *pp, Vec(String) * include_paths) {
     assert(pp);
     assert(include_paths);
 
     pp->include_paths = include_paths;
-    pp->macros = Vec_new(Macro)();
+    pp->macros = Map_new(Macro)();
+    pp->once_files = Map_new(String)();
+    Preprocessor_init_keywords(pp);
+    pp->hidden_sets = HiddenSetTable_new();
     pp->output = Vec_new(Token)();
+    pp->output_cursor = 0;
+    pp->eof = NULL;
 
+    pp->frames = NULL;
     pp->queue = NULL;
     pp->path = NULL;
-    pp->lexer = NULL;
+    pp->tokens = NULL;
+    pp->cursor = 0;
+
+    pp->conditions = Vec_new(size_t)();
+    pp->conditions_base = 0;
+
+    pp->name_define = Intern_string("define");
+    pp->name_undef = Intern_string("undef");
+    pp->name_include = Intern_string("include");
+    pp->name_if = Intern_string("if");
+    pp->name_ifdef = Intern_string("ifdef");
+    pp->name_ifndef = Intern_string("ifndef");
+    pp->name_elif = Intern_string("elif");
+    pp->name_else = Intern_string("else");
+    pp->name_endif = Intern_string("endif");
+    pp->name_pragma = Intern_string("pragma");
+    pp->name_defined = Intern_string("defined");
+    pp->name_once = Intern_string("once");
 }
 
 static const Token *Preprocessor_current(Preprocessor *pp) {
     assert(pp);
 
-    if (Vec_len(Token)(pp->queue) == 0) {
-        Vec_push(Token)(pp->queue, Lexer_read(pp->lexer));
+    size_t len = Vec_len(Token)(pp->queue);
+    if (len == 0) {
+        assert(pp->cursor < Vec_len(Token)(pp->tokens));
+
+        Vec_push(Token)(pp->queue, Vec_get(Token)(pp->tokens, pp->cursor));
+        pp->cursor = pp->cursor + 1;
+        len = 1;
     }
 
-    return Vec_get(Token)(pp->queue, 0);
+    return Vec_get(Token)(pp->queue, len - 1);
 }
 
 static Token *Preprocessor_consume(Preprocessor *pp) {
@@ -93,34 +216,21 @@ static Token *Preprocessor_consume(Preprocessor *pp) {
     // Fill lookahead queue with a next token
     Preprocessor_current(pp);
 
-    Token *front = Vec_get(Token)(pp->queue, 0);
-
-    for (size_t i = 1; i < Vec_len(Token)(pp->queue); i = i + 1) {
-        Token *t = Vec_get(Token)(pp->queue, i);
-        Vec_set(Token)(pp->queue, i - 1, t);
-    }
-
-    Vec_pop(Token)(pp->queue);
-    return front;
+    return Vec_pop(Token)(pp->queue);
 }
 
-static void Preprocessor_insert_tokens(
-    Preprocessor *pp, const Vec(Token) * tokens, size_t at) {
+// Pushes the expansion of macro `m` in front of the lookahead queue. Every
+// token of the expansion shares the same hidden set.
+static void Preprocessor_push_expansion(
+    Preprocessor *pp, const Macro *m, HiddenSet *hidden_set) {
     assert(pp);
-    assert(tokens);
-    assert(at <= Vec_len(Token)(pp->queue));
-
-    size_t queue_len = Vec_len(Token)(pp->queue);
-    size_t tokens_len = Vec_len(Token)(tokens);
-
-    Vec_resize(Token)(pp->queue, queue_len + tokens_len);
+    assert(m);
 
-    for (size_t i = at; i < queue_len; i = i + 1) {
-        Vec_set(Token)(pp->queue, i + tokens_len, Vec_get(Token)(pp->queue, i));
-    }
+    for (size_t i = Vec_len(Token)(m->contents); i > 0; i = i - 1) {
+        const Token *src_token = Vec_get(Token)(m->contents, i - 1);
 
-    for (size_t i = 0; i < tokens_len; i = i + 1) {
-        Vec_set(Token)(pp->queue, i + at, Vec_get(Token)(tokens, i));
+        Vec_push(Token)(
+            pp->queue, Token_clone_with_hidden(src_token, hidden_set));
     }
 }
 
@@ -128,28 +238,18 @@ static const Macro *
 Preprocessor_find_macro(const Preprocessor *pp, const char *name) {
     assert(pp);
     assert(name);
+    assert(Intern_string(name) == name);
 
-    size_t len = Vec_len(Macro)(pp->macros);
-    for (size_t i = 0; i < len; i = i + 1) {
-        const Macro *m = Vec_get(Macro)(pp->macros, i);
-
-        if (strcmp(m->name, name) == 0) {
-            return m;
-        }
-    }
-
-    return NULL;
+    return Map_find(Macro)(pp->macros, name);
 }
 
-static void Preprocessor_define_macro(Preprocessor *pp, Macro *macro) {
+void Preprocessor_define_macro(Preprocessor *pp, Macro *macro) {
     assert(pp);
     assert(macro);
 
-    if (Preprocessor_find_macro(pp, macro->name)) {
+    if (!Map_insert(Macro)(pp->macros, macro->name, macro)) {
         ERROR("multiple definition of macro %s\n", macro->name);
     }
-
-    Vec_push(Macro)(pp->macros, macro);
 }
 
 static void Preprocessor_parse_define(Preprocessor *pp) {
@@ -207,30 +307,56 @@ static void Preprocessor_parse_define(Preprocessor *pp) {
     Preprocessor_define_macro(pp, macro);
 }
 
-static void Preprocessor_open_file(
-    const Preprocessor *pp, const char *hint, char **path, char **text) {
+static void Preprocessor_parse_undef(Preprocessor *pp) {
+    assert(pp);
+    assert(strcmp(Preprocessor_current(pp)->text, "undef") == 0);
+
+    // 'undef'
+    Preprocessor_consume(pp);
+
+    // identifier
+    const Token *identifier = Preprocessor_consume(pp);
+
+    if (identifier->is_bol) {
+        ERROR("macro name missing\n");
+    } else if (identifier->kind != TokenKind_identifier) {
+        ERROR("macro name must be an identifier\n");
+    }
+
+    if (!Preprocessor_current(pp)->is_bol) {
+        ERROR("extra tokens after #undef %s\n", identifier->text);
+    }
+
+    // Undefining an unknown macro is not an error
+    Map_remove(Macro)(pp->macros, identifier->text);
+}
+
+static const SourceFile *
+Preprocessor_open_file(const Preprocessor *pp, const char *hint) {
     assert(pp);
     assert(hint);
-    assert(path);
-    assert(text);
 
     // Load from the current directory
-    const char *dir = Path_dir(pp->path);
-    *path = Path_join(dir, hint);
-    *text = File_read(*path);
+    char *dir = Path_dir(pp->path);
+    char *path = Path_join(dir, hint);
+    const SourceFile *file = SourceCache_load(path);
 
-    if (*text) {
-        return;
+    free(dir);
+    free(path);
+
+    if (file) {
+        return file;
     }
 
     // Load from include directories
     for (size_t i = 0; i < Vec_len(String)(pp->include_paths); i = i + 1) {
-        dir = Vec_get(String)(pp->include_paths, i);
-        *path = Path_join(dir, hint);
-        *text = File_read(*path);
+        path = Path_join(Vec_get(String)(pp->include_paths, i), hint);
+        file = SourceCache_load(path);
+
+        free(path);
 
-        if (*text) {
-            return;
+        if (file) {
+            return file;
         }
     }
 
@@ -257,12 +383,609 @@ static void Preprocessor_parse_include(Preprocessor *pp) {
         ERROR("extra tokens after #include %s\n", include_file->text);
     }
 
-    const char *hint = include_file->string;
-    char *path;
-    char *text;
+    char *hint = strndup(include_file->string, include_file->string_len);
+    const SourceFile *file = Preprocessor_open_file(pp, hint);
+
+    free(hint);
+
+    // Skip files that are marked with #pragma once, or whose include guard
+    // is still defined, without reading them again
+    if (Map_find(String)(pp->once_files, file->path)) {
+        return;
+    }
+
+    if (file->guard_macro && Preprocessor_find_macro(pp, file->guard_macro)) {
+        return;
+    }
+
+    Preprocessor_enter_file(pp, file->path, file->tokens);
+}
+
+static void
+Preprocessor_expect_end_of_line(Preprocessor *pp, const char *directive) {
+    assert(pp);
+    assert(directive);
+
+    if (!Preprocessor_current(pp)->is_bol) {
+        ERROR("extra tokens after #%s\n", directive);
+    }
+}
+
+static void Preprocessor_skip_line(Preprocessor *pp) {
+    assert(pp);
+
+    while (!Preprocessor_current(pp)->is_bol) {
+        Preprocessor_consume(pp);
+    }
+}
+
+static Token *Preprocessor_new_token(TokenKind kind, const char *text) {
+    assert(text);
+
+    Token *t = malloc(sizeof(Token));
+    TimeReport_allocate(sizeof(Token));
+    t->kind = kind;
+    t->is_bol = false;
+    t->has_spaces = true;
+    t->string_len = 0;
+    t->text = Intern_string(text);
+    t->source = t->text;
+    t->offset = 0;
+    t->length = Intern_length(t->text);
+    t->string = NULL;
+    t->hidden_set = NULL;
+
+    return t;
+}
+
+// Macro-expands the tokens of an #if line, which must end with EOF
+static Vec(Token) *
+    Preprocessor_expand_line(Preprocessor *pp, const Vec(Token) * line) {
+    assert(pp);
+    assert(line);
+
+    Vec(Token) *prev_output = pp->output;
+    Vec(Token) *prev_queue = pp->queue;
+    const Vec(Token) *prev_tokens = pp->tokens;
+    size_t prev_cursor = pp->cursor;
+
+    pp->output = Vec_new(Token)();
+    pp->queue = Vec_new(Token)();
+    pp->tokens = line;
+    pp->cursor = 0;
+
+    const Token *t;
+    while ((t = Preprocessor_current(pp))->kind != '\0') {
+        if (t->kind == TokenKind_identifier) {
+            Preprocessor_expand_identifier(pp);
+        } else {
+            Vec_push(Token)(pp->output, Preprocessor_consume(pp));
+        }
+    }
+
+    Vec_push(Token)(pp->output, Preprocessor_consume(pp));
+
+    Vec(Token) *expanded = pp->output;
+
+    pp->output = prev_output;
+    pp->queue = prev_queue;
+    pp->tokens = prev_tokens;
+    pp->cursor = prev_cursor;
+
+    return expanded;
+}
+
+static int Preprocessor_eval_conditional(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated);
+
+// primary:
+//  number
+//  character
+//  identifier
+//  '(' conditional ')'
+static int Preprocessor_eval_primary(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    const Token *t = Vec_get(Token)(tokens, *pos);
+    *pos = *pos + 1;
+
+    if (t->kind == TokenKind_number) {
+        return atoi(t->text);
+    } else if (t->kind == TokenKind_character) {
+        if (t->string_len != 1) {
+            ERROR("invalid character literal %s in #if\n", t->text);
+        }
+
+        return t->string[0];
+    } else if (t->kind == '(') {
+        int value = Preprocessor_eval_conditional(tokens, pos, evaluated);
+
+        if (Vec_get(Token)(tokens, *pos)->kind != ')') {
+            ERROR("missing ')' in #if\n");
+        }
+
+        *pos = *pos + 1;
+        return value;
+    } else if (isalpha(t->text[0]) || t->text[0] == '_') {
+        // Identifiers left after macro expansion, including keywords
+        return 0;
+    } else if (t->kind == '\0') {
+        ERROR("unexpected end of #if expression\n");
+    } else {
+        ERROR("unexpected token %s in #if\n", t->text);
+    }
+}
+
+// unary:
+//  primary
+//  ('+' | '-' | '!') unary
+static int Preprocessor_eval_unary(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    TokenKind kind = Vec_get(Token)(tokens, *pos)->kind;
+
+    if (kind == '+' || kind == '-' || kind == '!') {
+        *pos = *pos + 1;
+
+        int operand = Preprocessor_eval_unary(tokens, pos, evaluated);
+        if (kind == '-') {
+            return -operand;
+        } else if (kind == '!') {
+            return !operand;
+        }
+
+        return operand;
+    }
+
+    return Preprocessor_eval_primary(tokens, pos, evaluated);
+}
+
+// multiplicative:
+//  unary (('*' | '/' | '%') unary)*
+static int Preprocessor_eval_multiplicative(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_unary(tokens, pos, evaluated);
+
+    TokenKind kind = Vec_get(Token)(tokens, *pos)->kind;
+    while (kind == '*' || kind == '/' || kind == '%') {
+        *pos = *pos + 1;
+
+        int rhs = Preprocessor_eval_unary(tokens, pos, evaluated);
+        if (kind == '*') {
+            value = value * rhs;
+        } else if (rhs == 0 && evaluated) {
+            ERROR("division by zero in #if\n");
+        } else if (rhs == 0) {
+            // Division in an operand that is not evaluated has no value
+            value = 0;
+        } else if (kind == '/') {
+            value = value / rhs;
+        } else {
+            value = value % rhs;
+        }
+
+        kind = Vec_get(Token)(tokens, *pos)->kind;
+    }
+
+    return value;
+}
+
+// additive:
+//  multiplicative (('+' | '-') multiplicative)*
+static int Preprocessor_eval_additive(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_multiplicative(tokens, pos, evaluated);
+
+    TokenKind kind = Vec_get(Token)(tokens, *pos)->kind;
+    while (kind == '+' || kind == '-') {
+        *pos = *pos + 1;
+
+        int rhs = Preprocessor_eval_multiplicative(tokens, pos, evaluated);
+        if (kind == '+') {
+            value = value + rhs;
+        } else {
+            value = value - rhs;
+        }
+
+        kind = Vec_get(Token)(tokens, *pos)->kind;
+    }
+
+    return value;
+}
+
+// relational:
+//  additive (('<' | '>' | '<=' | '>=') additive)*
+static int Preprocessor_eval_relational(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_additive(tokens, pos, evaluated);
+
+    TokenKind kind = Vec_get(Token)(tokens, *pos)->kind;
+    while (kind == '<' || kind == '>' || kind == TokenKind_lesser_equal ||
+           kind == TokenKind_greater_equal) {
+        *pos = *pos + 1;
+
+        int rhs = Preprocessor_eval_additive(tokens, pos, evaluated);
+        if (kind == '<') {
+            value = value < rhs;
+        } else if (kind == '>') {
+            value = value > rhs;
+        } else if (kind == TokenKind_lesser_equal) {
+            value = value <= rhs;
+        } else {
+            value = value >= rhs;
+        }
+
+        kind = Vec_get(Token)(tokens, *pos)->kind;
+    }
+
+    return value;
+}
+
+// equality:
+//  relational (('==' | '!=') relational)*
+static int Preprocessor_eval_equality(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_relational(tokens, pos, evaluated);
+
+    TokenKind kind = Vec_get(Token)(tokens, *pos)->kind;
+    while (kind == TokenKind_equal || kind == TokenKind_not_equal) {
+        *pos = *pos + 1;
+
+        int rhs = Preprocessor_eval_relational(tokens, pos, evaluated);
+        if (kind == TokenKind_equal) {
+            value = value == rhs;
+        } else {
+            value = value != rhs;
+        }
+
+        kind = Vec_get(Token)(tokens, *pos)->kind;
+    }
+
+    return value;
+}
+
+// logical_and:
+//  equality ('&&' equality)*
+static int Preprocessor_eval_logical_and(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_equality(tokens, pos, evaluated);
+
+    while (Vec_get(Token)(tokens, *pos)->kind == TokenKind_and_and) {
+        *pos = *pos + 1;
+
+        // The right operand is not evaluated once the result is known
+        int rhs = Preprocessor_eval_equality(tokens, pos, evaluated && value);
+        value = value && rhs;
+    }
+
+    return value;
+}
+
+// logical_or:
+//  logical_and ('||' logical_and)*
+static int Preprocessor_eval_logical_or(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int value = Preprocessor_eval_logical_and(tokens, pos, evaluated);
+
+    while (Vec_get(Token)(tokens, *pos)->kind == TokenKind_or_or) {
+        *pos = *pos + 1;
+
+        int rhs =
+            Preprocessor_eval_logical_and(tokens, pos, evaluated && !value);
+        value = value || rhs;
+    }
 
-    Preprocessor_open_file(pp, hint, &path, &text);
-    Preprocessor_read_file(pp, path, text);
+    return value;
+}
+
+// conditional:
+//  logical_or ['?' conditional ':' conditional]
+static int Preprocessor_eval_conditional(
+    const Vec(Token) * tokens, size_t *pos, bool evaluated) {
+    assert(tokens);
+    assert(pos);
+
+    int condition = Preprocessor_eval_logical_or(tokens, pos, evaluated);
+
+    if (Vec_get(Token)(tokens, *pos)->kind != '?') {
+        return condition;
+    }
+
+    *pos = *pos + 1;
+    int then_value =
+        Preprocessor_eval_conditional(tokens, pos, evaluated && condition);
+
+    if (Vec_get(Token)(tokens, *pos)->kind != ':') {
+        ERROR("expected ':' in #if\n");
+    }
+
+    *pos = *pos + 1;
+    int else_value =
+        Preprocessor_eval_conditional(tokens, pos, evaluated && !condition);
+
+    if (condition) {
+        return then_value;
+    }
+
+    return else_value;
+}
+
+// Reads and evaluates the expression of an #if or #elif
+static bool Preprocessor_eval_if(Preprocessor *pp) {
+    assert(pp);
+
+    // Replace `defined X` and `defined(X)` before expanding macros
+    Vec(Token) *line = Vec_new(Token)();
+
+    while (!Preprocessor_current(pp)->is_bol) {
+        Token *t = Preprocessor_consume(pp);
+
+        if (t->kind == TokenKind_identifier && t->text == pp->name_defined) {
+            bool has_paren = Preprocessor_current(pp)->kind == '(' &&
+                             !Preprocessor_current(pp)->is_bol;
+            if (has_paren) {
+                Preprocessor_consume(pp);
+            }
+
+            const Token *name = Preprocessor_current(pp);
+            if (name->is_bol || name->kind != TokenKind_identifier) {
+                ERROR("macro name missing after defined\n");
+            }
+
+            Preprocessor_consume(pp);
+
+            if (has_paren) {
+                const Token *close = Preprocessor_current(pp);
+                if (close->is_bol || close->kind != ')') {
+                    ERROR("missing ')' after defined\n");
+                }
+
+                Preprocessor_consume(pp);
+            }
+
+            if (Preprocessor_find_macro(pp, name->text)) {
+                t = Preprocessor_new_token(TokenKind_number, "1");
+            } else {
+                t = Preprocessor_new_token(TokenKind_number, "0");
+            }
+        }
+
+        Vec_push(Token)(line, t);
+    }
+
+    if (Vec_len(Token)(line) == 0) {
+        ERROR("#if with no expression\n");
+    }
+
+    Vec_push(Token)(line, Preprocessor_new_token('\0', ""));
+
+    Vec(Token) *tokens = Preprocessor_expand_line(pp, line);
+    size_t pos = 0;
+    int value = Preprocessor_eval_conditional(tokens, &pos, true);
+
+    const Token *t = Vec_get(Token)(tokens, pos);
+    if (t->kind != '\0') {
+        ERROR("unexpected token %s in #if\n", t->text);
+    }
+
+    return value != 0;
+}
+
+// Skips raw tokens, without expanding them, up to the #elif, #else or #endif
+// that continues the current conditional. Returns the name of that directive
+// and leaves the rest of its line unread.
+static const char *Preprocessor_skip_group(Preprocessor *pp) {
+    assert(pp);
+
+    // Give back the lookahead, which only holds the next raw token here
+    assert(Vec_len(Token)(pp->queue) <= 1);
+    if (Vec_len(Token)(pp->queue) != 0) {
+        pp->cursor = pp->cursor - 1;
+
+        Token *t = Vec_pop(Token)(pp->queue);
+        assert(t == Vec_get(Token)(pp->tokens, pp->cursor));
+        (void)t;
+    }
+
+    size_t depth = 0;
+    const char *found = NULL;
+
+    while (!found) {
+        const Token *t = Vec_get(Token)(pp->tokens, pp->cursor);
+        const char *directive = Lexer_directive_at(pp->tokens, pp->cursor);
+
+        if (t->kind == '\0') {
+            ERROR("unterminated conditional directive\n");
+        } else if (!directive) {
+            pp->cursor = pp->cursor + 1;
+        } else if (
+            directive == pp->name_if || directive == pp->name_ifdef ||
+            directive == pp->name_ifndef) {
+            depth = depth + 1;
+            pp->cursor = pp->cursor + 2;
+        } else if (directive == pp->name_endif && depth > 0) {
+            depth = depth - 1;
+            pp->cursor = pp->cursor + 2;
+        } else if (
+            depth == 0 &&
+            (directive == pp->name_elif || directive == pp->name_else ||
+             directive == pp->name_endif)) {
+            found = directive;
+            pp->cursor = pp->cursor + 2;
+        } else {
+            pp->cursor = pp->cursor + 2;
+        }
+    }
+
+    return found;
+}
+
+// Enters a conditional whose first group has the given condition, skipping
+// groups until one is taken
+static void Preprocessor_enter_conditional(Preprocessor *pp, bool condition) {
+    assert(pp);
+
+    bool entered = condition;
+    if (condition) {
+        Vec_push(size_t)(pp->conditions, ConditionState_taken);
+    }
+
+    while (!entered) {
+        const char *directive = Preprocessor_skip_group(pp);
+
+        if (directive == pp->name_elif) {
+            if (Preprocessor_eval_if(pp)) {
+                Vec_push(size_t)(pp->conditions, ConditionState_taken);
+                entered = true;
+            }
+        } else if (directive == pp->name_else) {
+            Preprocessor_expect_end_of_line(pp, directive);
+
+            Vec_push(size_t)(pp->conditions, ConditionState_else);
+            entered = true;
+        } else {
+            Preprocessor_expect_end_of_line(pp, directive);
+            entered = true;
+        }
+    }
+}
+
+static void Preprocessor_parse_if(Preprocessor *pp) {
+    assert(pp);
+    assert(Preprocessor_current(pp)->text == pp->name_if);
+
+    // 'if'
+    Preprocessor_consume(pp);
+
+    Preprocessor_enter_conditional(pp, Preprocessor_eval_if(pp));
+}
+
+static void Preprocessor_parse_ifdef(Preprocessor *pp) {
+    assert(pp);
+
+    // 'ifdef' | 'ifndef'
+    const Token *directive = Preprocessor_consume(pp);
+
+    assert(
+        directive->text == pp->name_ifdef ||
+        directive->text == pp->name_ifndef);
+
+    // identifier
+    const Token *identifier = Preprocessor_current(pp);
+
+    if (identifier->is_bol) {
+        ERROR("macro name missing\n");
+    } else if (identifier->kind != TokenKind_identifier) {
+        ERROR("macro name must be an identifier\n");
+    }
+
+    Preprocessor_consume(pp);
+    Preprocessor_expect_end_of_line(pp, directive->text);
+
+    bool is_defined =
+        Preprocessor_find_macro(pp, identifier->text) != (const Macro *)NULL;
+
+    if (directive->text == pp->name_ifdef) {
+        Preprocessor_enter_conditional(pp, is_defined);
+    } else {
+        Preprocessor_enter_conditional(pp, !is_defined);
+    }
+}
+
+static ConditionState
+Preprocessor_pop_condition(Preprocessor *pp, const char *directive) {
+    assert(pp);
+    assert(directive);
+
+    if (Vec_len(size_t)(pp->conditions) <= pp->conditions_base) {
+        ERROR("#%s without #if\n", directive);
+    }
+
+    return Vec_pop(size_t)(pp->conditions);
+}
+
+static void Preprocessor_parse_else(Preprocessor *pp) {
+    assert(pp);
+
+    // 'elif' | 'else'
+    const char *directive = Preprocessor_consume(pp)->text;
+
+    assert(directive == pp->name_elif || directive == pp->name_else);
+
+    // A group of this conditional has already been taken, so skip the
+    // remaining ones up to #endif
+    bool has_else = Preprocessor_pop_condition(pp, directive) ==
+                    ConditionState_else;
+
+    while (directive != pp->name_endif) {
+        if (has_else) {
+            ERROR("#%s after #else\n", directive);
+        }
+
+        if (directive == pp->name_else) {
+            Preprocessor_expect_end_of_line(pp, directive);
+            has_else = true;
+        } else {
+            Preprocessor_skip_line(pp);
+        }
+
+        directive = Preprocessor_skip_group(pp);
+    }
+
+    Preprocessor_expect_end_of_line(pp, directive);
+}
+
+static void Preprocessor_parse_endif(Preprocessor *pp) {
+    assert(pp);
+    assert(Preprocessor_current(pp)->text == pp->name_endif);
+
+    // 'endif'
+    Preprocessor_consume(pp);
+
+    Preprocessor_pop_condition(pp, pp->name_endif);
+    Preprocessor_expect_end_of_line(pp, pp->name_endif);
+}
+
+static void Preprocessor_parse_pragma(Preprocessor *pp) {
+    assert(pp);
+    assert(Preprocessor_current(pp)->text == pp->name_pragma);
+
+    // 'pragma'
+    Preprocessor_consume(pp);
+
+    const Token *t = Preprocessor_current(pp);
+    if (!t->is_bol && t->text == pp->name_once) {
+        // 'once'
+        Preprocessor_consume(pp);
+        Preprocessor_expect_end_of_line(pp, "pragma once");
+
+        Map_insert(String)(pp->once_files, pp->path, pp->path);
+    } else {
+        // Ignore unknown pragmas
+        Preprocessor_skip_line(pp);
+    }
 }
 
 static void Preprocessor_parse_directive(Preprocessor *pp) {
@@ -276,12 +999,33 @@ static void Preprocessor_parse_directive(Preprocessor *pp) {
     if (directive->is_bol) {
         // # <empty>
         return;
-    } else if (strcmp(directive->text, "define") == 0) {
+    } else if (directive->text == pp->name_define) {
         // # define
         Preprocessor_parse_define(pp);
-    } else if (strcmp(directive->text, "include") == 0) {
+    } else if (directive->text == pp->name_undef) {
+        // # undef
+        Preprocessor_parse_undef(pp);
+    } else if (directive->text == pp->name_include) {
         // # include
         Preprocessor_parse_include(pp);
+    } else if (directive->text == pp->name_if) {
+        // # if
+        Preprocessor_parse_if(pp);
+    } else if (
+        directive->text == pp->name_ifdef ||
+        directive->text == pp->name_ifndef) {
+        // # ifdef | # ifndef
+        Preprocessor_parse_ifdef(pp);
+    } else if (
+        directive->text == pp->name_elif || directive->text == pp->name_else) {
+        // # elif | # else
+        Preprocessor_parse_else(pp);
+    } else if (directive->text == pp->name_endif) {
+        // # endif
+        Preprocessor_parse_endif(pp);
+    } else if (directive->text == pp->name_pragma) {
+        // # pragma
+        Preprocessor_parse_pragma(pp);
     } else {
         ERROR("unknown preprocessor directive #%s\n", directive->text);
     }
@@ -292,13 +1036,12 @@ static void Preprocessor_expand_kw(Preprocessor *pp, Token *t) {
     assert(t);
     assert(t->kind == TokenKind_identifier);
 
-#define TOKEN_KW(name, text_)                                                  \
-    if (strcmp(t->text, text_) == 0) {                                         \
-        t->kind = TokenKind_##name;                                            \
-        Vec_push(Token)(pp->output, t);                                        \
-        return;                                                                \
+    // Raw tokens may be shared between files, so keywords get a copy
+    TokenKind kind = Preprocessor_keyword_kind(pp, t->text);
+    if (kind != TokenKind_identifier) {
+        t = Token_clone_with_hidden(t, t->hidden_set);
+        t->kind = kind;
     }
-#include "Token.def"
 
     Vec_push(Token)(pp->output, t);
 }
@@ -333,18 +1076,10 @@ static void Preprocessor_expand_function_macro(
     Preprocessor_consume(pp);
 
     // Expand the function macro
-    Vec(Token) *tokens = Vec_new(Token)();
-
-    for (size_t i = 0; i < Vec_len(Token)(m->contents); i = i + 1) {
-        const Token *src_token = Vec_get(Token)(m->contents, i);
-
-        Token *t = Token_clone_with_hidden(src_token, macro_token->hidden_set);
-        Vec_push(String)(t->hidden_set, m->name);
-
-        Vec_push(Token)(tokens, t);
-    }
+    HiddenSet *hidden_set =
+        HiddenSet_add(pp->hidden_sets, macro_token->hidden_set, m->name);
 
-    Preprocessor_insert_tokens(pp, tokens, 0);
+    Preprocessor_push_expansion(pp, m, hidden_set);
 }
 
 static void Preprocessor_expand_simple_macro(
@@ -354,18 +1089,10 @@ static void Preprocessor_expand_simple_macro(
     assert(!Macro_is_function(m));
     assert(macro_token);
 
-    Vec(Token) *tokens = Vec_new(Token)();
+    HiddenSet *hidden_set =
+        HiddenSet_add(pp->hidden_sets, macro_token->hidden_set, m->name);
 
-    for (size_t i = 0; i < Vec_len(Token)(m->contents); i = i + 1) {
-        const Token *src_token = Vec_get(Token)(m->contents, i);
-
-        Token *t = Token_clone_with_hidden(src_token, macro_token->hidden_set);
-        Vec_push(String)(t->hidden_set, m->name);
-
-        Vec_push(Token)(tokens, t);
-    }
-
-    Preprocessor_insert_tokens(pp, tokens, 0);
+    Preprocessor_push_expansion(pp, m, hidden_set);
 }
 
 static void Preprocessor_expand_identifier(Preprocessor *pp) {
@@ -377,54 +1104,173 @@ static void Preprocessor_expand_identifier(Preprocessor *pp) {
     assert(t->kind == TokenKind_identifier);
 
     const Macro *m = Preprocessor_find_macro(pp, t->text);
-    if (!m || Token_contains_in_hidden_set(t, m->name)) {
+    if (!m || HiddenSet_contains(t->hidden_set, m->name)) {
         // `t` is an identifier or a keyword
         Preprocessor_expand_kw(pp, t);
     } else if (Macro_is_function(m)) {
         // `t` is a function macro
+        TimeReport_begin(TimeReportPhase_expand);
         Preprocessor_expand_function_macro(pp, m, t);
+        TimeReport_end(TimeReportPhase_expand);
     } else {
         // `t` is a non-function macro
+        TimeReport_begin(TimeReportPhase_expand);
         Preprocessor_expand_simple_macro(pp, m, t);
+        TimeReport_end(TimeReportPhase_expand);
     }
 }
 
-static Token *
-Preprocessor_read_file(Preprocessor *pp, const char *path, const char *text) {
+// Continues with the raw tokens of a file; the current file is resumed at
+// the end of it
+static void Preprocessor_enter_file(
+    Preprocessor *pp, const char *path, const Vec(Token) * tokens) {
     assert(pp);
     assert(path);
-    assert(text);
+    assert(tokens);
 
-    Vec(Token) *prev_queue = pp->queue;
-    Lexer *prev_lexer = pp->lexer;
-    const char *prev_path = pp->path;
+    PreprocessorFrame *frame = malloc(sizeof(PreprocessorFrame));
+    TimeReport_allocate(sizeof(PreprocessorFrame));
+    frame->parent = pp->frames;
+    frame->queue = pp->queue;
+    frame->path = pp->path;
+    frame->tokens = pp->tokens;
+    frame->cursor = pp->cursor;
+    frame->conditions_base = pp->conditions_base;
 
+    pp->frames = frame;
     pp->queue = Vec_new(Token)();
-    pp->lexer = Lexer_new(path, text);
     pp->path = path;
+    pp->tokens = tokens;
+    pp->cursor = 0;
+    pp->conditions_base = Vec_len(size_t)(pp->conditions);
+}
 
-    const Token *t;
-    while ((t = Preprocessor_current(pp))->kind != '\0') {
-        if (t->kind == '#' && t->is_bol) {
-            // Preprocessor directive
-            Preprocessor_parse_directive(pp);
-        } else if (t->kind == TokenKind_identifier) {
-            // Expand identifiers
-            Preprocessor_expand_identifier(pp);
-        } else {
-            // Other tokens
-            Token *token = Preprocessor_consume(pp);
-            Vec_push(Token)(pp->output, token);
+static void Preprocessor_leave_file(Preprocessor *pp) {
+    assert(pp);
+    assert(pp->frames);
+    assert(Preprocessor_current(pp)->kind == '\0');
+
+    Token *eof = Preprocessor_consume(pp);
+
+    if (Vec_len(size_t)(pp->conditions) != pp->conditions_base) {
+        ERROR("unterminated conditional directive in %s\n", pp->path);
+    }
+
+    PreprocessorFrame *frame = pp->frames;
+
+    pp->frames = frame->parent;
+    pp->queue = frame->queue;
+    pp->path = frame->path;
+    pp->tokens = frame->tokens;
+    pp->cursor = frame->cursor;
+    pp->conditions_base = frame->conditions_base;
+
+    free(frame);
+
+    // The EOF of the main file ends the output
+    if (!pp->frames) {
+        pp->eof = eof;
+        Vec_push(Token)(pp->output, eof);
+    }
+}
+
+// Processes a directive, a macro invocation or a token, which produces zero
+// or more output tokens
+static void Preprocessor_step(Preprocessor *pp) {
+    assert(pp);
+    assert(pp->frames);
+
+    const Token *t = Preprocessor_current(pp);
+
+    if (t->kind == '\0') {
+        Preprocessor_leave_file(pp);
+    } else if (t->kind == '#' && t->is_bol) {
+        // Preprocessor directive
+        Preprocessor_parse_directive(pp);
+    } else if (t->kind == TokenKind_identifier) {
+        // Expand identifiers
+        Preprocessor_expand_identifier(pp);
+    } else {
+        // Other tokens
+        Vec_push(Token)(pp->output, Preprocessor_consume(pp));
+    }
+}
+
+Preprocessor *Preprocessor_new(Vec(String) * include_paths) {
+    assert(include_paths);
+
+    Preprocessor *pp = malloc(sizeof(Preprocessor));
+    Preprocessor_init(pp, include_paths);
+
+    return pp;
+}
+
+void Preprocessor_begin(Preprocessor *pp, const char *path, const char *text) {
+    assert(pp);
+    assert(path);
+    assert(text);
+    assert(!pp->frames && !pp->eof);
+
+    char *normalized = Path_normalize(path);
+    path = Intern_string(normalized);
+    free(normalized);
+
+    Preprocessor_enter_file(pp, path, Lexer_read_all(Lexer_new(path, text)));
+}
+
+Token *Preprocessor_next(Preprocessor *pp) {
+    assert(pp);
+    assert(pp->frames || pp->eof);
+
+    while (pp->output_cursor == Vec_len(Token)(pp->output)) {
+        if (pp->eof) {
+            return pp->eof;
         }
+
+        Vec_resize(Token)(pp->output, 0);
+        pp->output_cursor = 0;
+
+        Preprocessor_step(pp);
     }
 
-    Token *eof = Preprocessor_consume(pp);
+    Token *t = Vec_get(Token)(pp->output, pp->output_cursor);
+    pp->output_cursor = pp->output_cursor + 1;
 
-    pp->queue = prev_queue;
-    pp->lexer = prev_lexer;
-    pp->path = prev_path;
+    return t;
+}
+
+Vec(Token) *
+    Preprocessor_run(Preprocessor *pp, const char *path, const char *text) {
+    assert(pp);
+    assert(path);
+    assert(text);
+
+    Preprocessor_begin(pp, path, text);
+
+    return TokenSource_read_all(TokenSource_from_preprocessor(pp));
+}
+
+const Map(Macro) * Preprocessor_macros(const Preprocessor *pp) {
+    assert(pp);
 
-    return eof;
+    return pp->macros;
+}
+
+void Preprocessor_mark_once(Preprocessor *pp, const char *path) {
+    assert(pp);
+    assert(path);
+
+    char *normalized = Path_normalize(path);
+    path = Intern_string(normalized);
+    free(normalized);
+
+    Map_insert(String)(pp->once_files, path, path);
+}
+
+const Map(String) * Preprocessor_once_files(const Preprocessor *pp) {
+    assert(pp);
+
+    return pp->once_files;
 }
 
 Vec(Token) *
@@ -434,11 +1280,5 @@ Vec(Token) *
     assert(path);
     assert(text);
 
-    Preprocessor pp;
-    Preprocessor_init(&pp, include_paths);
-
-    Token *eof = Preprocessor_read_file(&pp, path, text);
-    Vec_push(Token)(pp.output, eof);
-
-    return pp.output;
+    return Preprocessor_run(Preprocessor_new(include_paths), path, text);
 }
@@ -0,0 +1,314 @@
+#include "mocc.h"
+
+// Each scan returns the length of the run of matching characters at the
+// start of a NUL-terminated text. NUL never matches, so a scan never goes
+// past the end of the text.
+//
+// The SIMD versions only do aligned loads. An aligned block never crosses a
+// page boundary, so the bytes after the NUL that they read are always
+// mapped.
+
+// ' ' or '\t', '\v', '\f', '\r' (9, 11, 12, 13), but not '\n'
+static bool Scan_is_space(char c) {
+    return c == ' ' || (c >= 9 && c <= 13 && c != '\n');
+}
+
+static bool Scan_is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static bool Scan_is_identifier(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+}
+
+static bool Scan_is_literal(char c, char quote) {
+    return c != quote && c != '\\' && c != '\n' && c != '\0';
+}
+
+static size_t Scan_spaces_scalar(const char *s) {
+    assert(s);
+
+    size_t n = 0;
+    while (Scan_is_space(s[n])) {
+        n = n + 1;
+    }
+
+    return n;
+}
+
+static size_t Scan_digits_scalar(const char *s) {
+    assert(s);
+
+    size_t n = 0;
+    while (Scan_is_digit(s[n])) {
+        n = n + 1;
+    }
+
+    return n;
+}
+
+static size_t Scan_identifier_scalar(const char *s) {
+    assert(s);
+
+    size_t n = 0;
+    while (Scan_is_identifier(s[n])) {
+        n = n + 1;
+    }
+
+    return n;
+}
+
+static size_t Scan_literal_scalar(const char *s, char quote) {
+    assert(s);
+
+    size_t n = 0;
+    while (Scan_is_literal(s[n], quote)) {
+        n = n + 1;
+    }
+
+    return n;
+}
+
+#if !defined(MOCC) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#include <stdint.h>
+
+#define SCAN_HAS_SIMD 1
+
+// Matches the bytes in [lo, hi]. Bytes above 0x7f are negative and never
+// match an ASCII range.
+#define SCAN_RANGE_128(v, lo, hi)                                              \
+    _mm_and_si128(                                                             \
+        _mm_cmpgt_epi8((v), _mm_set1_epi8((char)((lo)-1))),                    \
+        _mm_cmplt_epi8((v), _mm_set1_epi8((char)((hi) + 1))))
+
+#define SCAN_EQ_128(v, c) _mm_cmpeq_epi8((v), _mm_set1_epi8((char)(c)))
+
+static __m128i Scan_spaces_128(__m128i v) {
+    __m128i m = _mm_or_si128(SCAN_EQ_128(v, ' '), SCAN_RANGE_128(v, 9, 13));
+    return _mm_andnot_si128(SCAN_EQ_128(v, '\n'), m);
+}
+
+static __m128i Scan_digits_128(__m128i v) {
+    return SCAN_RANGE_128(v, '0', '9');
+}
+
+static __m128i Scan_identifier_128(__m128i v) {
+    // Setting bit 5 maps 'A'-'Z' to 'a'-'z'
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i m = _mm_or_si128(
+        SCAN_RANGE_128(lower, 'a', 'z'), SCAN_RANGE_128(v, '0', '9'));
+    return _mm_or_si128(m, SCAN_EQ_128(v, '_'));
+}
+
+static __m128i Scan_literal_128(__m128i v, char quote) {
+    __m128i stop = _mm_or_si128(SCAN_EQ_128(v, quote), SCAN_EQ_128(v, '\\'));
+    stop = _mm_or_si128(stop, SCAN_EQ_128(v, '\n'));
+    stop = _mm_or_si128(stop, SCAN_EQ_128(v, '\0'));
+    return _mm_xor_si128(stop, _mm_set1_epi8(-1));
+}
+
+// Scans 16 bytes at a time; `match` returns 0xff for matching bytes
+#define SCAN_LOOP_128(s, match)                                                \
+    do {                                                                       \
+        size_t misalign = (uintptr_t)(s)&15;                                   \
+        const char *p = (s)-misalign;                                          \
+        unsigned int valid = 0xffffu << misalign;                              \
+                                                                               \
+        for (;;) {                                                             \
+            __m128i v = _mm_load_si128((const __m128i *)p);                    \
+            unsigned int stop =                                                \
+                ~(unsigned int)_mm_movemask_epi8(match) & valid & 0xffffu;     \
+                                                                               \
+            if (stop != 0) {                                                   \
+                return (size_t)(p + __builtin_ctz(stop) - (s));                \
+            }                                                                  \
+                                                                               \
+            p += 16;                                                           \
+            valid = 0xffffu;                                                   \
+        }                                                                      \
+    } while (0)
+
+static size_t Scan_spaces_sse2(const char *s) {
+    SCAN_LOOP_128(s, Scan_spaces_128(v));
+}
+
+static size_t Scan_digits_sse2(const char *s) {
+    SCAN_LOOP_128(s, Scan_digits_128(v));
+}
+
+static size_t Scan_identifier_sse2(const char *s) {
+    SCAN_LOOP_128(s, Scan_identifier_128(v));
+}
+
+static size_t Scan_literal_sse2(const char *s, char quote) {
+    SCAN_LOOP_128(s, Scan_literal_128(v, quote));
+}
+
+#define SCAN_AVX2 __attribute__((target("avx2")))
+
+#define SCAN_RANGE_256(v, lo, hi)                                              \
+    _mm256_and_si256(                                                          \
+        _mm256_cmpgt_epi8((v), _mm256_set1_epi8((char)((lo)-1))),              \
+        _mm256_cmpgt_epi8(_mm256_set1_epi8((char)((hi) + 1)), (v)))
+
+#define SCAN_EQ_256(v, c) _mm256_cmpeq_epi8((v), _mm256_set1_epi8((char)(c)))
+
+SCAN_AVX2 static __m256i Scan_spaces_256(__m256i v) {
+    __m256i m =
+        _mm256_or_si256(SCAN_EQ_256(v, ' '), SCAN_RANGE_256(v, 9, 13));
+    return _mm256_andnot_si256(SCAN_EQ_256(v, '\n'), m);
+}
+
+SCAN_AVX2 static __m256i Scan_digits_256(__m256i v) {
+    return SCAN_RANGE_256(v, '0', '9');
+}
+
+SCAN_AVX2 static __m256i Scan_identifier_256(__m256i v) {
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i m = _mm256_or_si256(
+        SCAN_RANGE_256(lower, 'a', 'z'), SCAN_RANGE_256(v, '0', '9'));
+    return _mm256_or_si256(m, SCAN_EQ_256(v, '_'));
+}
+
+SCAN_AVX2 static __m256i Scan_literal_256(__m256i v, char quote) {
+    __m256i stop =
+        _mm256_or_si256(SCAN_EQ_256(v, quote), SCAN_EQ_256(v, '\\'));
+    stop = _mm256_or_si256(stop, SCAN_EQ_256(v, '\n'));
+    stop = _mm256_or_si256(stop, SCAN_EQ_256(v, '\0'));
+    return _mm256_xor_si256(stop, _mm256_set1_epi8(-1));
+}
+
+// Scans 32 bytes at a time; `match` returns 0xff for matching bytes
+#define SCAN_LOOP_256(s, match)                                                \
+    do {                                                                       \
+        size_t misalign = (uintptr_t)(s)&31;                                   \
+        const char *p = (s)-misalign;                                          \
+        uint32_t valid = 0xffffffffu << misalign;                              \
+                                                                               \
+        for (;;) {                                                             \
+            __m256i v = _mm256_load_si256((const __m256i *)p);                 \
+            uint32_t stop = ~(uint32_t)_mm256_movemask_epi8(match) & valid;    \
+                                                                               \
+            if (stop != 0) {                                                   \
+                return (size_t)(p + __builtin_ctz(stop) - (s));                \
+            }                                                                  \
+                                                                               \
+            p += 32;                                                           \
+            valid = 0xffffffffu;                                               \
+        }                                                                      \
+    } while (0)
+
+SCAN_AVX2 static size_t Scan_spaces_avx2(const char *s) {
+    SCAN_LOOP_256(s, Scan_spaces_256(v));
+}
+
+SCAN_AVX2 static size_t Scan_digits_avx2(const char *s) {
+    SCAN_LOOP_256(s, Scan_digits_256(v));
+}
+
+SCAN_AVX2 static size_t Scan_identifier_avx2(const char *s) {
+    SCAN_LOOP_256(s, Scan_identifier_256(v));
+}
+
+SCAN_AVX2 static size_t Scan_literal_avx2(const char *s, char quote) {
+    SCAN_LOOP_256(s, Scan_literal_256(v, quote));
+}
+#else
+#define SCAN_HAS_SIMD 0
+#endif
+
+// Selected on first use
+static bool Scan_level_selected;
+static ScanLevel Scan_selected_level;
+
+ScanLevel Scan_max_level(void) {
+#if SCAN_HAS_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ScanLevel_avx2;
+    }
+
+    return ScanLevel_sse2;
+#else
+    return ScanLevel_scalar;
+#endif
+}
+
+void Scan_set_level(ScanLevel level) {
+    Scan_level_selected = true;
+    Scan_selected_level = ScanLevel_scalar;
+
+    if (level == ScanLevel_sse2 && Scan_max_level() != ScanLevel_scalar) {
+        Scan_selected_level = ScanLevel_sse2;
+    } else if (level == ScanLevel_avx2 && Scan_max_level() == level) {
+        Scan_selected_level = ScanLevel_avx2;
+    }
+}
+
+ScanLevel Scan_level(void) {
+    if (!Scan_level_selected) {
+        Scan_set_level(Scan_max_level());
+    }
+
+    return Scan_selected_level;
+}
+
+// The level is a well-predicted branch, which keeps the dispatch free of
+// function pointers
+size_t Scan_spaces(const char *s) {
+    assert(s);
+
+#if SCAN_HAS_SIMD
+    if (Scan_level() == ScanLevel_avx2) {
+        return Scan_spaces_avx2(s);
+    } else if (Scan_level() == ScanLevel_sse2) {
+        return Scan_spaces_sse2(s);
+    }
+#endif
+
+    return Scan_spaces_scalar(s);
+}
+
+size_t Scan_digits(const char *s) {
+    assert(s);
+
+#if SCAN_HAS_SIMD
+    if (Scan_level() == ScanLevel_avx2) {
+        return Scan_digits_avx2(s);
+    } else if (Scan_level() == ScanLevel_sse2) {
+        return Scan_digits_sse2(s);
+    }
+#endif
+
+    return Scan_digits_scalar(s);
+}
+
+size_t Scan_identifier(const char *s) {
+    assert(s);
+
+#if SCAN_HAS_SIMD
+    if (Scan_level() == ScanLevel_avx2) {
+        return Scan_identifier_avx2(s);
+    } else if (Scan_level() == ScanLevel_sse2) {
+        return Scan_identifier_sse2(s);
+    }
+#endif
+
+    return Scan_identifier_scalar(s);
+}
+
+size_t Scan_literal(const char *s, char quote) {
+    assert(s);
+
+#if SCAN_HAS_SIMD
+    if (Scan_level() == ScanLevel_avx2) {
+        return Scan_literal_avx2(s, quote);
+    } else if (Scan_level() == ScanLevel_sse2) {
+        return Scan_literal_sse2(s, quote);
+    }
+#endif
+
+    return Scan_literal_scalar(s, quote);
+}
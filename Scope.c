@@ -2,13 +2,14 @@
 
 struct Scope {
     Scope *parent_scope;
-    Vec(Symbol) * symbols;
+    Map(Symbol) * symbols;
 };
 
 Scope *Scope_new(Scope *parent_scope) {
     Scope *s = malloc(sizeof(Scope));
+    TimeReport_allocate(sizeof(Scope));
     s->parent_scope = parent_scope;
-    s->symbols = Vec_new(Symbol)();
+    s->symbols = Map_new(Symbol)();
 
     return s;
 }
@@ -22,16 +23,19 @@ Scope *Scope_parent_scope(const Scope *s) {
 Symbol *Scope_find(Scope *s, const char *name, bool recursive) {
     assert(s);
     assert(name);
+    assert(Intern_string(name) == name);
 
-    for (size_t i = 0; i < Vec_len(Symbol)(s->symbols); i = i + 1) {
-        Symbol *symbol = Vec_get(Symbol)(s->symbols, i);
-        if (strcmp(symbol->name, name) == 0) {
+    while (s) {
+        Symbol *symbol = Map_find(Symbol)(s->symbols, name);
+        if (symbol) {
             return symbol;
         }
-    }
 
-    if (recursive && s->parent_scope) {
-        return Scope_find(s->parent_scope, name, true);
+        if (!recursive) {
+            return NULL;
+        }
+
+        s = s->parent_scope;
     }
 
     return NULL;
@@ -41,11 +45,22 @@ bool Scope_try_register(Scope *s, Symbol *symbol) {
     assert(s);
     assert(symbol);
     assert(symbol->name);
+    assert(Intern_string(symbol->name) == symbol->name);
+
+    return Map_insert(Symbol)(s->symbols, symbol->name, symbol);
+}
 
-    if (Scope_find(s, symbol->name, false)) {
-        return false;
+Vec(Symbol) * Scope_symbols(const Scope *s) {
+    assert(s);
+
+    Vec(Symbol) *symbols = Vec_new(Symbol)();
+
+    for (size_t i = 0; i < Map_cap(Symbol)(s->symbols); i = i + 1) {
+        Symbol *symbol = Map_value_at(Symbol)(s->symbols, i);
+        if (symbol) {
+            Vec_push(Symbol)(symbols, symbol);
+        }
     }
 
-    Vec_push(Symbol)(s->symbols, symbol);
-    return true;
+    return symbols;
 }
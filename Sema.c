@@ -25,6 +25,34 @@ Sema *Sema_new(void) {
     return s;
 }
 
+static Scope *Sema_root_scope(Scope *scope) {
+    assert(scope);
+
+    while (Scope_parent_scope(scope)) {
+        scope = Scope_parent_scope(scope);
+    }
+
+    return scope;
+}
+
+Scope *Sema_global_variable_scope(const Sema *s) {
+    assert(s);
+
+    return Sema_root_scope(s->current_variable_scope);
+}
+
+Scope *Sema_global_struct_scope(const Sema *s) {
+    assert(s);
+
+    return Sema_root_scope(s->current_struct_scope);
+}
+
+Scope *Sema_global_enum_scope(const Sema *s) {
+    assert(s);
+
+    return Sema_root_scope(s->current_enum_scope);
+}
+
 static void Sema_push_scope_stack(Sema *s) {
     assert(s);
 
@@ -554,7 +582,8 @@ ExprNode *Sema_act_on_string_expr(Sema *s, const Token *string) {
     assert(string);
     assert(string->kind == TokenKind_string);
 
-    Type *type = ArrayType_new(s->char_type, string->string_len);
+    // Add room for the terminating NUL
+    Type *type = ArrayType_new(s->char_type, string->string_len + 1);
 
     StringExprNode *node = StringExprNode_new(
         type, ValueCategory_lvalue, string->string, string->string_len);
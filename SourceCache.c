@@ -0,0 +1,126 @@
+#include "mocc.h"
+
+// Files that could not be read are cached as well, with NULL text, so that
+// probing the same candidate path again costs a single lookup.
+
+static Map(SourceFile) * SourceCache_files;
+
+// The cache is shared by the worker threads. A file is read and lexed
+// outside of the lock, and the first one inserted wins. Cached files are
+// never modified.
+#ifndef MOCC
+#include <pthread.h>
+
+static pthread_mutex_t SourceCache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+#define SOURCE_CACHE_LOCK() pthread_mutex_lock(&SourceCache_mutex)
+#define SOURCE_CACHE_UNLOCK() pthread_mutex_unlock(&SourceCache_mutex)
+#else
+#define SOURCE_CACHE_LOCK() ((void)0)
+#define SOURCE_CACHE_UNLOCK() ((void)0)
+#endif
+
+static const char *SourceFile_find_guard(const Vec(Token) * tokens) {
+    assert(tokens);
+
+    const char *if_ = Intern_string("if");
+    const char *ifdef = Intern_string("ifdef");
+    const char *ifndef = Intern_string("ifndef");
+    const char *elif = Intern_string("elif");
+    const char *else_ = Intern_string("else");
+    const char *endif = Intern_string("endif");
+
+    // '#' 'ifndef' identifier <end of line>
+    if (Vec_len(Token)(tokens) < 4 ||
+        Lexer_directive_at(tokens, 0) != ifndef) {
+        return NULL;
+    }
+
+    const Token *guard = Vec_get(Token)(tokens, 2);
+    if (guard->is_bol || guard->kind != TokenKind_identifier ||
+        !Vec_get(Token)(tokens, 3)->is_bol) {
+        return NULL;
+    }
+
+    // Find the matching '#' 'endif'
+    size_t depth = 1;
+    size_t i = 3;
+    while (depth > 0) {
+        const Token *t = Vec_get(Token)(tokens, i);
+        const char *directive = Lexer_directive_at(tokens, i);
+
+        if (t->kind == '\0') {
+            return NULL;
+        } else if (
+            directive == if_ || directive == ifdef || directive == ifndef) {
+            depth = depth + 1;
+        } else if (depth == 1 && (directive == elif || directive == else_)) {
+            // The other group may be taken when the macro is defined
+            return NULL;
+        } else if (directive == endif) {
+            depth = depth - 1;
+        }
+
+        i = i + 1;
+    }
+
+    // Only the end of file may follow
+    if (Vec_get(Token)(tokens, i + 1)->kind != '\0') {
+        return NULL;
+    }
+
+    return guard->text;
+}
+
+static SourceFile *SourceFile_new(const char *path, const char *text) {
+    assert(path);
+
+    SourceFile *file = malloc(sizeof(SourceFile));
+    file->path = path;
+    file->text = text;
+    file->tokens = NULL;
+    file->guard_macro = NULL;
+
+    if (text) {
+        file->tokens = Lexer_read_all(Lexer_new(path, text));
+        file->guard_macro = SourceFile_find_guard(file->tokens);
+    }
+
+    return file;
+}
+
+const SourceFile *SourceCache_load(const char *path) {
+    assert(path);
+
+    // Key on the normalized path, so that "h.h" and "sub/../h.h" share one
+    // entry, and #pragma once sees one file
+    char *normalized = Path_normalize(path);
+    path = Intern_string(normalized);
+    free(normalized);
+
+    SOURCE_CACHE_LOCK();
+    if (!SourceCache_files) {
+        SourceCache_files = Map_new(SourceFile)();
+    }
+
+    SourceFile *file = Map_find(SourceFile)(SourceCache_files, path);
+    SOURCE_CACHE_UNLOCK();
+
+    if (!file) {
+        SourceFile *new_file = SourceFile_new(path, File_read(path));
+
+        SOURCE_CACHE_LOCK();
+        file = Map_find(SourceFile)(SourceCache_files, path);
+        if (!file) {
+            file = new_file;
+            Map_insert(SourceFile)(SourceCache_files, path, file);
+        }
+        SOURCE_CACHE_UNLOCK();
+    }
+
+    if (!file->text) {
+        return NULL;
+    }
+
+    return file;
+}
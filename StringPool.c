@@ -0,0 +1,232 @@
+#include "mocc.h"
+
+// Entries are found through an open-addressing table of entry indices,
+// hashed like interned strings. A hash of a string can be extended to the
+// left one character at a time, which makes looking up every suffix of a
+// string cheap.
+
+#define STRING_POOL_HASH_MASK 16777215
+#define STRING_POOL_NO_SLOT 0
+
+struct StringPool {
+    Vec(String) * strings;
+    Vec(size_t) * lengths;
+    Vec(size_t) * hashes;
+    Vec(size_t) * parents; // Itself if the entry is not merged
+    Vec(size_t) * offsets; // Offset in the parent
+
+    size_t *slots; // Entry index + 1, or STRING_POOL_NO_SLOT
+    size_t capacity;
+};
+
+static size_t StringPool_hash(const char *s, size_t len) {
+    assert(s);
+
+    size_t h = 0;
+    for (size_t i = 0; i < len; i = i + 1) {
+        h = (h * 31 + (s[i] & 255)) & STRING_POOL_HASH_MASK;
+    }
+
+    return h;
+}
+
+static size_t *StringPool_new_slots(size_t capacity) {
+    size_t *slots = malloc(sizeof(size_t) * capacity);
+    TimeReport_allocate(sizeof(size_t) * capacity);
+    for (size_t i = 0; i < capacity; i = i + 1) {
+        slots[i] = STRING_POOL_NO_SLOT;
+    }
+
+    return slots;
+}
+
+StringPool *StringPool_new(void) {
+    StringPool *pool = malloc(sizeof(StringPool));
+    pool->strings = Vec_new(String)();
+    pool->lengths = Vec_new(size_t)();
+    pool->hashes = Vec_new(size_t)();
+    pool->parents = Vec_new(size_t)();
+    pool->offsets = Vec_new(size_t)();
+    pool->capacity = 64;
+    pool->slots = StringPool_new_slots(pool->capacity);
+
+    return pool;
+}
+
+void StringPool_delete(StringPool *pool) {
+    assert(pool);
+
+    Vec_delete(String)(pool->strings);
+    Vec_delete(size_t)(pool->lengths);
+    Vec_delete(size_t)(pool->hashes);
+    Vec_delete(size_t)(pool->parents);
+    Vec_delete(size_t)(pool->offsets);
+    free(pool->slots);
+    free(pool);
+}
+
+// Returns the slot of the entry equal to the string, or the empty slot where
+// it would be
+static size_t StringPool_find_slot(
+    const StringPool *pool, const char *s, size_t len, size_t hash) {
+    assert(pool);
+    assert(s);
+
+    size_t i = hash & (pool->capacity - 1);
+
+    while (pool->slots[i] != STRING_POOL_NO_SLOT) {
+        size_t entry = pool->slots[i] - 1;
+
+        if (Vec_get(size_t)(pool->hashes, entry) == hash &&
+            Vec_get(size_t)(pool->lengths, entry) == len &&
+            memcmp(Vec_get(String)(pool->strings, entry), s, len) == 0) {
+            return i;
+        }
+
+        i = (i + 1) & (pool->capacity - 1);
+    }
+
+    return i;
+}
+
+static void StringPool_grow(StringPool *pool) {
+    assert(pool);
+
+    size_t *old_slots = pool->slots;
+    size_t old_capacity = pool->capacity;
+
+    pool->capacity = pool->capacity * 2;
+    pool->slots = StringPool_new_slots(pool->capacity);
+
+    for (size_t i = 0; i < old_capacity; i = i + 1) {
+        if (old_slots[i] != STRING_POOL_NO_SLOT) {
+            size_t entry = old_slots[i] - 1;
+            size_t j = Vec_get(size_t)(pool->hashes, entry) &
+                       (pool->capacity - 1);
+
+            while (pool->slots[j] != STRING_POOL_NO_SLOT) {
+                j = (j + 1) & (pool->capacity - 1);
+            }
+
+            pool->slots[j] = old_slots[i];
+        }
+    }
+
+    free(old_slots);
+}
+
+size_t StringPool_add(StringPool *pool, const char *s, size_t len) {
+    assert(pool);
+    assert(s);
+
+    size_t hash = StringPool_hash(s, len);
+    size_t slot = StringPool_find_slot(pool, s, len, hash);
+
+    if (pool->slots[slot] != STRING_POOL_NO_SLOT) {
+        return pool->slots[slot] - 1;
+    }
+
+    size_t entry = Vec_len(String)(pool->strings);
+
+    Vec_push(String)(pool->strings, s);
+    Vec_push(size_t)(pool->lengths, len);
+    Vec_push(size_t)(pool->hashes, hash);
+    Vec_push(size_t)(pool->parents, entry);
+    Vec_push(size_t)(pool->offsets, 0);
+    pool->slots[slot] = entry + 1;
+
+    // Keep the load factor at most 1/2
+    if ((entry + 1) * 2 > pool->capacity) {
+        StringPool_grow(pool);
+    }
+
+    return entry;
+}
+
+size_t StringPool_len(const StringPool *pool) {
+    assert(pool);
+
+    return Vec_len(String)(pool->strings);
+}
+
+const char *StringPool_string(const StringPool *pool, size_t entry) {
+    assert(pool);
+
+    return Vec_get(String)(pool->strings, entry);
+}
+
+size_t StringPool_length(const StringPool *pool, size_t entry) {
+    assert(pool);
+
+    return Vec_get(size_t)(pool->lengths, entry);
+}
+
+bool StringPool_has_nul(const StringPool *pool, size_t entry) {
+    assert(pool);
+
+    const char *s = Vec_get(String)(pool->strings, entry);
+    size_t len = Vec_get(size_t)(pool->lengths, entry);
+
+    for (size_t i = 0; i < len; i = i + 1) {
+        if (s[i] == '\0') {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Looks up every suffix of the entry, from the shortest, which is the empty
+// string before the terminating NUL
+static void StringPool_merge_suffixes_of(StringPool *pool, size_t entry) {
+    assert(pool);
+
+    const char *s = StringPool_string(pool, entry);
+    size_t len = StringPool_length(pool, entry);
+    size_t hash = 0;
+    size_t power = 1;
+    size_t k = len;
+
+    while (k > 0) {
+        size_t slot = StringPool_find_slot(pool, &s[k], len - k, hash);
+        size_t suffix = pool->slots[slot];
+
+        if (suffix != STRING_POOL_NO_SLOT) {
+            suffix = suffix - 1;
+
+            if (Vec_get(size_t)(pool->parents, suffix) == suffix &&
+                !StringPool_has_nul(pool, suffix)) {
+                Vec_set(size_t)(pool->parents, suffix, entry);
+                Vec_set(size_t)(pool->offsets, suffix, k);
+            }
+        }
+
+        k = k - 1;
+        hash = (hash + (s[k] & 255) * power) & STRING_POOL_HASH_MASK;
+        power = (power * 31) & STRING_POOL_HASH_MASK;
+    }
+}
+
+void StringPool_merge_suffixes(StringPool *pool) {
+    assert(pool);
+
+    for (size_t entry = 0; entry < StringPool_len(pool); entry = entry + 1) {
+        if (!StringPool_has_nul(pool, entry)) {
+            StringPool_merge_suffixes_of(pool, entry);
+        }
+    }
+}
+
+size_t StringPool_root(const StringPool *pool, size_t entry, size_t *offset) {
+    assert(pool);
+    assert(offset);
+
+    *offset = 0;
+
+    while (Vec_get(size_t)(pool->parents, entry) != entry) {
+        *offset = *offset + Vec_get(size_t)(pool->offsets, entry);
+        entry = Vec_get(size_t)(pool->parents, entry);
+    }
+
+    return entry;
+}
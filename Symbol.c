@@ -4,6 +4,7 @@ Symbol *Symbol_new(const char *name, StorageClass storage_class, Type *type) {
     assert(type);
 
     Symbol *s = malloc(sizeof(Symbol));
+    TimeReport_allocate(sizeof(Symbol));
     s->name = name;
     s->storage_class = storage_class;
     s->type = type;
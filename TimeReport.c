@@ -0,0 +1,243 @@
+#include "mocc.h"
+
+// Each phase is charged for the time from when it is entered, or resumed
+// when a nested phase ends, to when it is left, or suspended by a nested
+// phase. The stack of phases is only changed by the main thread; worker
+// threads allocate on behalf of whatever phase it is in. Only the
+// allocations mocc reports through TimeReport_allocate are counted, not
+// every call to malloc.
+
+#ifndef MOCC
+#include <stdint.h>
+#include <time.h>
+
+#define TIME_REPORT_MAX_DEPTH 16
+
+static const char *TimeReport_names[TimeReportPhase_count] = {
+    "other",
+    "read",
+    "lex",
+    "preprocess",
+    "expand",
+    "parse",
+    "codegen",
+    "assemble",
+};
+
+static const char *TimeReport_labels[TimeReportPhase_count] = {
+    "other",
+    "file reading",
+    "lexing",
+    "preprocessing",
+    "macro expansion",
+    "parsing and sema",
+    "code generation",
+    "assembly",
+};
+
+typedef struct TimeReportCounters {
+    int64_t wall_ns;
+    int64_t cpu_ns;
+    int64_t allocations;
+    int64_t bytes;
+} TimeReportCounters;
+
+static bool TimeReport_enabled;
+static TimeReportCounters TimeReport_counters[TimeReportPhase_count];
+static TimeReportPhase TimeReport_stack[TIME_REPORT_MAX_DEPTH];
+static int TimeReport_depth;
+static int TimeReport_current; // Read by every allocating thread
+static int64_t TimeReport_last_wall_ns;
+static int64_t TimeReport_last_cpu_ns;
+static int64_t TimeReport_start_wall_ns;
+static int64_t TimeReport_start_cpu_ns;
+
+static int64_t TimeReport_now_ns(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Charges the time since the last switch to the phase on the top
+static void TimeReport_charge(void) {
+    int64_t wall_ns = TimeReport_now_ns(CLOCK_MONOTONIC);
+    int64_t cpu_ns = TimeReport_now_ns(CLOCK_PROCESS_CPUTIME_ID);
+    TimeReportCounters *c =
+        &TimeReport_counters[TimeReport_stack[TimeReport_depth - 1]];
+
+    c->wall_ns = c->wall_ns + (wall_ns - TimeReport_last_wall_ns);
+    c->cpu_ns = c->cpu_ns + (cpu_ns - TimeReport_last_cpu_ns);
+
+    TimeReport_last_wall_ns = wall_ns;
+    TimeReport_last_cpu_ns = cpu_ns;
+}
+
+static void TimeReport_set_current(void) {
+    __atomic_store_n(
+        &TimeReport_current,
+        (int)TimeReport_stack[TimeReport_depth - 1],
+        __ATOMIC_RELAXED);
+}
+
+void TimeReport_enable(void) {
+    assert(!TimeReport_enabled);
+
+    TimeReport_stack[0] = TimeReportPhase_other;
+    TimeReport_depth = 1;
+    TimeReport_set_current();
+
+    TimeReport_start_wall_ns = TimeReport_now_ns(CLOCK_MONOTONIC);
+    TimeReport_start_cpu_ns = TimeReport_now_ns(CLOCK_PROCESS_CPUTIME_ID);
+    TimeReport_last_wall_ns = TimeReport_start_wall_ns;
+    TimeReport_last_cpu_ns = TimeReport_start_cpu_ns;
+
+    TimeReport_enabled = true;
+}
+
+bool TimeReport_is_enabled(void) {
+    return TimeReport_enabled;
+}
+
+void TimeReport_begin(TimeReportPhase phase) {
+    if (!TimeReport_enabled) {
+        return;
+    }
+
+    assert(TimeReport_depth < TIME_REPORT_MAX_DEPTH);
+
+    TimeReport_charge();
+    TimeReport_stack[TimeReport_depth] = phase;
+    TimeReport_depth = TimeReport_depth + 1;
+    TimeReport_set_current();
+}
+
+void TimeReport_end(TimeReportPhase phase) {
+    if (!TimeReport_enabled) {
+        return;
+    }
+
+    assert(TimeReport_depth > 1);
+    assert(TimeReport_stack[TimeReport_depth - 1] == phase);
+    (void)phase;
+
+    TimeReport_charge();
+    TimeReport_depth = TimeReport_depth - 1;
+    TimeReport_set_current();
+}
+
+static double TimeReport_ms(int64_t ns) {
+    return (double)ns / 1000000.0;
+}
+
+void TimeReport_print(bool json) {
+    assert(TimeReport_enabled);
+
+    FILE *fp = stderr;
+
+    TimeReport_charge();
+
+    TimeReportCounters total;
+    total.wall_ns = TimeReport_last_wall_ns - TimeReport_start_wall_ns;
+    total.cpu_ns = TimeReport_last_cpu_ns - TimeReport_start_cpu_ns;
+    total.allocations = 0;
+    total.bytes = 0;
+
+    for (int i = 0; i < TimeReportPhase_count; i = i + 1) {
+        total.allocations =
+            total.allocations + TimeReport_counters[i].allocations;
+        total.bytes = total.bytes + TimeReport_counters[i].bytes;
+    }
+
+    if (json) {
+        fprintf(fp, "{\"phases\": [");
+    } else {
+        fprintf(
+            fp,
+            "%-18s %12s %12s %12s %14s\n",
+            "phase",
+            "wall (ms)",
+            "cpu (ms)",
+            "allocations",
+            "bytes");
+    }
+
+    for (int i = 0; i <= TimeReportPhase_count; i = i + 1) {
+        const TimeReportCounters *c = &total;
+        const char *name = "total";
+        const char *label = "total";
+
+        if (i < TimeReportPhase_count) {
+            c = &TimeReport_counters[i];
+            name = TimeReport_names[i];
+            label = TimeReport_labels[i];
+        }
+
+        if (json && i < TimeReportPhase_count) {
+            if (i > 0) {
+                fprintf(fp, ", ");
+            }
+
+            fprintf(
+                fp,
+                "{\"name\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, "
+                "\"allocations\": %lld, \"bytes\": %lld}",
+                name,
+                TimeReport_ms(c->wall_ns),
+                TimeReport_ms(c->cpu_ns),
+                (long long)c->allocations,
+                (long long)c->bytes);
+        } else if (json) {
+            fprintf(
+                fp,
+                "], \"total\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f, "
+                "\"allocations\": %lld, \"bytes\": %lld}}\n",
+                TimeReport_ms(c->wall_ns),
+                TimeReport_ms(c->cpu_ns),
+                (long long)c->allocations,
+                (long long)c->bytes);
+        } else {
+            fprintf(
+                fp,
+                "%-18s %12.3f %12.3f %12lld %14lld\n",
+                label,
+                TimeReport_ms(c->wall_ns),
+                TimeReport_ms(c->cpu_ns),
+                (long long)c->allocations,
+                (long long)c->bytes);
+        }
+    }
+}
+
+void TimeReport_allocate(size_t size) {
+    if (!TimeReport_enabled) {
+        return;
+    }
+
+    TimeReportCounters *c = &TimeReport_counters[__atomic_load_n(
+        &TimeReport_current, __ATOMIC_RELAXED)];
+
+    __atomic_fetch_add(&c->allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->bytes, (int64_t)size, __ATOMIC_RELAXED);
+}
+#else
+void TimeReport_enable(void) {
+    ERROR("--time-report is not supported\n");
+}
+
+bool TimeReport_is_enabled(void) {
+    return false;
+}
+
+void TimeReport_begin(TimeReportPhase phase) {
+}
+
+void TimeReport_end(TimeReportPhase phase) {
+}
+
+void TimeReport_print(bool json) {
+}
+
+void TimeReport_allocate(size_t size) {
+}
+#endif
@@ -0,0 +1,61 @@
+#include "mocc.h"
+
+// Exactly one of `tokens` and `pp` is set
+struct TokenSource {
+    const Vec(Token) * tokens;
+    size_t cursor;
+    Preprocessor *pp;
+};
+
+TokenSource *TokenSource_from_vec(const Vec(Token) * tokens) {
+    assert(tokens);
+    assert(Vec_len(Token)(tokens) > 0);
+
+    TokenSource *source = malloc(sizeof(TokenSource));
+    source->tokens = tokens;
+    source->cursor = 0;
+    source->pp = NULL;
+
+    return source;
+}
+
+TokenSource *TokenSource_from_preprocessor(Preprocessor *pp) {
+    assert(pp);
+
+    TokenSource *source = malloc(sizeof(TokenSource));
+    source->tokens = NULL;
+    source->cursor = 0;
+    source->pp = pp;
+
+    return source;
+}
+
+Token *TokenSource_next(TokenSource *source) {
+    assert(source);
+
+    if (source->pp) {
+        return Preprocessor_next(source->pp);
+    }
+
+    Token *t = Vec_get(Token)(source->tokens, source->cursor);
+    if (t->kind != '\0') {
+        source->cursor = source->cursor + 1;
+    }
+
+    return t;
+}
+
+Vec(Token) * TokenSource_read_all(TokenSource *source) {
+    assert(source);
+
+    Vec(Token) *tokens = Vec_new(Token)();
+    Token *t = TokenSource_next(source);
+
+    while (t->kind != '\0') {
+        Vec_push(Token)(tokens, t);
+        t = TokenSource_next(source);
+    }
+
+    Vec_push(Token)(tokens, t);
+    return tokens;
+}
@@ -0,0 +1,240 @@
+#include "mocc.h"
+
+// A token stream is a binary file with:
+//
+//  - a magic string and a version,
+//  - a table of the distinct token spellings,
+//  - the tokens, each as its kind and flags packed into an int, followed
+//    by the index of its spelling, and by the decoded contents of character
+//    and string literals.
+
+#define TOKEN_STREAM_MAGIC "mocc-tok"
+#define TOKEN_STREAM_VERSION 1
+
+// Token flags, below the kind
+#define TOKEN_STREAM_IS_BOL 1
+#define TOKEN_STREAM_HAS_SPACES 2
+#define TOKEN_STREAM_HAS_STRING 4
+#define TOKEN_STREAM_NUM_FLAGS 8
+
+// Indices of the spellings, looked up by the hash stored in the interner
+typedef struct TokenStreamTable {
+    const char **texts;
+    size_t *indices;
+    size_t len;
+    size_t cap;
+} TokenStreamTable;
+
+static void
+TokenStreamTable_init(TokenStreamTable *table, size_t num_tokens) {
+    assert(table);
+
+    table->len = 0;
+    table->cap = 8;
+    while (table->cap < num_tokens * 2) {
+        table->cap = table->cap * 2;
+    }
+
+    table->texts = malloc(sizeof(const char *) * table->cap);
+    table->indices = malloc(sizeof(size_t) * table->cap);
+
+    for (size_t i = 0; i < table->cap; i = i + 1) {
+        table->texts[i] = NULL;
+    }
+}
+
+// Returns the index of `text`, registering it if it is new
+static size_t TokenStreamTable_index(
+    TokenStreamTable *table, Vec(String) * texts, const char *text) {
+    assert(table);
+    assert(texts);
+    assert(text);
+
+    size_t i = Intern_hash(text) & (table->cap - 1);
+
+    while (table->texts[i]) {
+        if (table->texts[i] == text) {
+            return table->indices[i];
+        }
+
+        i = (i + 1) & (table->cap - 1);
+    }
+
+    // The table has room for every token, so it never needs to grow
+    table->texts[i] = text;
+    table->indices[i] = table->len;
+    table->len = table->len + 1;
+    Vec_push(String)(texts, text);
+
+    return table->indices[i];
+}
+
+static int TokenStream_flags(const Token *t) {
+    assert(t);
+
+    int flags = 0;
+    if (t->is_bol) {
+        flags = flags + TOKEN_STREAM_IS_BOL;
+    }
+    if (t->has_spaces) {
+        flags = flags + TOKEN_STREAM_HAS_SPACES;
+    }
+    if (t->string) {
+        flags = flags + TOKEN_STREAM_HAS_STRING;
+    }
+
+    return flags;
+}
+
+void TokenStream_write(BinaryWriter *w, const Vec(Token) * tokens) {
+    assert(w);
+    assert(tokens);
+
+    size_t num_tokens = Vec_len(Token)(tokens);
+
+    TokenStreamTable table;
+    TokenStreamTable_init(&table, num_tokens);
+
+    Vec(String) *texts = Vec_new(String)();
+    Vec(size_t) *text_indices = Vec_new(size_t)();
+
+    for (size_t i = 0; i < num_tokens; i = i + 1) {
+        const char *text = Vec_get(Token)(tokens, i)->text;
+
+        Vec_push(size_t)(
+            text_indices, TokenStreamTable_index(&table, texts, text));
+    }
+
+    BinaryWriter_write_string(w, TOKEN_STREAM_MAGIC);
+    BinaryWriter_write_int(w, TOKEN_STREAM_VERSION);
+
+    BinaryWriter_write_int(w, Vec_len(String)(texts));
+    for (size_t i = 0; i < Vec_len(String)(texts); i = i + 1) {
+        BinaryWriter_write_string(w, Vec_get(String)(texts, i));
+    }
+
+    BinaryWriter_write_int(w, num_tokens);
+    for (size_t i = 0; i < num_tokens; i = i + 1) {
+        const Token *t = Vec_get(Token)(tokens, i);
+
+        BinaryWriter_write_int(
+            w, t->kind * TOKEN_STREAM_NUM_FLAGS + TokenStream_flags(t));
+        BinaryWriter_write_int(w, Vec_get(size_t)(text_indices, i));
+
+        if (t->string) {
+            BinaryWriter_write_int(w, t->string_len);
+            BinaryWriter_write_bytes(w, t->string, t->string_len);
+        }
+    }
+
+    free(table.texts);
+    free(table.indices);
+}
+
+bool TokenStream_is_binary(const char *data, size_t size) {
+    assert(data);
+
+    size_t magic_len = strlen(TOKEN_STREAM_MAGIC);
+    if (size < 4 + magic_len) {
+        return false;
+    }
+
+    BinaryReader *r = BinaryReader_new(data, size);
+    bool is_binary = (size_t)BinaryReader_read_int(r) == magic_len &&
+                     memcmp(
+                         BinaryReader_read_bytes(r, magic_len),
+                         TOKEN_STREAM_MAGIC,
+                         magic_len) == 0;
+
+    free(r);
+    return is_binary;
+}
+
+Vec(Token) * TokenStream_read(const char *data, size_t size) {
+    assert(data);
+    assert(TokenStream_is_binary(data, size));
+
+    BinaryReader *r = BinaryReader_new(data, size);
+
+    BinaryReader_read_string(r);
+    if (BinaryReader_read_int(r) != TOKEN_STREAM_VERSION) {
+        ERROR("token stream is written by another version\n");
+    }
+
+    size_t num_texts = BinaryReader_read_int(r);
+    Vec(String) *texts = Vec_new(String)();
+
+    Vec_reserve(String)(texts, num_texts);
+    for (size_t i = 0; i < num_texts; i = i + 1) {
+        Vec_push(String)(texts, BinaryReader_read_string(r));
+    }
+
+    size_t num_tokens = BinaryReader_read_int(r);
+    Vec(Token) *tokens = Vec_new(Token)();
+
+    // Tokens are allocated at once, since they live as long as the stream
+    Token *buffer = malloc(sizeof(Token) * num_tokens);
+    TimeReport_allocate(sizeof(Token) * num_tokens);
+    Vec_reserve(Token)(tokens, num_tokens);
+
+    for (size_t i = 0; i < num_tokens; i = i + 1) {
+        Token *t = &buffer[i];
+        int kind_and_flags = BinaryReader_read_int(r);
+        int flags = kind_and_flags % TOKEN_STREAM_NUM_FLAGS;
+        size_t text_index = BinaryReader_read_int(r);
+
+        if (text_index >= num_texts) {
+            ERROR("invalid text index %zu in token stream\n", text_index);
+        }
+
+        t->kind = kind_and_flags / TOKEN_STREAM_NUM_FLAGS;
+        t->is_bol = (flags & TOKEN_STREAM_IS_BOL) != 0;
+        t->has_spaces = (flags & TOKEN_STREAM_HAS_SPACES) != 0;
+        t->text = Vec_get(String)(texts, text_index);
+        t->source = t->text;
+        t->offset = 0;
+        t->length = Intern_length(t->text);
+        t->string = NULL;
+        t->string_len = 0;
+        t->hidden_set = NULL;
+
+        if ((flags & TOKEN_STREAM_HAS_STRING) != 0) {
+            // The contents stay in the file buffer, which is never released
+            t->string_len = BinaryReader_read_int(r);
+            t->string = BinaryReader_read_bytes(r, t->string_len);
+        }
+
+        Vec_push(Token)(tokens, t);
+    }
+
+    if (!BinaryReader_at_end(r)) {
+        ERROR("extra data at the end of token stream\n");
+    }
+
+    if (num_tokens == 0 ||
+        Vec_get(Token)(tokens, num_tokens - 1)->kind != '\0') {
+        ERROR("token stream does not end with EOF\n");
+    }
+
+    free(r);
+    return tokens;
+}
+
+void TokenStream_print(const Vec(Token) * tokens, FILE *fp) {
+    assert(tokens);
+    assert(fp);
+
+    for (size_t i = 0; i < Vec_len(Token)(tokens); i = i + 1) {
+        const Token *t = Vec_get(Token)(tokens, i);
+
+        if (t->is_bol && i > 0) {
+            fprintf(fp, "\n");
+        } else if (t->has_spaces) {
+            fprintf(fp, " ");
+        }
+
+        fprintf(fp, "%s", t->text);
+    }
+
+    fprintf(fp, "\n");
+}
@@ -2,6 +2,7 @@
 
 static Type *Type_new(TypeKind kind) {
     Type *t = malloc(sizeof(Type));
+    TimeReport_allocate(sizeof(Type));
     t->kind = kind;
     t->pointee_type = NULL;
     t->return_type = NULL;
@@ -128,6 +129,7 @@ StructType_find_member(const Type *struct_type, const char *member_name) {
     assert(struct_type->kind == TypeKind_struct);
     assert(StructType_is_defined(struct_type));
     assert(member_name);
+    assert(Intern_string(member_name) == member_name);
 
     assert(struct_type->member_symbols);
 
@@ -136,7 +138,7 @@ StructType_find_member(const Type *struct_type, const char *member_name) {
         Symbol *symbol = Vec_get(Symbol)(struct_type->member_symbols, i);
         assert(symbol->name);
 
-        if (strcmp(symbol->name, member_name) == 0) {
+        if (symbol->name == member_name) {
             return symbol;
         }
     }
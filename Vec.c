@@ -3,12 +3,13 @@
 VEC_DEFINE(String)
 VEC_DEFINE(size_t)
 VEC_DEFINE(Token)
-VEC_DEFINE(Macro)
 VEC_DEFINE(Type)
 VEC_DEFINE(Symbol)
+VEC_DEFINE(Macro)
 VEC_DEFINE(ExprNode)
 VEC_DEFINE(StmtNode)
 VEC_DEFINE(DeclaratorNode)
 VEC_DEFINE(DeclNode)
 VEC_DEFINE(MemberDeclNode)
 VEC_DEFINE(EnumeratorDeclNode)
+VEC_DEFINE(AssemblerSymbol)
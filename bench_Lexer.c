@@ -0,0 +1,44 @@
+#include "mocc.h"
+
+#include <time.h>
+
+#define BENCH_LEXER_NUM_LINES 100000
+
+static double bench_Lexer_elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void bench_Lexer(void) {
+    // Generated code with deep indentation, long names and long literals
+    const char *line = "                "
+                       "some_long_identifier_name_%d = 1234567890 + "
+                       "\"a fairly long string literal without escapes\";\n";
+    size_t size = (strlen(line) + 16) * BENCH_LEXER_NUM_LINES + 1;
+    char *text = malloc(sizeof(char) * size);
+
+    size_t len = 0;
+    for (int i = 0; i < BENCH_LEXER_NUM_LINES; i = i + 1) {
+        len = len + sprintf(&text[len], line, i);
+    }
+
+    ScanLevel max_level = Scan_max_level();
+    const char *level_names[] = {"scalar", "sse2", "avx2"};
+
+    for (int level = ScanLevel_scalar; level <= (int)max_level; level++) {
+        Scan_set_level((ScanLevel)level);
+
+        clock_t start = clock();
+        Vec(Token) *tokens = Lexer_read_all(Lexer_new("bench_Lexer", text));
+        double ms = bench_Lexer_elapsed_ms(start);
+
+        printf(
+            "bench_Lexer: lex %zu bytes (%zu tokens) with %s: %.3f ms\n",
+            len,
+            Vec_len(Token)(tokens),
+            level_names[level],
+            ms);
+    }
+
+    Scan_set_level(max_level);
+    free(text);
+}
@@ -0,0 +1,52 @@
+#include "mocc.h"
+
+#include <time.h>
+
+#define BENCH_PREPROCESSOR_MACRO_TOKENS 10000
+#define BENCH_PREPROCESSOR_NUM_EXPANSIONS 100
+
+static double bench_Preprocessor_elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void bench_Preprocessor(void) {
+    // #define BIG x x x ... x
+    // BIG BIG ... BIG
+    size_t size = 16 + BENCH_PREPROCESSOR_MACRO_TOKENS * 2 +
+                  BENCH_PREPROCESSOR_NUM_EXPANSIONS * 4;
+    char *text = malloc(sizeof(char) * size);
+
+    size_t len = 0;
+    len = len + sprintf(&text[len], "#define BIG");
+    for (int i = 0; i < BENCH_PREPROCESSOR_MACRO_TOKENS; i = i + 1) {
+        len = len + sprintf(&text[len], " x");
+    }
+    len = len + sprintf(&text[len], "\n");
+    for (int i = 0; i < BENCH_PREPROCESSOR_NUM_EXPANSIONS; i = i + 1) {
+        len = len + sprintf(&text[len], "BIG ");
+    }
+
+    Vec(String) *include_paths = Vec_new(String)();
+
+    clock_t start = clock();
+    Vec(Token) *tokens =
+        Preprocessor_read(include_paths, "bench_Preprocessor", text);
+    double expand_ms = bench_Preprocessor_elapsed_ms(start);
+
+    size_t expected_len =
+        BENCH_PREPROCESSOR_MACRO_TOKENS * BENCH_PREPROCESSOR_NUM_EXPANSIONS + 1;
+    if (Vec_len(Token)(tokens) != expected_len) {
+        ERROR(
+            "bench_Preprocessor: expected %zu tokens, actual %zu\n",
+            expected_len,
+            Vec_len(Token)(tokens));
+    }
+
+    printf(
+        "bench_Preprocessor: expand a %d-token macro %d times: %.3f ms\n",
+        BENCH_PREPROCESSOR_MACRO_TOKENS,
+        BENCH_PREPROCESSOR_NUM_EXPANSIONS,
+        expand_ms);
+
+    free(text);
+}
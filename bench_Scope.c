@@ -0,0 +1,62 @@
+#include "mocc.h"
+
+#include <time.h>
+
+#define BENCH_SCOPE_NUM_SYMBOLS 100000
+#define BENCH_SCOPE_DEPTH 16
+
+static double bench_Scope_elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void bench_Scope(void) {
+    const char **names = malloc(sizeof(const char *) * BENCH_SCOPE_NUM_SYMBOLS);
+    Symbol **symbols = malloc(sizeof(Symbol *) * BENCH_SCOPE_NUM_SYMBOLS);
+    Type *type = IntType_new();
+
+    for (int i = 0; i < BENCH_SCOPE_NUM_SYMBOLS; i = i + 1) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "symbol_%d", i);
+
+        names[i] = Intern_string(buffer);
+        symbols[i] = Symbol_new(names[i], StorageClass_none, type);
+    }
+
+    // Register every symbol in the global scope
+    Scope *global_scope = Scope_new(NULL);
+
+    clock_t start = clock();
+    for (int i = 0; i < BENCH_SCOPE_NUM_SYMBOLS; i = i + 1) {
+        if (!Scope_try_register(global_scope, symbols[i])) {
+            ERROR("bench_Scope: failed to register %s\n", names[i]);
+        }
+    }
+    double register_ms = bench_Scope_elapsed_ms(start);
+
+    // Look every symbol up from a nested block scope
+    Scope *scope = global_scope;
+    for (int i = 0; i < BENCH_SCOPE_DEPTH; i = i + 1) {
+        scope = Scope_new(scope);
+    }
+
+    start = clock();
+    for (int i = 0; i < BENCH_SCOPE_NUM_SYMBOLS; i = i + 1) {
+        if (Scope_find(scope, names[i], true) != symbols[i]) {
+            ERROR("bench_Scope: failed to find %s\n", names[i]);
+        }
+    }
+    double lookup_ms = bench_Scope_elapsed_ms(start);
+
+    printf(
+        "bench_Scope: register %d symbols: %.3f ms\n",
+        BENCH_SCOPE_NUM_SYMBOLS,
+        register_ms);
+    printf(
+        "bench_Scope: look up %d symbols at depth %d: %.3f ms\n",
+        BENCH_SCOPE_NUM_SYMBOLS,
+        BENCH_SCOPE_DEPTH,
+        lookup_ms);
+
+    free(names);
+    free(symbols);
+}
@@ -0,0 +1,1742 @@
+int isspace(int c);
+int isdigit(int c);
+int isalpha(int c);
+int isalnum(int c);
+typedef int size_t;
+void *malloc(size_t size);
+void *realloc(void *ptr, size_t size);
+void free(void *ptr);
+void exit(int);
+int atoi(const char *s);
+typedef struct FILE FILE;
+FILE *fopen(const char *path, const char *mode);
+void fclose(FILE *fp);
+int fseek(FILE *fp, int off, int origin);
+int ftell(FILE *fp);
+size_t fread(void *buf, size_t size, size_t n, FILE *fp);
+size_t fwrite(const void *buf, size_t size, size_t n, FILE *fp);
+int fprintf(FILE *fp, const char *fmt, ...);
+int printf(const char *fmt, ...);
+int snprintf(char *buf, size_t size, const char *fmt, ...);
+int remove(const char *path);
+size_t strlen(const char *s);
+int strcmp(const char *s1, const char *s2);
+int strncmp(const char *s1, const char *s2, size_t n);
+char *strcpy(char *s1, const char *s2);
+char *strcat(char *s1, const char *s2);
+char *strdup(const char *s);
+char *strndup(const char *s, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+void *memcpy(void *s1, const void *s2, size_t n);
+typedef int bool;
+typedef struct Vec_String Vec_String; typedef const char * Vec_Element_String; Vec_String * Vec_new_String(void); size_t Vec_len_String(const Vec_String * v); Vec_Element_String * Vec_ptr_String(Vec_String * v); const Vec_Element_String * Vec_cptr_String(const Vec_String * v); Vec_Element_String Vec_get_String(const Vec_String * v, size_t i); void Vec_set_String(Vec_String * v, size_t i, Vec_Element_String x); void Vec_push_String(Vec_String * v, Vec_Element_String x); Vec_Element_String Vec_pop_String(Vec_String * v); void Vec_reserve_String(Vec_String * v, size_t cap); void Vec_resize_String(Vec_String * v, size_t len); void Vec_delete_String(Vec_String * v);
+typedef struct Vec_size_t Vec_size_t; typedef size_t Vec_Element_size_t; Vec_size_t * Vec_new_size_t(void); size_t Vec_len_size_t(const Vec_size_t * v); Vec_Element_size_t * Vec_ptr_size_t(Vec_size_t * v); const Vec_Element_size_t * Vec_cptr_size_t(const Vec_size_t * v); Vec_Element_size_t Vec_get_size_t(const Vec_size_t * v, size_t i); void Vec_set_size_t(Vec_size_t * v, size_t i, Vec_Element_size_t x); void Vec_push_size_t(Vec_size_t * v, Vec_Element_size_t x); Vec_Element_size_t Vec_pop_size_t(Vec_size_t * v); void Vec_reserve_size_t(Vec_size_t * v, size_t cap); void Vec_resize_size_t(Vec_size_t * v, size_t len); void Vec_delete_size_t(Vec_size_t * v);
+typedef struct Vec_Token Vec_Token; typedef struct Token * Vec_Element_Token; Vec_Token * Vec_new_Token(void); size_t Vec_len_Token(const Vec_Token * v); Vec_Element_Token * Vec_ptr_Token(Vec_Token * v); const Vec_Element_Token * Vec_cptr_Token(const Vec_Token * v); Vec_Element_Token Vec_get_Token(const Vec_Token * v, size_t i); void Vec_set_Token(Vec_Token * v, size_t i, Vec_Element_Token x); void Vec_push_Token(Vec_Token * v, Vec_Element_Token x); Vec_Element_Token Vec_pop_Token(Vec_Token * v); void Vec_reserve_Token(Vec_Token * v, size_t cap); void Vec_resize_Token(Vec_Token * v, size_t len); void Vec_delete_Token(Vec_Token * v);
+typedef struct Vec_Type Vec_Type; typedef struct Type * Vec_Element_Type; Vec_Type * Vec_new_Type(void); size_t Vec_len_Type(const Vec_Type * v); Vec_Element_Type * Vec_ptr_Type(Vec_Type * v); const Vec_Element_Type * Vec_cptr_Type(const Vec_Type * v); Vec_Element_Type Vec_get_Type(const Vec_Type * v, size_t i); void Vec_set_Type(Vec_Type * v, size_t i, Vec_Element_Type x); void Vec_push_Type(Vec_Type * v, Vec_Element_Type x); Vec_Element_Type Vec_pop_Type(Vec_Type * v); void Vec_reserve_Type(Vec_Type * v, size_t cap); void Vec_resize_Type(Vec_Type * v, size_t len); void Vec_delete_Type(Vec_Type * v);
+typedef struct Vec_Symbol Vec_Symbol; typedef struct Symbol * Vec_Element_Symbol; Vec_Symbol * Vec_new_Symbol(void); size_t Vec_len_Symbol(const Vec_Symbol * v); Vec_Element_Symbol * Vec_ptr_Symbol(Vec_Symbol * v); const Vec_Element_Symbol * Vec_cptr_Symbol(const Vec_Symbol * v); Vec_Element_Symbol Vec_get_Symbol(const Vec_Symbol * v, size_t i); void Vec_set_Symbol(Vec_Symbol * v, size_t i, Vec_Element_Symbol x); void Vec_push_Symbol(Vec_Symbol * v, Vec_Element_Symbol x); Vec_Element_Symbol Vec_pop_Symbol(Vec_Symbol * v); void Vec_reserve_Symbol(Vec_Symbol * v, size_t cap); void Vec_resize_Symbol(Vec_Symbol * v, size_t len); void Vec_delete_Symbol(Vec_Symbol * v);
+typedef struct Vec_Macro Vec_Macro; typedef struct Macro * Vec_Element_Macro; Vec_Macro * Vec_new_Macro(void); size_t Vec_len_Macro(const Vec_Macro * v); Vec_Element_Macro * Vec_ptr_Macro(Vec_Macro * v); const Vec_Element_Macro * Vec_cptr_Macro(const Vec_Macro * v); Vec_Element_Macro Vec_get_Macro(const Vec_Macro * v, size_t i); void Vec_set_Macro(Vec_Macro * v, size_t i, Vec_Element_Macro x); void Vec_push_Macro(Vec_Macro * v, Vec_Element_Macro x); Vec_Element_Macro Vec_pop_Macro(Vec_Macro * v); void Vec_reserve_Macro(Vec_Macro * v, size_t cap); void Vec_resize_Macro(Vec_Macro * v, size_t len); void Vec_delete_Macro(Vec_Macro * v);
+typedef struct Vec_ExprNode Vec_ExprNode; typedef struct ExprNode * Vec_Element_ExprNode; Vec_ExprNode * Vec_new_ExprNode(void); size_t Vec_len_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode * Vec_ptr_ExprNode(Vec_ExprNode * v); const Vec_Element_ExprNode * Vec_cptr_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode Vec_get_ExprNode(const Vec_ExprNode * v, size_t i); void Vec_set_ExprNode(Vec_ExprNode * v, size_t i, Vec_Element_ExprNode x); void Vec_push_ExprNode(Vec_ExprNode * v, Vec_Element_ExprNode x); Vec_Element_ExprNode Vec_pop_ExprNode(Vec_ExprNode * v); void Vec_reserve_ExprNode(Vec_ExprNode * v, size_t cap); void Vec_resize_ExprNode(Vec_ExprNode * v, size_t len); void Vec_delete_ExprNode(Vec_ExprNode * v);
+typedef struct Vec_StmtNode Vec_StmtNode; typedef struct StmtNode * Vec_Element_StmtNode; Vec_StmtNode * Vec_new_StmtNode(void); size_t Vec_len_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode * Vec_ptr_StmtNode(Vec_StmtNode * v); const Vec_Element_StmtNode * Vec_cptr_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode Vec_get_StmtNode(const Vec_StmtNode * v, size_t i); void Vec_set_StmtNode(Vec_StmtNode * v, size_t i, Vec_Element_StmtNode x); void Vec_push_StmtNode(Vec_StmtNode * v, Vec_Element_StmtNode x); Vec_Element_StmtNode Vec_pop_StmtNode(Vec_StmtNode * v); void Vec_reserve_StmtNode(Vec_StmtNode * v, size_t cap); void Vec_resize_StmtNode(Vec_StmtNode * v, size_t len); void Vec_delete_StmtNode(Vec_StmtNode * v);
+typedef struct Vec_DeclaratorNode Vec_DeclaratorNode; typedef struct DeclaratorNode * Vec_Element_DeclaratorNode; Vec_DeclaratorNode * Vec_new_DeclaratorNode(void); size_t Vec_len_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode * Vec_ptr_DeclaratorNode(Vec_DeclaratorNode * v); const Vec_Element_DeclaratorNode * Vec_cptr_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode Vec_get_DeclaratorNode(const Vec_DeclaratorNode * v, size_t i); void Vec_set_DeclaratorNode(Vec_DeclaratorNode * v, size_t i, Vec_Element_DeclaratorNode x); void Vec_push_DeclaratorNode(Vec_DeclaratorNode * v, Vec_Element_DeclaratorNode x); Vec_Element_DeclaratorNode Vec_pop_DeclaratorNode(Vec_DeclaratorNode * v); void Vec_reserve_DeclaratorNode(Vec_DeclaratorNode * v, size_t cap); void Vec_resize_DeclaratorNode(Vec_DeclaratorNode * v, size_t len); void Vec_delete_DeclaratorNode(Vec_DeclaratorNode * v);
+typedef struct Vec_DeclNode Vec_DeclNode; typedef struct DeclNode * Vec_Element_DeclNode; Vec_DeclNode * Vec_new_DeclNode(void); size_t Vec_len_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode * Vec_ptr_DeclNode(Vec_DeclNode * v); const Vec_Element_DeclNode * Vec_cptr_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode Vec_get_DeclNode(const Vec_DeclNode * v, size_t i); void Vec_set_DeclNode(Vec_DeclNode * v, size_t i, Vec_Element_DeclNode x); void Vec_push_DeclNode(Vec_DeclNode * v, Vec_Element_DeclNode x); Vec_Element_DeclNode Vec_pop_DeclNode(Vec_DeclNode * v); void Vec_reserve_DeclNode(Vec_DeclNode * v, size_t cap); void Vec_resize_DeclNode(Vec_DeclNode * v, size_t len); void Vec_delete_DeclNode(Vec_DeclNode * v);
+typedef struct Vec_MemberDeclNode Vec_MemberDeclNode; typedef struct MemberDeclNode * Vec_Element_MemberDeclNode; Vec_MemberDeclNode * Vec_new_MemberDeclNode(void); size_t Vec_len_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode * Vec_ptr_MemberDeclNode(Vec_MemberDeclNode * v); const Vec_Element_MemberDeclNode * Vec_cptr_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode Vec_get_MemberDeclNode(const Vec_MemberDeclNode * v, size_t i); void Vec_set_MemberDeclNode(Vec_MemberDeclNode * v, size_t i, Vec_Element_MemberDeclNode x); void Vec_push_MemberDeclNode(Vec_MemberDeclNode * v, Vec_Element_MemberDeclNode x); Vec_Element_MemberDeclNode Vec_pop_MemberDeclNode(Vec_MemberDeclNode * v); void Vec_reserve_MemberDeclNode(Vec_MemberDeclNode * v, size_t cap); void Vec_resize_MemberDeclNode(Vec_MemberDeclNode * v, size_t len); void Vec_delete_MemberDeclNode(Vec_MemberDeclNode * v);
+typedef struct Vec_EnumeratorDeclNode Vec_EnumeratorDeclNode; typedef struct EnumeratorDeclNode * Vec_Element_EnumeratorDeclNode; Vec_EnumeratorDeclNode * Vec_new_EnumeratorDeclNode(void); size_t Vec_len_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode * Vec_ptr_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); const Vec_Element_EnumeratorDeclNode * Vec_cptr_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode Vec_get_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v, size_t i); void Vec_set_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t i, Vec_Element_EnumeratorDeclNode x); void Vec_push_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, Vec_Element_EnumeratorDeclNode x); Vec_Element_EnumeratorDeclNode Vec_pop_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); void Vec_reserve_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t cap); void Vec_resize_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t len); void Vec_delete_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v);
+typedef struct Vec_AssemblerSymbol Vec_AssemblerSymbol; typedef struct AssemblerSymbol * Vec_Element_AssemblerSymbol; Vec_AssemblerSymbol * Vec_new_AssemblerSymbol(void); size_t Vec_len_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol * Vec_ptr_AssemblerSymbol(Vec_AssemblerSymbol * v); const Vec_Element_AssemblerSymbol * Vec_cptr_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol Vec_get_AssemblerSymbol(const Vec_AssemblerSymbol * v, size_t i); void Vec_set_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t i, Vec_Element_AssemblerSymbol x); void Vec_push_AssemblerSymbol(Vec_AssemblerSymbol * v, Vec_Element_AssemblerSymbol x); Vec_Element_AssemblerSymbol Vec_pop_AssemblerSymbol(Vec_AssemblerSymbol * v); void Vec_reserve_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t cap); void Vec_resize_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t len); void Vec_delete_AssemblerSymbol(Vec_AssemblerSymbol * v);
+typedef struct Map_Symbol Map_Symbol; typedef struct Symbol * Map_Element_Symbol; Map_Symbol * Map_new_Symbol(void); size_t Map_len_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_find_Symbol(const Map_Symbol * m, const char *key); bool Map_insert_Symbol(Map_Symbol * m, const char *key, Map_Element_Symbol x); bool Map_remove_Symbol(Map_Symbol * m, const char *key); size_t Map_cap_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_value_at_Symbol(const Map_Symbol * m, size_t i);
+typedef struct Map_Macro Map_Macro; typedef struct Macro * Map_Element_Macro; Map_Macro * Map_new_Macro(void); size_t Map_len_Macro(const Map_Macro * m); Map_Element_Macro Map_find_Macro(const Map_Macro * m, const char *key); bool Map_insert_Macro(Map_Macro * m, const char *key, Map_Element_Macro x); bool Map_remove_Macro(Map_Macro * m, const char *key); size_t Map_cap_Macro(const Map_Macro * m); Map_Element_Macro Map_value_at_Macro(const Map_Macro * m, size_t i);
+typedef struct Map_SourceFile Map_SourceFile; typedef struct SourceFile * Map_Element_SourceFile; Map_SourceFile * Map_new_SourceFile(void); size_t Map_len_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_find_SourceFile(const Map_SourceFile * m, const char *key); bool Map_insert_SourceFile(Map_SourceFile * m, const char *key, Map_Element_SourceFile x); bool Map_remove_SourceFile(Map_SourceFile * m, const char *key); size_t Map_cap_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_value_at_SourceFile(const Map_SourceFile * m, size_t i);
+typedef struct Map_String Map_String; typedef const char * Map_Element_String; Map_String * Map_new_String(void); size_t Map_len_String(const Map_String * m); Map_Element_String Map_find_String(const Map_String * m, const char *key); bool Map_insert_String(Map_String * m, const char *key, Map_Element_String x); bool Map_remove_String(Map_String * m, const char *key); size_t Map_cap_String(const Map_String * m); Map_Element_String Map_value_at_String(const Map_String * m, size_t i);
+typedef struct Map_AssemblerSymbol Map_AssemblerSymbol; typedef struct AssemblerSymbol * Map_Element_AssemblerSymbol; Map_AssemblerSymbol * Map_new_AssemblerSymbol(void); size_t Map_len_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_find_AssemblerSymbol(const Map_AssemblerSymbol * m, const char *key); bool Map_insert_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key, Map_Element_AssemblerSymbol x); bool Map_remove_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key); size_t Map_cap_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_value_at_AssemblerSymbol(const Map_AssemblerSymbol * m, size_t i);
+typedef struct Arena Arena;
+Arena *Arena_new(void);
+void Arena_delete(Arena *a);
+void *Arena_alloc(Arena *a, size_t size);
+void Arena_release(Arena *a);
+typedef struct ArenaMark {
+    struct ArenaChunk *chunk;
+    size_t used;
+    size_t num_allocations;
+    size_t allocated_bytes;
+} ArenaMark;
+void Arena_mark(const Arena *a, ArenaMark *mark);
+void Arena_reset(Arena *a, const ArenaMark *mark);
+size_t Arena_num_allocations(const Arena *a);
+size_t Arena_allocated_bytes(const Arena *a);
+size_t Arena_reserved_bytes(const Arena *a);
+const char *Intern_string(const char *s);
+const char *Intern_substring(const char *s, size_t len);
+size_t Intern_hash(const char *interned);
+size_t Intern_length(const char *interned);
+typedef struct HiddenSet HiddenSet;
+typedef struct HiddenSetTable HiddenSetTable;
+HiddenSetTable *HiddenSetTable_new(void);
+HiddenSet *HiddenSet_add(HiddenSetTable *t, HiddenSet *set, const char *name);
+bool HiddenSet_contains(const HiddenSet *set, const char *name);
+size_t HiddenSet_len(const HiddenSet *set);
+char *Path_join(const char *dir, const char *rel_path);
+char *Path_dir(const char *path);
+char *Path_base(const char *path);
+char *Path_normalize(const char *path);
+const char *File_read(const char *path);
+const char *File_read_with_size(const char *path, size_t *size);
+typedef struct BinaryWriter BinaryWriter;
+typedef struct BinaryReader BinaryReader;
+BinaryWriter *BinaryWriter_new(void);
+void BinaryWriter_delete(BinaryWriter *w);
+void BinaryWriter_write_byte(BinaryWriter *w, int byte);
+void BinaryWriter_write_int(BinaryWriter *w, int x);
+void BinaryWriter_patch_int(BinaryWriter *w, size_t pos, int x);
+void BinaryWriter_write_bytes(BinaryWriter *w, const char *s, size_t len);
+void BinaryWriter_write_string(BinaryWriter *w, const char *s);
+const char *BinaryWriter_data(const BinaryWriter *w);
+size_t BinaryWriter_len(const BinaryWriter *w);
+bool BinaryWriter_save(const BinaryWriter *w, const char *path);
+BinaryReader *BinaryReader_new(const char *data, size_t size);
+int BinaryReader_read_int(BinaryReader *r);
+const char *BinaryReader_read_bytes(BinaryReader *r, size_t len);
+const char *BinaryReader_read_string(BinaryReader *r);
+bool BinaryReader_at_end(const BinaryReader *r);
+typedef enum ValueCategory {
+    ValueCategory_lvalue,
+    ValueCategory_rvalue,
+} ValueCategory;
+typedef enum TypeKind {
+    TypeKind_void,
+    TypeKind_char,
+    TypeKind_int,
+    TypeKind_pointer,
+    TypeKind_function,
+    TypeKind_array,
+    TypeKind_struct,
+    TypeKind_enum,
+} TypeKind;
+typedef struct Type Type;
+struct Type {
+    TypeKind kind;
+    Type *pointee_type;
+    Type *return_type;
+    Vec_Type * parameter_types;
+    bool is_var_arg;
+    Type *element_type;
+    size_t array_length;
+    struct Symbol *struct_symbol;
+    Vec_MemberDeclNode * member_decls;
+    Vec_Symbol * member_symbols;
+    Type *underlying_type;
+    struct Symbol *enum_symbol;
+    Vec_EnumeratorDeclNode * enumerators;
+};
+Type *VoidType_new(void);
+Type *CharType_new(void);
+Type *IntType_new(void);
+Type *PointerType_new(Type *pointee_type);
+Type *PointerType_pointee_type(const Type *pointer_type);
+Type *FunctionType_new(
+    Type *return_type, Vec_Type * parameter_types, bool is_var_arg);
+Type *FunctionType_return_type(const Type *function_type);
+Vec_Type * FunctionType_parameter_types(const Type *function_type);
+bool FunctionType_is_var_arg(const Type *function_type);
+Type *ArrayType_new(Type *element_type, size_t array_length);
+Type *ArrayType_element_type(const Type *array_type);
+size_t ArrayType_length(const Type *array_type);
+Type *StructType_new(void);
+bool StructType_is_defined(const Type *struct_type);
+struct Symbol *
+StructType_find_member(const Type *struct_type, const char *member_name);
+Type *
+EnumType_new(Type *underlying_type, Vec_EnumeratorDeclNode * enumerators);
+size_t Type_sizeof(const Type *type);
+size_t Type_alignof(const Type *type);
+bool Type_equals(const Type *a, const Type *b);
+bool Type_is_scalar(const Type *type);
+bool Type_is_incomplete_type(const Type *type);
+bool Type_is_function_pointer_type(const Type *type);
+typedef int TokenKind;
+enum TokenKind {
+    TokenKind_unused = 256,
+TokenKind_identifier,
+TokenKind_number,
+TokenKind_character,
+TokenKind_string,
+TokenKind_kw_static,
+TokenKind_kw_typedef,
+TokenKind_kw_const,
+TokenKind_kw_void,
+TokenKind_kw_char,
+TokenKind_kw_int,
+TokenKind_kw_struct,
+TokenKind_kw_enum,
+TokenKind_kw_sizeof,
+TokenKind_kw_if,
+TokenKind_kw_else,
+TokenKind_kw_while,
+TokenKind_kw_do,
+TokenKind_kw_for,
+TokenKind_kw_break,
+TokenKind_kw_continue,
+TokenKind_kw_goto,
+TokenKind_kw_switch,
+TokenKind_kw_case,
+TokenKind_kw_default,
+TokenKind_kw_return,
+TokenKind_arrow,
+TokenKind_lesser_equal,
+TokenKind_greater_equal,
+TokenKind_equal,
+TokenKind_not_equal,
+TokenKind_and_and,
+TokenKind_or_or,
+TokenKind_dot_dot,
+TokenKind_var_arg,
+};
+typedef struct Token {
+    TokenKind kind;
+    bool is_bol;
+    bool has_spaces;
+    int string_len;
+    const char *text;
+    const char *source;
+    size_t offset;
+    size_t length;
+    const char *string;
+    HiddenSet *hidden_set;
+} Token;
+typedef enum StorageClass {
+    StorageClass_none,
+    StorageClass_static,
+    StorageClass_typedef,
+    StorageClass_enum,
+} StorageClass;
+typedef struct Symbol {
+    const char *name;
+    StorageClass storage_class;
+    Type *type;
+    int enum_value;
+    bool has_body;
+    struct NativeAddress *address;
+} Symbol;
+Symbol *Symbol_new(const char *name, StorageClass storage_class, Type *type);
+typedef struct Scope Scope;
+Scope *Scope_new(Scope *parent_scope);
+Scope *Scope_parent_scope(const Scope *s);
+Symbol *Scope_find(Scope *s, const char *name, bool recursive);
+bool Scope_try_register(Scope *s, Symbol *symbol);
+Vec_Symbol * Scope_symbols(const Scope *s);
+typedef enum NodeKind {
+NodeKind_IdentifierExpr,
+   
+
+NodeKind_EnumeratorExpr,
+   
+   
+
+NodeKind_IntegerExpr,
+   
+
+NodeKind_StringExpr,
+   
+   
+
+NodeKind_SubscriptExpr,
+   
+   
+
+NodeKind_CallExpr,
+   
+   
+
+NodeKind_DotExpr,
+   
+   
+
+NodeKind_ArrowExpr,
+   
+   
+
+NodeKind_SizeofExpr,
+   
+   
+
+NodeKind_CastExpr,
+   
+
+
+
+
+
+
+NodeKind_UnaryExpr,
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+NodeKind_BinaryExpr,
+   
+   
+   
+
+NodeKind_AssignExpr,
+   
+   
+
+NodeKind_ImplicitCastExpr,
+   
+   
+
+NodeKind_CompoundStmt,
+   
+
+NodeKind_IfStmt,
+   
+   
+   
+
+NodeKind_WhileStmt,
+   
+   
+
+NodeKind_ForStmt,
+   
+   
+   
+   
+
+NodeKind_ReturnStmt,
+   
+
+NodeKind_DeclStmt,
+   
+   
+
+NodeKind_ExprStmt,
+   
+
+NodeKind_AbstractDirectDeclarator,
+   
+
+NodeKind_DirectDeclarator,
+   
+   
+
+NodeKind_ArrayDeclarator,
+   
+   
+
+NodeKind_FunctionDeclarator,
+   
+   
+   
+
+NodeKind_PointerDeclarator,
+   
+
+NodeKind_InitDeclarator,
+   
+   
+
+NodeKind_GlobalDecl,
+   
+   
+
+NodeKind_FunctionDecl,
+   
+   
+   
+   
+
+NodeKind_MemberDecl,
+   
+   
+
+NodeKind_EnumeratorDecl,
+   
+   
+
+NodeKind_DeclSpec,
+   
+   
+
+NodeKind_TranslationUnit,
+   
+
+} NodeKind;
+typedef struct Node Node;
+typedef struct ExprNode ExprNode;
+typedef struct StmtNode StmtNode;
+typedef struct DeclaratorNode DeclaratorNode;
+typedef struct DeclNode DeclNode;
+typedef struct IdentifierExprNode IdentifierExprNode;
+   
+
+typedef struct EnumeratorExprNode EnumeratorExprNode;
+   
+   
+
+typedef struct IntegerExprNode IntegerExprNode;
+   
+
+typedef struct StringExprNode StringExprNode;
+   
+   
+
+typedef struct SubscriptExprNode SubscriptExprNode;
+   
+   
+
+typedef struct CallExprNode CallExprNode;
+   
+   
+
+typedef struct DotExprNode DotExprNode;
+   
+   
+
+typedef struct ArrowExprNode ArrowExprNode;
+   
+   
+
+typedef struct SizeofExprNode SizeofExprNode;
+   
+   
+
+typedef struct CastExprNode CastExprNode;
+   
+
+
+
+
+
+
+typedef struct UnaryExprNode UnaryExprNode;
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct BinaryExprNode BinaryExprNode;
+   
+   
+   
+
+typedef struct AssignExprNode AssignExprNode;
+   
+   
+
+typedef struct ImplicitCastExprNode ImplicitCastExprNode;
+   
+   
+
+typedef struct CompoundStmtNode CompoundStmtNode;
+   
+
+typedef struct IfStmtNode IfStmtNode;
+   
+   
+   
+
+typedef struct WhileStmtNode WhileStmtNode;
+   
+   
+
+typedef struct ForStmtNode ForStmtNode;
+   
+   
+   
+   
+
+typedef struct ReturnStmtNode ReturnStmtNode;
+   
+
+typedef struct DeclStmtNode DeclStmtNode;
+   
+   
+
+typedef struct ExprStmtNode ExprStmtNode;
+   
+
+typedef struct AbstractDirectDeclaratorNode AbstractDirectDeclaratorNode;
+   
+
+typedef struct DirectDeclaratorNode DirectDeclaratorNode;
+   
+   
+
+typedef struct ArrayDeclaratorNode ArrayDeclaratorNode;
+   
+   
+
+typedef struct FunctionDeclaratorNode FunctionDeclaratorNode;
+   
+   
+   
+
+typedef struct PointerDeclaratorNode PointerDeclaratorNode;
+   
+
+typedef struct InitDeclaratorNode InitDeclaratorNode;
+   
+   
+
+typedef struct GlobalDeclNode GlobalDeclNode;
+   
+   
+
+typedef struct FunctionDeclNode FunctionDeclNode;
+   
+   
+   
+   
+
+typedef struct MemberDeclNode MemberDeclNode;
+   
+   
+
+typedef struct EnumeratorDeclNode EnumeratorDeclNode;
+   
+   
+
+typedef struct DeclSpecNode DeclSpecNode;
+   
+   
+
+typedef struct TranslationUnitNode TranslationUnitNode;
+   
+
+struct Node {
+    NodeKind kind;
+};
+struct ExprNode {
+    NodeKind kind;
+    Type *result_type;
+    ValueCategory value_category;
+};
+struct StmtNode {
+    NodeKind kind;
+};
+struct DeclaratorNode {
+    NodeKind kind;
+};
+struct DeclNode {
+    NodeKind kind;
+};
+typedef enum UnaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+UnaryOp_positive,
+UnaryOp_negative,
+UnaryOp_not,
+UnaryOp_address_of,
+UnaryOp_indirection,
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} UnaryOp;
+typedef enum BinaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+BinaryOp_add,
+BinaryOp_sub,
+BinaryOp_mul,
+BinaryOp_div,
+BinaryOp_mod,
+BinaryOp_lesser_than,
+BinaryOp_lesser_equal,
+BinaryOp_greater_than,
+BinaryOp_greater_equal,
+BinaryOp_equal,
+BinaryOp_and,
+BinaryOp_not_equal,
+BinaryOp_logical_and,
+BinaryOp_logical_or,
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} BinaryOp;
+typedef enum ImplicitCastOp {
+    ImplicitCastOp_lvalue_to_rvalue,
+    ImplicitCastOp_function_to_function_pointer,
+    ImplicitCastOp_array_to_pointer,
+    ImplicitCastOp_integral_cast,
+    ImplicitCastOp_integer_to_pointer_cast,
+    ImplicitCastOp_pointer_to_pointer_cast,
+} ImplicitCastOp;
+Node *IdentifierExprNode_base_node(IdentifierExprNode *p); const Node *IdentifierExprNode_cbase_node(const IdentifierExprNode *p); ExprNode *IdentifierExprNode_base(IdentifierExprNode *p); const ExprNode *IdentifierExprNode_cbase(const IdentifierExprNode *p); IdentifierExprNode *IdentifierExprNode_cast_node(Node *p); const IdentifierExprNode *IdentifierExprNode_ccast_node(const Node *p); IdentifierExprNode *IdentifierExprNode_cast(ExprNode *p); const IdentifierExprNode *IdentifierExprNode_ccast(const ExprNode *p); struct IdentifierExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+};
+Node *EnumeratorExprNode_base_node(EnumeratorExprNode *p); const Node *EnumeratorExprNode_cbase_node(const EnumeratorExprNode *p); ExprNode *EnumeratorExprNode_base(EnumeratorExprNode *p); const ExprNode *EnumeratorExprNode_cbase(const EnumeratorExprNode *p); EnumeratorExprNode *EnumeratorExprNode_cast_node(Node *p); const EnumeratorExprNode *EnumeratorExprNode_ccast_node(const Node *p); EnumeratorExprNode *EnumeratorExprNode_cast(ExprNode *p); const EnumeratorExprNode *EnumeratorExprNode_ccast(const ExprNode *p); struct EnumeratorExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+    int value;
+};
+Node *IntegerExprNode_base_node(IntegerExprNode *p); const Node *IntegerExprNode_cbase_node(const IntegerExprNode *p); ExprNode *IntegerExprNode_base(IntegerExprNode *p); const ExprNode *IntegerExprNode_cbase(const IntegerExprNode *p); IntegerExprNode *IntegerExprNode_cast_node(Node *p); const IntegerExprNode *IntegerExprNode_ccast_node(const Node *p); IntegerExprNode *IntegerExprNode_cast(ExprNode *p); const IntegerExprNode *IntegerExprNode_ccast(const ExprNode *p); struct IntegerExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    int value;
+};
+Node *StringExprNode_base_node(StringExprNode *p); const Node *StringExprNode_cbase_node(const StringExprNode *p); ExprNode *StringExprNode_base(StringExprNode *p); const ExprNode *StringExprNode_cbase(const StringExprNode *p); StringExprNode *StringExprNode_cast_node(Node *p); const StringExprNode *StringExprNode_ccast_node(const Node *p); StringExprNode *StringExprNode_cast(ExprNode *p); const StringExprNode *StringExprNode_ccast(const ExprNode *p); struct StringExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    const char * value;
+    size_t length;
+};
+Node *SubscriptExprNode_base_node(SubscriptExprNode *p); const Node *SubscriptExprNode_cbase_node(const SubscriptExprNode *p); ExprNode *SubscriptExprNode_base(SubscriptExprNode *p); const ExprNode *SubscriptExprNode_cbase(const SubscriptExprNode *p); SubscriptExprNode *SubscriptExprNode_cast_node(Node *p); const SubscriptExprNode *SubscriptExprNode_ccast_node(const Node *p); SubscriptExprNode *SubscriptExprNode_cast(ExprNode *p); const SubscriptExprNode *SubscriptExprNode_ccast(const ExprNode *p); struct SubscriptExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * array;
+    ExprNode * index;
+};
+Node *CallExprNode_base_node(CallExprNode *p); const Node *CallExprNode_cbase_node(const CallExprNode *p); ExprNode *CallExprNode_base(CallExprNode *p); const ExprNode *CallExprNode_cbase(const CallExprNode *p); CallExprNode *CallExprNode_cast_node(Node *p); const CallExprNode *CallExprNode_ccast_node(const Node *p); CallExprNode *CallExprNode_cast(ExprNode *p); const CallExprNode *CallExprNode_ccast(const ExprNode *p); struct CallExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * callee;
+    Vec_ExprNode * arguments;
+};
+Node *DotExprNode_base_node(DotExprNode *p); const Node *DotExprNode_cbase_node(const DotExprNode *p); ExprNode *DotExprNode_base(DotExprNode *p); const ExprNode *DotExprNode_cbase(const DotExprNode *p); DotExprNode *DotExprNode_cast_node(Node *p); const DotExprNode *DotExprNode_ccast_node(const Node *p); DotExprNode *DotExprNode_cast(ExprNode *p); const DotExprNode *DotExprNode_ccast(const ExprNode *p); struct DotExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *ArrowExprNode_base_node(ArrowExprNode *p); const Node *ArrowExprNode_cbase_node(const ArrowExprNode *p); ExprNode *ArrowExprNode_base(ArrowExprNode *p); const ExprNode *ArrowExprNode_cbase(const ArrowExprNode *p); ArrowExprNode *ArrowExprNode_cast_node(Node *p); const ArrowExprNode *ArrowExprNode_ccast_node(const Node *p); ArrowExprNode *ArrowExprNode_cast(ExprNode *p); const ArrowExprNode *ArrowExprNode_ccast(const ExprNode *p); struct ArrowExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *SizeofExprNode_base_node(SizeofExprNode *p); const Node *SizeofExprNode_cbase_node(const SizeofExprNode *p); ExprNode *SizeofExprNode_base(SizeofExprNode *p); const ExprNode *SizeofExprNode_cbase(const SizeofExprNode *p); SizeofExprNode *SizeofExprNode_cast_node(Node *p); const SizeofExprNode *SizeofExprNode_ccast_node(const Node *p); SizeofExprNode *SizeofExprNode_cast(ExprNode *p); const SizeofExprNode *SizeofExprNode_ccast(const ExprNode *p); struct SizeofExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Type * type;
+    ExprNode * expression;
+};
+Node *CastExprNode_base_node(CastExprNode *p); const Node *CastExprNode_cbase_node(const CastExprNode *p); ExprNode *CastExprNode_base(CastExprNode *p); const ExprNode *CastExprNode_cbase(const CastExprNode *p); CastExprNode *CastExprNode_cast_node(Node *p); const CastExprNode *CastExprNode_ccast_node(const Node *p); CastExprNode *CastExprNode_cast(ExprNode *p); const CastExprNode *CastExprNode_ccast(const ExprNode *p); struct CastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * expression;
+};
+
+
+
+
+
+Node *UnaryExprNode_base_node(UnaryExprNode *p); const Node *UnaryExprNode_cbase_node(const UnaryExprNode *p); ExprNode *UnaryExprNode_base(UnaryExprNode *p); const ExprNode *UnaryExprNode_cbase(const UnaryExprNode *p); UnaryExprNode *UnaryExprNode_cast_node(Node *p); const UnaryExprNode *UnaryExprNode_ccast_node(const Node *p); UnaryExprNode *UnaryExprNode_cast(ExprNode *p); const UnaryExprNode *UnaryExprNode_ccast(const ExprNode *p); struct UnaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    UnaryOp operator;
+    ExprNode * operand;
+};
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+Node *BinaryExprNode_base_node(BinaryExprNode *p); const Node *BinaryExprNode_cbase_node(const BinaryExprNode *p); ExprNode *BinaryExprNode_base(BinaryExprNode *p); const ExprNode *BinaryExprNode_cbase(const BinaryExprNode *p); BinaryExprNode *BinaryExprNode_cast_node(Node *p); const BinaryExprNode *BinaryExprNode_ccast_node(const Node *p); BinaryExprNode *BinaryExprNode_cast(ExprNode *p); const BinaryExprNode *BinaryExprNode_ccast(const ExprNode *p); struct BinaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    BinaryOp operator;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *AssignExprNode_base_node(AssignExprNode *p); const Node *AssignExprNode_cbase_node(const AssignExprNode *p); ExprNode *AssignExprNode_base(AssignExprNode *p); const ExprNode *AssignExprNode_cbase(const AssignExprNode *p); AssignExprNode *AssignExprNode_cast_node(Node *p); const AssignExprNode *AssignExprNode_ccast_node(const Node *p); AssignExprNode *AssignExprNode_cast(ExprNode *p); const AssignExprNode *AssignExprNode_ccast(const ExprNode *p); struct AssignExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *ImplicitCastExprNode_base_node(ImplicitCastExprNode *p); const Node *ImplicitCastExprNode_cbase_node(const ImplicitCastExprNode *p); ExprNode *ImplicitCastExprNode_base(ImplicitCastExprNode *p); const ExprNode *ImplicitCastExprNode_cbase(const ImplicitCastExprNode *p); ImplicitCastExprNode *ImplicitCastExprNode_cast_node(Node *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast_node(const Node *p); ImplicitCastExprNode *ImplicitCastExprNode_cast(ExprNode *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast(const ExprNode *p); struct ImplicitCastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ImplicitCastOp operator;
+    ExprNode * expression;
+};
+Node *CompoundStmtNode_base_node(CompoundStmtNode *p); const Node *CompoundStmtNode_cbase_node(const CompoundStmtNode *p); StmtNode *CompoundStmtNode_base(CompoundStmtNode *p); const StmtNode *CompoundStmtNode_cbase(const CompoundStmtNode *p); CompoundStmtNode *CompoundStmtNode_cast_node(Node *p); const CompoundStmtNode *CompoundStmtNode_ccast_node(const Node *p); CompoundStmtNode *CompoundStmtNode_cast(StmtNode *p); const CompoundStmtNode *CompoundStmtNode_ccast(const StmtNode *p); struct CompoundStmtNode { NodeKind kind;
+    Vec_StmtNode * statements;
+};
+Node *IfStmtNode_base_node(IfStmtNode *p); const Node *IfStmtNode_cbase_node(const IfStmtNode *p); StmtNode *IfStmtNode_base(IfStmtNode *p); const StmtNode *IfStmtNode_cbase(const IfStmtNode *p); IfStmtNode *IfStmtNode_cast_node(Node *p); const IfStmtNode *IfStmtNode_ccast_node(const Node *p); IfStmtNode *IfStmtNode_cast(StmtNode *p); const IfStmtNode *IfStmtNode_ccast(const StmtNode *p); struct IfStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * if_true;
+    StmtNode * if_false;
+};
+Node *WhileStmtNode_base_node(WhileStmtNode *p); const Node *WhileStmtNode_cbase_node(const WhileStmtNode *p); StmtNode *WhileStmtNode_base(WhileStmtNode *p); const StmtNode *WhileStmtNode_cbase(const WhileStmtNode *p); WhileStmtNode *WhileStmtNode_cast_node(Node *p); const WhileStmtNode *WhileStmtNode_ccast_node(const Node *p); WhileStmtNode *WhileStmtNode_cast(StmtNode *p); const WhileStmtNode *WhileStmtNode_ccast(const StmtNode *p); struct WhileStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * body;
+};
+Node *ForStmtNode_base_node(ForStmtNode *p); const Node *ForStmtNode_cbase_node(const ForStmtNode *p); StmtNode *ForStmtNode_base(ForStmtNode *p); const StmtNode *ForStmtNode_cbase(const ForStmtNode *p); ForStmtNode *ForStmtNode_cast_node(Node *p); const ForStmtNode *ForStmtNode_ccast_node(const Node *p); ForStmtNode *ForStmtNode_cast(StmtNode *p); const ForStmtNode *ForStmtNode_ccast(const StmtNode *p); struct ForStmtNode { NodeKind kind;
+    StmtNode * initializer;
+    ExprNode * condition;
+    ExprNode * step;
+    StmtNode * body;
+};
+Node *ReturnStmtNode_base_node(ReturnStmtNode *p); const Node *ReturnStmtNode_cbase_node(const ReturnStmtNode *p); StmtNode *ReturnStmtNode_base(ReturnStmtNode *p); const StmtNode *ReturnStmtNode_cbase(const ReturnStmtNode *p); ReturnStmtNode *ReturnStmtNode_cast_node(Node *p); const ReturnStmtNode *ReturnStmtNode_ccast_node(const Node *p); ReturnStmtNode *ReturnStmtNode_cast(StmtNode *p); const ReturnStmtNode *ReturnStmtNode_ccast(const StmtNode *p); struct ReturnStmtNode { NodeKind kind;
+    ExprNode * return_value;
+};
+Node *DeclStmtNode_base_node(DeclStmtNode *p); const Node *DeclStmtNode_cbase_node(const DeclStmtNode *p); StmtNode *DeclStmtNode_base(DeclStmtNode *p); const StmtNode *DeclStmtNode_cbase(const DeclStmtNode *p); DeclStmtNode *DeclStmtNode_cast_node(Node *p); const DeclStmtNode *DeclStmtNode_ccast_node(const Node *p); DeclStmtNode *DeclStmtNode_cast(StmtNode *p); const DeclStmtNode *DeclStmtNode_ccast(const StmtNode *p); struct DeclStmtNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *ExprStmtNode_base_node(ExprStmtNode *p); const Node *ExprStmtNode_cbase_node(const ExprStmtNode *p); StmtNode *ExprStmtNode_base(ExprStmtNode *p); const StmtNode *ExprStmtNode_cbase(const ExprStmtNode *p); ExprStmtNode *ExprStmtNode_cast_node(Node *p); const ExprStmtNode *ExprStmtNode_ccast_node(const Node *p); ExprStmtNode *ExprStmtNode_cast(StmtNode *p); const ExprStmtNode *ExprStmtNode_ccast(const StmtNode *p); struct ExprStmtNode { NodeKind kind;
+    ExprNode * expression;
+};
+Node *AbstractDirectDeclaratorNode_base_node(AbstractDirectDeclaratorNode *p); const Node *AbstractDirectDeclaratorNode_cbase_node(const AbstractDirectDeclaratorNode *p); DeclaratorNode *AbstractDirectDeclaratorNode_base(AbstractDirectDeclaratorNode *p); const DeclaratorNode *AbstractDirectDeclaratorNode_cbase(const AbstractDirectDeclaratorNode *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast_node(Node *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast_node(const Node *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast(DeclaratorNode *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast(const DeclaratorNode *p); struct AbstractDirectDeclaratorNode { NodeKind kind;
+    Symbol * symbol;
+};
+Node *DirectDeclaratorNode_base_node(DirectDeclaratorNode *p); const Node *DirectDeclaratorNode_cbase_node(const DirectDeclaratorNode *p); DeclaratorNode *DirectDeclaratorNode_base(DirectDeclaratorNode *p); const DeclaratorNode *DirectDeclaratorNode_cbase(const DirectDeclaratorNode *p); DirectDeclaratorNode *DirectDeclaratorNode_cast_node(Node *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast_node(const Node *p); DirectDeclaratorNode *DirectDeclaratorNode_cast(DeclaratorNode *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast(const DeclaratorNode *p); struct DirectDeclaratorNode { NodeKind kind;
+    const char * name;
+    Symbol * symbol;
+};
+Node *ArrayDeclaratorNode_base_node(ArrayDeclaratorNode *p); const Node *ArrayDeclaratorNode_cbase_node(const ArrayDeclaratorNode *p); DeclaratorNode *ArrayDeclaratorNode_base(ArrayDeclaratorNode *p); const DeclaratorNode *ArrayDeclaratorNode_cbase(const ArrayDeclaratorNode *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast_node(Node *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast_node(const Node *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast(DeclaratorNode *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast(const DeclaratorNode *p); struct ArrayDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * array_size;
+};
+Node *FunctionDeclaratorNode_base_node(FunctionDeclaratorNode *p); const Node *FunctionDeclaratorNode_cbase_node(const FunctionDeclaratorNode *p); DeclaratorNode *FunctionDeclaratorNode_base(FunctionDeclaratorNode *p); const DeclaratorNode *FunctionDeclaratorNode_cbase(const FunctionDeclaratorNode *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast_node(Node *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast_node(const Node *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast(DeclaratorNode *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast(const DeclaratorNode *p); struct FunctionDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    Vec_DeclaratorNode * parameters;
+    bool is_var_arg;
+};
+Node *PointerDeclaratorNode_base_node(PointerDeclaratorNode *p); const Node *PointerDeclaratorNode_cbase_node(const PointerDeclaratorNode *p); DeclaratorNode *PointerDeclaratorNode_base(PointerDeclaratorNode *p); const DeclaratorNode *PointerDeclaratorNode_cbase(const PointerDeclaratorNode *p); PointerDeclaratorNode *PointerDeclaratorNode_cast_node(Node *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast_node(const Node *p); PointerDeclaratorNode *PointerDeclaratorNode_cast(DeclaratorNode *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast(const DeclaratorNode *p); struct PointerDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+};
+Node *InitDeclaratorNode_base_node(InitDeclaratorNode *p); const Node *InitDeclaratorNode_cbase_node(const InitDeclaratorNode *p); DeclaratorNode *InitDeclaratorNode_base(InitDeclaratorNode *p); const DeclaratorNode *InitDeclaratorNode_cbase(const InitDeclaratorNode *p); InitDeclaratorNode *InitDeclaratorNode_cast_node(Node *p); const InitDeclaratorNode *InitDeclaratorNode_ccast_node(const Node *p); InitDeclaratorNode *InitDeclaratorNode_cast(DeclaratorNode *p); const InitDeclaratorNode *InitDeclaratorNode_ccast(const DeclaratorNode *p); struct InitDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * initializer;
+};
+Node *GlobalDeclNode_base_node(GlobalDeclNode *p); const Node *GlobalDeclNode_cbase_node(const GlobalDeclNode *p); DeclNode *GlobalDeclNode_base(GlobalDeclNode *p); const DeclNode *GlobalDeclNode_cbase(const GlobalDeclNode *p); GlobalDeclNode *GlobalDeclNode_cast_node(Node *p); const GlobalDeclNode *GlobalDeclNode_ccast_node(const Node *p); GlobalDeclNode *GlobalDeclNode_cast(DeclNode *p); const GlobalDeclNode *GlobalDeclNode_ccast(const DeclNode *p); struct GlobalDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *FunctionDeclNode_base_node(FunctionDeclNode *p); const Node *FunctionDeclNode_cbase_node(const FunctionDeclNode *p); DeclNode *FunctionDeclNode_base(FunctionDeclNode *p); const DeclNode *FunctionDeclNode_cbase(const FunctionDeclNode *p); FunctionDeclNode *FunctionDeclNode_cast_node(Node *p); const FunctionDeclNode *FunctionDeclNode_ccast_node(const Node *p); FunctionDeclNode *FunctionDeclNode_cast(DeclNode *p); const FunctionDeclNode *FunctionDeclNode_ccast(const DeclNode *p); struct FunctionDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    DeclaratorNode * declarator;
+    StmtNode * body;
+    Vec_Symbol * local_variables;
+};
+Node *MemberDeclNode_base_node(MemberDeclNode *p); const Node *MemberDeclNode_cbase_node(const MemberDeclNode *p); DeclNode *MemberDeclNode_base(MemberDeclNode *p); const DeclNode *MemberDeclNode_cbase(const MemberDeclNode *p); MemberDeclNode *MemberDeclNode_cast_node(Node *p); const MemberDeclNode *MemberDeclNode_ccast_node(const Node *p); MemberDeclNode *MemberDeclNode_cast(DeclNode *p); const MemberDeclNode *MemberDeclNode_ccast(const DeclNode *p); struct MemberDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *EnumeratorDeclNode_base_node(EnumeratorDeclNode *p); const Node *EnumeratorDeclNode_cbase_node(const EnumeratorDeclNode *p); DeclNode *EnumeratorDeclNode_base(EnumeratorDeclNode *p); const DeclNode *EnumeratorDeclNode_cbase(const EnumeratorDeclNode *p); EnumeratorDeclNode *EnumeratorDeclNode_cast_node(Node *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast_node(const Node *p); EnumeratorDeclNode *EnumeratorDeclNode_cast(DeclNode *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast(const DeclNode *p); struct EnumeratorDeclNode { NodeKind kind;
+    Symbol * symbol;
+    ExprNode * value;
+};
+Node *DeclSpecNode_base_node(DeclSpecNode *p); const Node *DeclSpecNode_cbase_node(const DeclSpecNode *p); Node *DeclSpecNode_base(DeclSpecNode *p); const Node *DeclSpecNode_cbase(const DeclSpecNode *p); DeclSpecNode *DeclSpecNode_cast_node(Node *p); const DeclSpecNode *DeclSpecNode_ccast_node(const Node *p); DeclSpecNode *DeclSpecNode_cast(Node *p); const DeclSpecNode *DeclSpecNode_ccast(const Node *p); struct DeclSpecNode { NodeKind kind;
+    StorageClass storage_class;
+    Type * base_type;
+};
+Node *TranslationUnitNode_base_node(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase_node(const TranslationUnitNode *p); Node *TranslationUnitNode_base(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase(const TranslationUnitNode *p); TranslationUnitNode *TranslationUnitNode_cast_node(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast_node(const Node *p); TranslationUnitNode *TranslationUnitNode_cast(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast(const Node *p); struct TranslationUnitNode { NodeKind kind;
+    Vec_DeclNode * declarations;
+};
+IdentifierExprNode *IdentifierExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol);
+EnumeratorExprNode *EnumeratorExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol, int value);
+IntegerExprNode *
+IntegerExprNode_new(Type *result_type, ValueCategory value_category, int value);
+StringExprNode *StringExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    const char *string,
+    size_t length);
+SubscriptExprNode *SubscriptExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *array,
+    ExprNode *index);
+CallExprNode *CallExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *callee,
+    Vec_ExprNode * arguments);
+DotExprNode *DotExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+ArrowExprNode *ArrowExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+SizeofExprNode *SizeofExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    Type *type,
+    ExprNode *expression);
+CastExprNode *CastExprNode_new(
+    Type *result_type, ValueCategory value_category, ExprNode *expression);
+UnaryExprNode *UnaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    UnaryOp
+    operator,
+    ExprNode *operand);
+BinaryExprNode *BinaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    BinaryOp
+    operator,
+    ExprNode *lhs,
+    ExprNode *rhs);
+AssignExprNode *AssignExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *lhs,
+    ExprNode *rhs);
+ImplicitCastExprNode *ImplicitCastExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ImplicitCastOp
+    operator,
+    ExprNode *expression);
+CompoundStmtNode *CompoundStmtNode_new(Vec_StmtNode * statements);
+IfStmtNode *
+IfStmtNode_new(ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+WhileStmtNode *WhileStmtNode_new(ExprNode *condition, StmtNode *body);
+ForStmtNode *ForStmtNode_new(
+    StmtNode *initializer, ExprNode *condition, ExprNode *step, StmtNode *body);
+ReturnStmtNode *ReturnStmtNode_new(ExprNode *return_value);
+DeclStmtNode *
+DeclStmtNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+ExprStmtNode *ExprStmtNode_new(ExprNode *expression);
+AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_new(void);
+DirectDeclaratorNode *DirectDeclaratorNode_new(const char *name);
+ArrayDeclaratorNode *
+ArrayDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *array_size);
+FunctionDeclaratorNode *FunctionDeclaratorNode_new(
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+PointerDeclaratorNode *PointerDeclaratorNode_new(DeclaratorNode *declarator);
+InitDeclaratorNode *
+InitDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *initializer);
+Symbol *DeclaratorNode_symbol(const DeclaratorNode *p);
+Vec_DeclaratorNode * DeclaratorNode_parameters(const DeclaratorNode *p);
+GlobalDeclNode *
+GlobalDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+FunctionDeclNode *FunctionDeclNode_new(
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body,
+    Vec_Symbol * local_variables);
+MemberDeclNode *
+MemberDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+EnumeratorDeclNode *EnumeratorDeclNode_new(Symbol *symbol, ExprNode *value);
+DeclSpecNode *DeclSpecNode_new(StorageClass storage_class, Type *base_type);
+TranslationUnitNode *TranslationUnitNode_new(Vec_DeclNode * declarations);
+void Node_dump(const Node *p, FILE *fp);
+Arena *Node_arena(void);
+void Node_release_arena(void);
+typedef enum ScanLevel {
+    ScanLevel_scalar,
+    ScanLevel_sse2,
+    ScanLevel_avx2,
+} ScanLevel;
+ScanLevel Scan_max_level(void);
+ScanLevel Scan_level(void);
+void Scan_set_level(ScanLevel level);
+size_t Scan_spaces(const char *s);
+size_t Scan_digits(const char *s);
+size_t Scan_identifier(const char *s);
+size_t Scan_literal(const char *s, char quote);
+typedef struct Lexer Lexer;
+void Lexer_init_tables(void);
+Lexer *Lexer_new(const char *filename, const char *text);
+Token *Lexer_read(Lexer *l);
+Vec_Token * Lexer_read_all(Lexer *l);
+const char *Lexer_directive_at(const Vec_Token * tokens, size_t i);
+typedef struct SourceFile {
+    const char *path;
+    const char *text;
+    Vec_Token * tokens;
+    const char *guard_macro;
+} SourceFile;
+const SourceFile *SourceCache_load(const char *path);
+typedef struct Macro {
+    const char *name;
+    Vec_String * parameters;
+    Vec_Token * contents;
+} Macro;
+Macro *
+Macro_new(const char *name, Vec_String * parameters, Vec_Token * contents);
+Macro *Macro_new_simple(const char *name, Vec_Token * contents);
+bool Macro_is_function(const Macro *m);
+typedef struct Preprocessor Preprocessor;
+Preprocessor *Preprocessor_new(Vec_String * include_paths);
+void Preprocessor_begin(
+    Preprocessor *pp, const char *filename, const char *text);
+Token *Preprocessor_next(Preprocessor *pp);
+Vec_Token *
+    Preprocessor_run(Preprocessor *pp, const char *filename, const char *text);
+void Preprocessor_define_macro(Preprocessor *pp, Macro *macro);
+const Map_Macro * Preprocessor_macros(const Preprocessor *pp);
+void Preprocessor_mark_once(Preprocessor *pp, const char *path);
+const Map_String * Preprocessor_once_files(const Preprocessor *pp);
+Vec_Token *
+    Preprocessor_read(
+        Vec_String * include_paths, const char *filename, const char *text);
+void TokenStream_write(BinaryWriter *w, const Vec_Token * tokens);
+bool TokenStream_is_binary(const char *data, size_t size);
+Vec_Token * TokenStream_read(const char *data, size_t size);
+void TokenStream_print(const Vec_Token * tokens, FILE *fp);
+typedef struct TokenSource TokenSource;
+TokenSource *TokenSource_from_vec(const Vec_Token * tokens);
+TokenSource *TokenSource_from_preprocessor(Preprocessor *pp);
+Token *TokenSource_next(TokenSource *source);
+Vec_Token * TokenSource_read_all(TokenSource *source);
+typedef struct Parser Parser;
+Parser *Parser_new(const Vec_Token * tokens);
+Parser *Parser_new_from_source(TokenSource *source);
+TranslationUnitNode *Parser_parse(Parser *p);
+DeclNode *Parser_parse_next_decl(Parser *p);
+void Parser_release_function_decl(Parser *p, FunctionDeclNode *node);
+struct Sema *Parser_sema(Parser *p);
+typedef struct Sema Sema;
+Sema *Sema_new(void);
+Scope *Sema_global_variable_scope(const Sema *s);
+Scope *Sema_global_struct_scope(const Sema *s);
+Scope *Sema_global_enum_scope(const Sema *s);
+Type *Sema_act_on_struct_type_reference(Sema *s, const Token *identifier);
+Type *
+Sema_act_on_struct_type_start_of_member_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_struct_type_end_of_member_list(
+    Sema *s, Type *struct_type, Vec_MemberDeclNode * member_decls);
+MemberDeclNode *Sema_act_on_struct_type_member_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+Type *Sema_act_on_enum_type_reference(Sema *s, const Token *identifier);
+void Sema_act_on_enum_type_start_of_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_enum_type_end_of_list(
+    Sema *s, const Token *identifier, Vec_EnumeratorDeclNode * enumerators);
+EnumeratorDeclNode *
+Sema_act_on_enumerator(Sema *s, const Token *identifier, ExprNode *value);
+bool Sema_is_typedef_name(Sema *s, const Token *identifier);
+Type *Sema_act_on_typedef_name(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_identifier_expr(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_integer_expr(Sema *s, const Token *integer);
+ExprNode *Sema_act_on_character_expr(Sema *s, const Token *character);
+ExprNode *Sema_act_on_string_expr(Sema *s, const Token *string);
+ExprNode *Sema_act_on_subscript_expr(Sema *s, ExprNode *array, ExprNode *index);
+ExprNode *
+Sema_act_on_call_expr(Sema *s, ExprNode *callee, Vec_ExprNode * arguments);
+ExprNode *
+Sema_act_on_dot_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *
+Sema_act_on_arrow_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *Sema_act_on_sizeof_expr_type(Sema *s, Type *type);
+ExprNode *Sema_act_on_sizeof_expr_expr(Sema *s, ExprNode *expression);
+ExprNode *
+Sema_act_on_cast_expr(Sema *s, Type *destination_type, ExprNode *expression);
+ExprNode *
+Sema_act_on_unary_expr(Sema *s, const Token *operator, ExprNode *operand);
+ExprNode *Sema_act_on_binary_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+ExprNode *Sema_act_on_assign_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+void Sema_act_on_compound_stmt_begin(Sema *s);
+StmtNode *Sema_act_on_compound_stmt_end(Sema *s, Vec_StmtNode * statements);
+StmtNode *Sema_act_on_if_stmt(
+    Sema *s, ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+StmtNode *Sema_act_on_while_stmt(Sema *s, ExprNode *condition, StmtNode *body);
+void Sema_act_on_for_stmt_start(Sema *s);
+StmtNode *Sema_act_on_for_stmt_end(
+    Sema *s,
+    StmtNode *initializer,
+    ExprNode *condition,
+    ExprNode *step,
+    StmtNode *body);
+StmtNode *Sema_act_on_return_stmt(Sema *s, ExprNode *return_value);
+StmtNode *Sema_act_on_decl_stmt(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+StmtNode *Sema_act_on_expr_stmt(Sema *s, ExprNode *expression);
+DeclaratorNode *Sema_act_on_abstract_direct_declarator(Sema *s);
+DeclaratorNode *Sema_act_on_direct_declarator(Sema *s, const Token *identifier);
+DeclaratorNode *Sema_act_on_array_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *array_size);
+void Sema_act_on_function_declarator_start_of_parameter_list(Sema *s);
+DeclaratorNode *Sema_act_on_function_declarator_end_of_parameter_list(
+    Sema *s,
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+DeclaratorNode *
+Sema_act_on_pointer_declarator(Sema *s, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_declarator_completed(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_init_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *initializer);
+DeclSpecNode *
+Sema_act_on_decl_spec(Sema *s, StorageClass storage_class, Type *base_type);
+DeclaratorNode *Sema_act_on_parameter_decl(Sema *s, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_global_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+void Sema_act_on_function_decl_start_of_body(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_function_decl_end_of_body(
+    Sema *s,
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body);
+void Driver_preprocess(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    bool binary);
+void Driver_compile(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    int num_jobs,
+    bool object);
+int Driver_run(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    int num_jobs,
+    int argc,
+    char **argv);
+void Driver_compile_all(
+    Vec_String * include_paths,
+    const char *pch_path,
+    Vec_String * inputs,
+    const char *output_dir,
+    int num_jobs,
+    bool object);
+typedef enum TimeReportPhase {
+    TimeReportPhase_other,
+    TimeReportPhase_read,
+    TimeReportPhase_lex,
+    TimeReportPhase_preprocess,
+    TimeReportPhase_expand,
+    TimeReportPhase_parse,
+    TimeReportPhase_codegen,
+    TimeReportPhase_assemble,
+    TimeReportPhase_count,
+} TimeReportPhase;
+void TimeReport_enable(void);
+bool TimeReport_is_enabled(void);
+void TimeReport_begin(TimeReportPhase phase);
+void TimeReport_end(TimeReportPhase phase);
+void TimeReport_print(bool json);
+void TimeReport_allocate(size_t size);
+typedef struct StringPool StringPool;
+StringPool *StringPool_new(void);
+void StringPool_delete(StringPool *pool);
+size_t StringPool_add(StringPool *pool, const char *s, size_t len);
+size_t StringPool_len(const StringPool *pool);
+const char *StringPool_string(const StringPool *pool, size_t entry);
+size_t StringPool_length(const StringPool *pool, size_t entry);
+bool StringPool_has_nul(const StringPool *pool, size_t entry);
+void StringPool_merge_suffixes(StringPool *pool);
+size_t StringPool_root(const StringPool *pool, size_t entry, size_t *offset);
+typedef struct Emitter Emitter;
+Emitter *Emitter_new(FILE *fp);
+void Emitter_delete(Emitter *e);
+void Emitter_flush(Emitter *e);
+void Emitter_write(Emitter *e, const char *s);
+void Emitter_write_bytes(Emitter *e, const char *s, size_t len);
+void Emitter_write_char(Emitter *e, char c);
+void Emitter_write_size(Emitter *e, size_t x);
+void Emitter_write_int(Emitter *e, int x);
+void Emitter_write_signed_int(Emitter *e, int x);
+void Emitter_write_hex_byte(Emitter *e, int x);
+void Emitter_append(Emitter *e, const Emitter *other);
+const char *Emitter_data(const Emitter *e, size_t *len);
+typedef struct CodeGen CodeGen;
+CodeGen *CodeGen_new(FILE *fp);
+void CodeGen_delete(CodeGen *g);
+void CodeGen_gen_decl(CodeGen *g, DeclNode *p);
+void CodeGen_finish(CodeGen *g);
+const char *CodeGen_output(const CodeGen *g, size_t *len);
+void CodeGen_gen(TranslationUnitNode *p, FILE *fp);
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs);
+typedef struct AssemblerSymbol AssemblerSymbol;
+void Assembler_assemble(const char *text, size_t len, const char *path);
+int Assembler_run(const char *text, size_t len, int argc, char **argv);
+typedef struct PrecompiledHeader PrecompiledHeader;
+void PrecompiledHeader_emit(
+    Vec_String * include_paths, const char *header_path, const char *output);
+PrecompiledHeader *PrecompiledHeader_load(const char *path);
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp);
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s);
+void test_Vec(void);
+void test_Arena(void);
+void test_Intern(void);
+void test_HiddenSet(void);
+void test_Path(void);
+void test_File(void);
+void test_Binary(void);
+void test_Ast(void);
+void test_Scan(void);
+void test_Lexer(void);
+void test_SourceCache(void);
+void test_Preprocessor(void);
+void test_TokenStream(void);
+void test_Parser(void);
+void test_StringPool(void);
+void test_Emitter(void);
+void test_PrecompiledHeader(void);
+void bench_Scope(void);
+void bench_Preprocessor(void);
+void bench_Lexer(void);
+void check_Node_dump(
+    const char *test_name, const Node *p, const char *expected);
+struct PrecompiledHeader {
+    Vec_String * once_files;
+    Vec_Macro * macros;
+    Vec_Symbol * variable_symbols;
+    Vec_Symbol * struct_symbols;
+    Vec_Symbol * enum_symbols;
+};
+static void
+PrecompiledHeader_write_token(BinaryWriter *w, const Token *t) {
+    ((void)0);
+    ((void)0);
+    int flags = 0;
+    if (t->is_bol) {
+        flags = flags + 1;
+    }
+    if (t->has_spaces) {
+        flags = flags + 2;
+    }
+    if (t->string) {
+        flags = flags + 4;
+    }
+    BinaryWriter_write_int(w, t->kind);
+    BinaryWriter_write_int(w, flags);
+    BinaryWriter_write_string(w, t->text);
+    if (t->string) {
+        BinaryWriter_write_int(w, t->string_len);
+        BinaryWriter_write_bytes(w, t->string, t->string_len);
+    }
+}
+static void PrecompiledHeader_write_macro(BinaryWriter *w, const Macro *m) {
+    ((void)0);
+    ((void)0);
+    BinaryWriter_write_string(w, m->name);
+    BinaryWriter_write_int(w, Macro_is_function(m));
+    if (Macro_is_function(m)) {
+        size_t num_parameters = Vec_len_String(m->parameters);
+        BinaryWriter_write_int(w, num_parameters);
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            BinaryWriter_write_string(w, Vec_get_String(m->parameters, i));
+        }
+    }
+    BinaryWriter_write_int(w, Vec_len_Token(m->contents));
+    for (size_t i = 0; i < Vec_len_Token(m->contents); i = i + 1) {
+        PrecompiledHeader_write_token(w, Vec_get_Token(m->contents, i));
+    }
+}
+static void
+PrecompiledHeader_write_type(BinaryWriter *w, Vec_Type * types, Type *type) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    BinaryWriter_write_int(w, type->kind);
+    if (type->kind == TypeKind_pointer) {
+        PrecompiledHeader_write_type(w, types, type->pointee_type);
+    } else if (type->kind == TypeKind_function) {
+        size_t num_parameters = Vec_len_Type(type->parameter_types);
+        PrecompiledHeader_write_type(w, types, type->return_type);
+        BinaryWriter_write_int(w, num_parameters);
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            PrecompiledHeader_write_type(
+                w, types, Vec_get_Type(type->parameter_types, i));
+        }
+        BinaryWriter_write_int(w, type->is_var_arg);
+    } else if (type->kind == TypeKind_array) {
+        PrecompiledHeader_write_type(w, types, type->element_type);
+        BinaryWriter_write_int(w, type->array_length);
+    } else if (
+        type->kind == TypeKind_struct || type->kind == TypeKind_enum) {
+        for (size_t i = 0; i < Vec_len_Type(types); i = i + 1) {
+            if (Vec_get_Type(types, i) == type) {
+                BinaryWriter_write_int(w, i);
+                return;
+            }
+        }
+        BinaryWriter_write_int(w, Vec_len_Type(types));
+        Vec_push_Type(types, type);
+        if (type->kind == TypeKind_struct) {
+            ((void)0);
+            BinaryWriter_write_string(w, type->struct_symbol->name);
+            BinaryWriter_write_int(w, StructType_is_defined(type));
+            if (StructType_is_defined(type)) {
+                size_t num_members = Vec_len_Symbol(type->member_symbols);
+                BinaryWriter_write_int(w, num_members);
+                for (size_t i = 0; i < num_members; i = i + 1) {
+                    Symbol *member = Vec_get_Symbol(type->member_symbols, i);
+                    BinaryWriter_write_string(w, member->name);
+                    PrecompiledHeader_write_type(w, types, member->type);
+                }
+            }
+        } else {
+            BinaryWriter_write_int(w, type->enum_symbol != (Symbol *)((void *)0));
+            if (type->enum_symbol) {
+                BinaryWriter_write_string(w, type->enum_symbol->name);
+            }
+            PrecompiledHeader_write_type(w, types, type->underlying_type);
+        }
+    }
+}
+static void PrecompiledHeader_write_symbol(
+    BinaryWriter *w, Vec_Type * types, const Symbol *symbol) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    if (symbol->has_body) {
+        (exit(1));
+    }
+    if (symbol->type->kind != TypeKind_function &&
+        (symbol->storage_class == StorageClass_none ||
+         symbol->storage_class == StorageClass_static)) {
+        (exit(1));
+    }
+    BinaryWriter_write_string(w, symbol->name);
+    BinaryWriter_write_int(w, symbol->storage_class);
+    PrecompiledHeader_write_type(w, types, symbol->type);
+    BinaryWriter_write_int(w, symbol->enum_value);
+}
+static void PrecompiledHeader_write_tags(
+    BinaryWriter *w, Vec_Type * types, Vec_Symbol * symbols) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    BinaryWriter_write_int(w, Vec_len_Symbol(symbols));
+    for (size_t i = 0; i < Vec_len_Symbol(symbols); i = i + 1) {
+        PrecompiledHeader_write_type(
+            w, types, Vec_get_Symbol(symbols, i)->type);
+    }
+}
+static void PrecompiledHeader_write(
+    BinaryWriter *w, const Preprocessor *pp, const Sema *s) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    BinaryWriter_write_string(w, "mocc-pch");
+    BinaryWriter_write_int(w, 1);
+    const Map_String *once_files = Preprocessor_once_files(pp);
+    BinaryWriter_write_int(w, Map_len_String(once_files));
+    for (size_t i = 0; i < Map_cap_String(once_files); i = i + 1) {
+        const char *path = Map_value_at_String(once_files, i);
+        if (path) {
+            BinaryWriter_write_string(w, path);
+        }
+    }
+    const Map_Macro *macros = Preprocessor_macros(pp);
+    BinaryWriter_write_int(w, Map_len_Macro(macros));
+    for (size_t i = 0; i < Map_cap_Macro(macros); i = i + 1) {
+        const Macro *m = Map_value_at_Macro(macros, i);
+        if (m) {
+            PrecompiledHeader_write_macro(w, m);
+        }
+    }
+    Vec_Type *types = Vec_new_Type();
+    Vec_Symbol *symbols = Scope_symbols(Sema_global_variable_scope(s));
+    BinaryWriter_write_int(w, Vec_len_Symbol(symbols));
+    for (size_t i = 0; i < Vec_len_Symbol(symbols); i = i + 1) {
+        PrecompiledHeader_write_symbol(w, types, Vec_get_Symbol(symbols, i));
+    }
+    PrecompiledHeader_write_tags(
+        w, types, Scope_symbols(Sema_global_struct_scope(s)));
+    PrecompiledHeader_write_tags(
+        w, types, Scope_symbols(Sema_global_enum_scope(s)));
+}
+void PrecompiledHeader_emit(
+    Vec_String * include_paths, const char *header_path, const char *output) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    const char *text = File_read(header_path);
+    if (text == (const char *)((void *)0)) {
+        (exit(1));
+    }
+    Preprocessor *pp = Preprocessor_new(include_paths);
+    Vec_Token *tokens = Preprocessor_run(pp, header_path, text);
+    Parser *p = Parser_new(tokens);
+    Parser_parse(p);
+    BinaryWriter *w = BinaryWriter_new();
+    PrecompiledHeader_write(w, pp, Parser_sema(p));
+    Node_release_arena();
+    if (!BinaryWriter_save(w, output)) {
+        (exit(1));
+    }
+}
+static Token *PrecompiledHeader_read_token(BinaryReader *r) {
+    ((void)0);
+    Token *t = malloc(sizeof(Token));
+    t->kind = BinaryReader_read_int(r);
+    int flags = BinaryReader_read_int(r);
+    t->is_bol = (flags & 1) != 0;
+    t->has_spaces = (flags & 2) != 0;
+    t->text = BinaryReader_read_string(r);
+    t->source = t->text;
+    t->offset = 0;
+    t->length = Intern_length(t->text);
+    t->string = ((void *)0);
+    t->string_len = 0;
+    t->hidden_set = ((void *)0);
+    if ((flags & 4) != 0) {
+        t->string_len = BinaryReader_read_int(r);
+        t->string = BinaryReader_read_bytes(r, t->string_len);
+    }
+    return t;
+}
+static Macro *PrecompiledHeader_read_macro(BinaryReader *r) {
+    ((void)0);
+    const char *name = BinaryReader_read_string(r);
+    Vec_String *parameters = ((void *)0);
+    if (BinaryReader_read_int(r)) {
+        size_t num_parameters = BinaryReader_read_int(r);
+        parameters = Vec_new_String();
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            Vec_push_String(parameters, BinaryReader_read_string(r));
+        }
+    }
+    size_t num_tokens = BinaryReader_read_int(r);
+    Vec_Token *contents = Vec_new_Token();
+    Vec_reserve_Token(contents, num_tokens);
+    for (size_t i = 0; i < num_tokens; i = i + 1) {
+        Vec_push_Token(contents, PrecompiledHeader_read_token(r));
+    }
+    return Macro_new(name, parameters, contents);
+}
+static Type *PrecompiledHeader_read_type(BinaryReader *r, Vec_Type * types) {
+    ((void)0);
+    ((void)0);
+    TypeKind kind = BinaryReader_read_int(r);
+    if (kind == TypeKind_void) {
+        return VoidType_new();
+    } else if (kind == TypeKind_char) {
+        return CharType_new();
+    } else if (kind == TypeKind_int) {
+        return IntType_new();
+    } else if (kind == TypeKind_pointer) {
+        return PointerType_new(PrecompiledHeader_read_type(r, types));
+    } else if (kind == TypeKind_function) {
+        Type *return_type = PrecompiledHeader_read_type(r, types);
+        size_t num_parameters = BinaryReader_read_int(r);
+        Vec_Type *parameter_types = Vec_new_Type();
+        for (size_t i = 0; i < num_parameters; i = i + 1) {
+            Vec_push_Type(
+                parameter_types, PrecompiledHeader_read_type(r, types));
+        }
+        bool is_var_arg = BinaryReader_read_int(r);
+        return FunctionType_new(return_type, parameter_types, is_var_arg);
+    } else if (kind == TypeKind_array) {
+        Type *element_type = PrecompiledHeader_read_type(r, types);
+        size_t array_length = BinaryReader_read_int(r);
+        return ArrayType_new(element_type, array_length);
+    } else if (kind != TypeKind_struct && kind != TypeKind_enum) {
+        (exit(1));
+    }
+    size_t index = BinaryReader_read_int(r);
+    if (index < Vec_len_Type(types)) {
+        return Vec_get_Type(types, index);
+    } else if (index != Vec_len_Type(types)) {
+        (exit(1));
+    }
+    if (kind == TypeKind_struct) {
+        Type *type = StructType_new();
+        Vec_push_Type(types, type);
+        type->struct_symbol = Symbol_new(
+            BinaryReader_read_string(r), StorageClass_none, type);
+        if (BinaryReader_read_int(r)) {
+            size_t num_members = BinaryReader_read_int(r);
+            Vec_Symbol *member_symbols = Vec_new_Symbol();
+            for (size_t i = 0; i < num_members; i = i + 1) {
+                const char *name = BinaryReader_read_string(r);
+                Type *member_type = PrecompiledHeader_read_type(r, types);
+                Vec_push_Symbol(
+                    member_symbols,
+                    Symbol_new(name, StorageClass_none, member_type));
+            }
+            type->member_symbols = member_symbols;
+        }
+        return type;
+    }
+    Type *type = EnumType_new(IntType_new(), Vec_new_EnumeratorDeclNode());
+    Vec_push_Type(types, type);
+    if (BinaryReader_read_int(r)) {
+        type->enum_symbol = Symbol_new(
+            BinaryReader_read_string(r), StorageClass_none, type);
+    }
+    type->underlying_type = PrecompiledHeader_read_type(r, types);
+    return type;
+}
+static Symbol *
+PrecompiledHeader_read_symbol(BinaryReader *r, Vec_Type * types) {
+    ((void)0);
+    ((void)0);
+    const char *name = BinaryReader_read_string(r);
+    StorageClass storage_class = BinaryReader_read_int(r);
+    Type *type = PrecompiledHeader_read_type(r, types);
+    Symbol *symbol = Symbol_new(name, storage_class, type);
+    symbol->enum_value = BinaryReader_read_int(r);
+    return symbol;
+}
+PrecompiledHeader *PrecompiledHeader_load(const char *path) {
+    ((void)0);
+    size_t size;
+    const char *data = File_read_with_size(path, &size);
+    if (data == (const char *)((void *)0)) {
+        (exit(1));
+    }
+    BinaryReader *r = BinaryReader_new(data, size);
+    size_t magic_len = strlen("mocc-pch");
+    if (size < 4 + magic_len || (size_t)BinaryReader_read_int(r) != magic_len ||
+        memcmp(
+            BinaryReader_read_bytes(r, magic_len),
+            "mocc-pch",
+            magic_len) != 0) {
+        (exit(1));
+    }
+    if (BinaryReader_read_int(r) != 1) {
+        (exit(1));
+    }
+    PrecompiledHeader *pch = malloc(sizeof(PrecompiledHeader));
+    pch->once_files = Vec_new_String();
+    pch->macros = Vec_new_Macro();
+    pch->variable_symbols = Vec_new_Symbol();
+    pch->struct_symbols = Vec_new_Symbol();
+    pch->enum_symbols = Vec_new_Symbol();
+    size_t num_once_files = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_once_files; i = i + 1) {
+        Vec_push_String(pch->once_files, BinaryReader_read_string(r));
+    }
+    size_t num_macros = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_macros; i = i + 1) {
+        Vec_push_Macro(pch->macros, PrecompiledHeader_read_macro(r));
+    }
+    Vec_Type *types = Vec_new_Type();
+    size_t num_symbols = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_symbols; i = i + 1) {
+        Vec_push_Symbol(
+            pch->variable_symbols, PrecompiledHeader_read_symbol(r, types));
+    }
+    size_t num_structs = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_structs; i = i + 1) {
+        Type *type = PrecompiledHeader_read_type(r, types);
+        Vec_push_Symbol(pch->struct_symbols, type->struct_symbol);
+    }
+    size_t num_enums = BinaryReader_read_int(r);
+    for (size_t i = 0; i < num_enums; i = i + 1) {
+        Type *type = PrecompiledHeader_read_type(r, types);
+        Vec_push_Symbol(pch->enum_symbols, type->enum_symbol);
+    }
+    if (!BinaryReader_at_end(r)) {
+        (exit(1));
+    }
+    return pch;
+}
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp) {
+    ((void)0);
+    ((void)0);
+    for (size_t i = 0; i < Vec_len_String(pch->once_files); i = i + 1) {
+        Preprocessor_mark_once(pp, Vec_get_String(pch->once_files, i));
+    }
+    for (size_t i = 0; i < Vec_len_Macro(pch->macros); i = i + 1) {
+        Preprocessor_define_macro(pp, Vec_get_Macro(pch->macros, i));
+    }
+}
+static void PrecompiledHeader_declare(
+    Scope *scope, Vec_Symbol * symbols, const char *kind) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    for (size_t i = 0; i < Vec_len_Symbol(symbols); i = i + 1) {
+        Symbol *symbol = Vec_get_Symbol(symbols, i);
+        if (!Scope_try_register(scope, symbol)) {
+            (exit(1));
+        }
+    }
+}
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s) {
+    ((void)0);
+    ((void)0);
+    PrecompiledHeader_declare(
+        Sema_global_variable_scope(s), pch->variable_symbols, "");
+    PrecompiledHeader_declare(
+        Sema_global_struct_scope(s), pch->struct_symbols, "struct ");
+    PrecompiledHeader_declare(
+        Sema_global_enum_scope(s), pch->enum_symbols, "enum ");
+}
@@ -0,0 +1,2944 @@
+int isspace(int c);
+int isdigit(int c);
+int isalpha(int c);
+int isalnum(int c);
+typedef int size_t;
+void *malloc(size_t size);
+void *realloc(void *ptr, size_t size);
+void free(void *ptr);
+void exit(int);
+int atoi(const char *s);
+typedef struct FILE FILE;
+FILE *fopen(const char *path, const char *mode);
+void fclose(FILE *fp);
+int fseek(FILE *fp, int off, int origin);
+int ftell(FILE *fp);
+size_t fread(void *buf, size_t size, size_t n, FILE *fp);
+size_t fwrite(const void *buf, size_t size, size_t n, FILE *fp);
+int fprintf(FILE *fp, const char *fmt, ...);
+int printf(const char *fmt, ...);
+int snprintf(char *buf, size_t size, const char *fmt, ...);
+int remove(const char *path);
+size_t strlen(const char *s);
+int strcmp(const char *s1, const char *s2);
+int strncmp(const char *s1, const char *s2, size_t n);
+char *strcpy(char *s1, const char *s2);
+char *strcat(char *s1, const char *s2);
+char *strdup(const char *s);
+char *strndup(const char *s, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+void *memcpy(void *s1, const void *s2, size_t n);
+typedef int bool;
+typedef struct Vec_String Vec_String; typedef const char * Vec_Element_String; Vec_String * Vec_new_String(void); size_t Vec_len_String(const Vec_String * v); Vec_Element_String * Vec_ptr_String(Vec_String * v); const Vec_Element_String * Vec_cptr_String(const Vec_String * v); Vec_Element_String Vec_get_String(const Vec_String * v, size_t i); void Vec_set_String(Vec_String * v, size_t i, Vec_Element_String x); void Vec_push_String(Vec_String * v, Vec_Element_String x); Vec_Element_String Vec_pop_String(Vec_String * v); void Vec_reserve_String(Vec_String * v, size_t cap); void Vec_resize_String(Vec_String * v, size_t len); void Vec_delete_String(Vec_String * v);
+typedef struct Vec_size_t Vec_size_t; typedef size_t Vec_Element_size_t; Vec_size_t * Vec_new_size_t(void); size_t Vec_len_size_t(const Vec_size_t * v); Vec_Element_size_t * Vec_ptr_size_t(Vec_size_t * v); const Vec_Element_size_t * Vec_cptr_size_t(const Vec_size_t * v); Vec_Element_size_t Vec_get_size_t(const Vec_size_t * v, size_t i); void Vec_set_size_t(Vec_size_t * v, size_t i, Vec_Element_size_t x); void Vec_push_size_t(Vec_size_t * v, Vec_Element_size_t x); Vec_Element_size_t Vec_pop_size_t(Vec_size_t * v); void Vec_reserve_size_t(Vec_size_t * v, size_t cap); void Vec_resize_size_t(Vec_size_t * v, size_t len); void Vec_delete_size_t(Vec_size_t * v);
+typedef struct Vec_Token Vec_Token; typedef struct Token * Vec_Element_Token; Vec_Token * Vec_new_Token(void); size_t Vec_len_Token(const Vec_Token * v); Vec_Element_Token * Vec_ptr_Token(Vec_Token * v); const Vec_Element_Token * Vec_cptr_Token(const Vec_Token * v); Vec_Element_Token Vec_get_Token(const Vec_Token * v, size_t i); void Vec_set_Token(Vec_Token * v, size_t i, Vec_Element_Token x); void Vec_push_Token(Vec_Token * v, Vec_Element_Token x); Vec_Element_Token Vec_pop_Token(Vec_Token * v); void Vec_reserve_Token(Vec_Token * v, size_t cap); void Vec_resize_Token(Vec_Token * v, size_t len); void Vec_delete_Token(Vec_Token * v);
+typedef struct Vec_Type Vec_Type; typedef struct Type * Vec_Element_Type; Vec_Type * Vec_new_Type(void); size_t Vec_len_Type(const Vec_Type * v); Vec_Element_Type * Vec_ptr_Type(Vec_Type * v); const Vec_Element_Type * Vec_cptr_Type(const Vec_Type * v); Vec_Element_Type Vec_get_Type(const Vec_Type * v, size_t i); void Vec_set_Type(Vec_Type * v, size_t i, Vec_Element_Type x); void Vec_push_Type(Vec_Type * v, Vec_Element_Type x); Vec_Element_Type Vec_pop_Type(Vec_Type * v); void Vec_reserve_Type(Vec_Type * v, size_t cap); void Vec_resize_Type(Vec_Type * v, size_t len); void Vec_delete_Type(Vec_Type * v);
+typedef struct Vec_Symbol Vec_Symbol; typedef struct Symbol * Vec_Element_Symbol; Vec_Symbol * Vec_new_Symbol(void); size_t Vec_len_Symbol(const Vec_Symbol * v); Vec_Element_Symbol * Vec_ptr_Symbol(Vec_Symbol * v); const Vec_Element_Symbol * Vec_cptr_Symbol(const Vec_Symbol * v); Vec_Element_Symbol Vec_get_Symbol(const Vec_Symbol * v, size_t i); void Vec_set_Symbol(Vec_Symbol * v, size_t i, Vec_Element_Symbol x); void Vec_push_Symbol(Vec_Symbol * v, Vec_Element_Symbol x); Vec_Element_Symbol Vec_pop_Symbol(Vec_Symbol * v); void Vec_reserve_Symbol(Vec_Symbol * v, size_t cap); void Vec_resize_Symbol(Vec_Symbol * v, size_t len); void Vec_delete_Symbol(Vec_Symbol * v);
+typedef struct Vec_Macro Vec_Macro; typedef struct Macro * Vec_Element_Macro; Vec_Macro * Vec_new_Macro(void); size_t Vec_len_Macro(const Vec_Macro * v); Vec_Element_Macro * Vec_ptr_Macro(Vec_Macro * v); const Vec_Element_Macro * Vec_cptr_Macro(const Vec_Macro * v); Vec_Element_Macro Vec_get_Macro(const Vec_Macro * v, size_t i); void Vec_set_Macro(Vec_Macro * v, size_t i, Vec_Element_Macro x); void Vec_push_Macro(Vec_Macro * v, Vec_Element_Macro x); Vec_Element_Macro Vec_pop_Macro(Vec_Macro * v); void Vec_reserve_Macro(Vec_Macro * v, size_t cap); void Vec_resize_Macro(Vec_Macro * v, size_t len); void Vec_delete_Macro(Vec_Macro * v);
+typedef struct Vec_ExprNode Vec_ExprNode; typedef struct ExprNode * Vec_Element_ExprNode; Vec_ExprNode * Vec_new_ExprNode(void); size_t Vec_len_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode * Vec_ptr_ExprNode(Vec_ExprNode * v); const Vec_Element_ExprNode * Vec_cptr_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode Vec_get_ExprNode(const Vec_ExprNode * v, size_t i); void Vec_set_ExprNode(Vec_ExprNode * v, size_t i, Vec_Element_ExprNode x); void Vec_push_ExprNode(Vec_ExprNode * v, Vec_Element_ExprNode x); Vec_Element_ExprNode Vec_pop_ExprNode(Vec_ExprNode * v); void Vec_reserve_ExprNode(Vec_ExprNode * v, size_t cap); void Vec_resize_ExprNode(Vec_ExprNode * v, size_t len); void Vec_delete_ExprNode(Vec_ExprNode * v);
+typedef struct Vec_StmtNode Vec_StmtNode; typedef struct StmtNode * Vec_Element_StmtNode; Vec_StmtNode * Vec_new_StmtNode(void); size_t Vec_len_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode * Vec_ptr_StmtNode(Vec_StmtNode * v); const Vec_Element_StmtNode * Vec_cptr_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode Vec_get_StmtNode(const Vec_StmtNode * v, size_t i); void Vec_set_StmtNode(Vec_StmtNode * v, size_t i, Vec_Element_StmtNode x); void Vec_push_StmtNode(Vec_StmtNode * v, Vec_Element_StmtNode x); Vec_Element_StmtNode Vec_pop_StmtNode(Vec_StmtNode * v); void Vec_reserve_StmtNode(Vec_StmtNode * v, size_t cap); void Vec_resize_StmtNode(Vec_StmtNode * v, size_t len); void Vec_delete_StmtNode(Vec_StmtNode * v);
+typedef struct Vec_DeclaratorNode Vec_DeclaratorNode; typedef struct DeclaratorNode * Vec_Element_DeclaratorNode; Vec_DeclaratorNode * Vec_new_DeclaratorNode(void); size_t Vec_len_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode * Vec_ptr_DeclaratorNode(Vec_DeclaratorNode * v); const Vec_Element_DeclaratorNode * Vec_cptr_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode Vec_get_DeclaratorNode(const Vec_DeclaratorNode * v, size_t i); void Vec_set_DeclaratorNode(Vec_DeclaratorNode * v, size_t i, Vec_Element_DeclaratorNode x); void Vec_push_DeclaratorNode(Vec_DeclaratorNode * v, Vec_Element_DeclaratorNode x); Vec_Element_DeclaratorNode Vec_pop_DeclaratorNode(Vec_DeclaratorNode * v); void Vec_reserve_DeclaratorNode(Vec_DeclaratorNode * v, size_t cap); void Vec_resize_DeclaratorNode(Vec_DeclaratorNode * v, size_t len); void Vec_delete_DeclaratorNode(Vec_DeclaratorNode * v);
+typedef struct Vec_DeclNode Vec_DeclNode; typedef struct DeclNode * Vec_Element_DeclNode; Vec_DeclNode * Vec_new_DeclNode(void); size_t Vec_len_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode * Vec_ptr_DeclNode(Vec_DeclNode * v); const Vec_Element_DeclNode * Vec_cptr_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode Vec_get_DeclNode(const Vec_DeclNode * v, size_t i); void Vec_set_DeclNode(Vec_DeclNode * v, size_t i, Vec_Element_DeclNode x); void Vec_push_DeclNode(Vec_DeclNode * v, Vec_Element_DeclNode x); Vec_Element_DeclNode Vec_pop_DeclNode(Vec_DeclNode * v); void Vec_reserve_DeclNode(Vec_DeclNode * v, size_t cap); void Vec_resize_DeclNode(Vec_DeclNode * v, size_t len); void Vec_delete_DeclNode(Vec_DeclNode * v);
+typedef struct Vec_MemberDeclNode Vec_MemberDeclNode; typedef struct MemberDeclNode * Vec_Element_MemberDeclNode; Vec_MemberDeclNode * Vec_new_MemberDeclNode(void); size_t Vec_len_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode * Vec_ptr_MemberDeclNode(Vec_MemberDeclNode * v); const Vec_Element_MemberDeclNode * Vec_cptr_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode Vec_get_MemberDeclNode(const Vec_MemberDeclNode * v, size_t i); void Vec_set_MemberDeclNode(Vec_MemberDeclNode * v, size_t i, Vec_Element_MemberDeclNode x); void Vec_push_MemberDeclNode(Vec_MemberDeclNode * v, Vec_Element_MemberDeclNode x); Vec_Element_MemberDeclNode Vec_pop_MemberDeclNode(Vec_MemberDeclNode * v); void Vec_reserve_MemberDeclNode(Vec_MemberDeclNode * v, size_t cap); void Vec_resize_MemberDeclNode(Vec_MemberDeclNode * v, size_t len); void Vec_delete_MemberDeclNode(Vec_MemberDeclNode * v);
+typedef struct Vec_EnumeratorDeclNode Vec_EnumeratorDeclNode; typedef struct EnumeratorDeclNode * Vec_Element_EnumeratorDeclNode; Vec_EnumeratorDeclNode * Vec_new_EnumeratorDeclNode(void); size_t Vec_len_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode * Vec_ptr_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); const Vec_Element_EnumeratorDeclNode * Vec_cptr_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode Vec_get_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v, size_t i); void Vec_set_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t i, Vec_Element_EnumeratorDeclNode x); void Vec_push_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, Vec_Element_EnumeratorDeclNode x); Vec_Element_EnumeratorDeclNode Vec_pop_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); void Vec_reserve_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t cap); void Vec_resize_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t len); void Vec_delete_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v);
+typedef struct Vec_AssemblerSymbol Vec_AssemblerSymbol; typedef struct AssemblerSymbol * Vec_Element_AssemblerSymbol; Vec_AssemblerSymbol * Vec_new_AssemblerSymbol(void); size_t Vec_len_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol * Vec_ptr_AssemblerSymbol(Vec_AssemblerSymbol * v); const Vec_Element_AssemblerSymbol * Vec_cptr_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol Vec_get_AssemblerSymbol(const Vec_AssemblerSymbol * v, size_t i); void Vec_set_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t i, Vec_Element_AssemblerSymbol x); void Vec_push_AssemblerSymbol(Vec_AssemblerSymbol * v, Vec_Element_AssemblerSymbol x); Vec_Element_AssemblerSymbol Vec_pop_AssemblerSymbol(Vec_AssemblerSymbol * v); void Vec_reserve_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t cap); void Vec_resize_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t len); void Vec_delete_AssemblerSymbol(Vec_AssemblerSymbol * v);
+typedef struct Map_Symbol Map_Symbol; typedef struct Symbol * Map_Element_Symbol; Map_Symbol * Map_new_Symbol(void); size_t Map_len_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_find_Symbol(const Map_Symbol * m, const char *key); bool Map_insert_Symbol(Map_Symbol * m, const char *key, Map_Element_Symbol x); bool Map_remove_Symbol(Map_Symbol * m, const char *key); size_t Map_cap_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_value_at_Symbol(const Map_Symbol * m, size_t i);
+typedef struct Map_Macro Map_Macro; typedef struct Macro * Map_Element_Macro; Map_Macro * Map_new_Macro(void); size_t Map_len_Macro(const Map_Macro * m); Map_Element_Macro Map_find_Macro(const Map_Macro * m, const char *key); bool Map_insert_Macro(Map_Macro * m, const char *key, Map_Element_Macro x); bool Map_remove_Macro(Map_Macro * m, const char *key); size_t Map_cap_Macro(const Map_Macro * m); Map_Element_Macro Map_value_at_Macro(const Map_Macro * m, size_t i);
+typedef struct Map_SourceFile Map_SourceFile; typedef struct SourceFile * Map_Element_SourceFile; Map_SourceFile * Map_new_SourceFile(void); size_t Map_len_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_find_SourceFile(const Map_SourceFile * m, const char *key); bool Map_insert_SourceFile(Map_SourceFile * m, const char *key, Map_Element_SourceFile x); bool Map_remove_SourceFile(Map_SourceFile * m, const char *key); size_t Map_cap_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_value_at_SourceFile(const Map_SourceFile * m, size_t i);
+typedef struct Map_String Map_String; typedef const char * Map_Element_String; Map_String * Map_new_String(void); size_t Map_len_String(const Map_String * m); Map_Element_String Map_find_String(const Map_String * m, const char *key); bool Map_insert_String(Map_String * m, const char *key, Map_Element_String x); bool Map_remove_String(Map_String * m, const char *key); size_t Map_cap_String(const Map_String * m); Map_Element_String Map_value_at_String(const Map_String * m, size_t i);
+typedef struct Map_AssemblerSymbol Map_AssemblerSymbol; typedef struct AssemblerSymbol * Map_Element_AssemblerSymbol; Map_AssemblerSymbol * Map_new_AssemblerSymbol(void); size_t Map_len_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_find_AssemblerSymbol(const Map_AssemblerSymbol * m, const char *key); bool Map_insert_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key, Map_Element_AssemblerSymbol x); bool Map_remove_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key); size_t Map_cap_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_value_at_AssemblerSymbol(const Map_AssemblerSymbol * m, size_t i);
+typedef struct Arena Arena;
+Arena *Arena_new(void);
+void Arena_delete(Arena *a);
+void *Arena_alloc(Arena *a, size_t size);
+void Arena_release(Arena *a);
+typedef struct ArenaMark {
+    struct ArenaChunk *chunk;
+    size_t used;
+    size_t num_allocations;
+    size_t allocated_bytes;
+} ArenaMark;
+void Arena_mark(const Arena *a, ArenaMark *mark);
+void Arena_reset(Arena *a, const ArenaMark *mark);
+size_t Arena_num_allocations(const Arena *a);
+size_t Arena_allocated_bytes(const Arena *a);
+size_t Arena_reserved_bytes(const Arena *a);
+const char *Intern_string(const char *s);
+const char *Intern_substring(const char *s, size_t len);
+size_t Intern_hash(const char *interned);
+size_t Intern_length(const char *interned);
+typedef struct HiddenSet HiddenSet;
+typedef struct HiddenSetTable HiddenSetTable;
+HiddenSetTable *HiddenSetTable_new(void);
+HiddenSet *HiddenSet_add(HiddenSetTable *t, HiddenSet *set, const char *name);
+bool HiddenSet_contains(const HiddenSet *set, const char *name);
+size_t HiddenSet_len(const HiddenSet *set);
+char *Path_join(const char *dir, const char *rel_path);
+char *Path_dir(const char *path);
+char *Path_base(const char *path);
+char *Path_normalize(const char *path);
+const char *File_read(const char *path);
+const char *File_read_with_size(const char *path, size_t *size);
+typedef struct BinaryWriter BinaryWriter;
+typedef struct BinaryReader BinaryReader;
+BinaryWriter *BinaryWriter_new(void);
+void BinaryWriter_delete(BinaryWriter *w);
+void BinaryWriter_write_byte(BinaryWriter *w, int byte);
+void BinaryWriter_write_int(BinaryWriter *w, int x);
+void BinaryWriter_patch_int(BinaryWriter *w, size_t pos, int x);
+void BinaryWriter_write_bytes(BinaryWriter *w, const char *s, size_t len);
+void BinaryWriter_write_string(BinaryWriter *w, const char *s);
+const char *BinaryWriter_data(const BinaryWriter *w);
+size_t BinaryWriter_len(const BinaryWriter *w);
+bool BinaryWriter_save(const BinaryWriter *w, const char *path);
+BinaryReader *BinaryReader_new(const char *data, size_t size);
+int BinaryReader_read_int(BinaryReader *r);
+const char *BinaryReader_read_bytes(BinaryReader *r, size_t len);
+const char *BinaryReader_read_string(BinaryReader *r);
+bool BinaryReader_at_end(const BinaryReader *r);
+typedef enum ValueCategory {
+    ValueCategory_lvalue,
+    ValueCategory_rvalue,
+} ValueCategory;
+typedef enum TypeKind {
+    TypeKind_void,
+    TypeKind_char,
+    TypeKind_int,
+    TypeKind_pointer,
+    TypeKind_function,
+    TypeKind_array,
+    TypeKind_struct,
+    TypeKind_enum,
+} TypeKind;
+typedef struct Type Type;
+struct Type {
+    TypeKind kind;
+    Type *pointee_type;
+    Type *return_type;
+    Vec_Type * parameter_types;
+    bool is_var_arg;
+    Type *element_type;
+    size_t array_length;
+    struct Symbol *struct_symbol;
+    Vec_MemberDeclNode * member_decls;
+    Vec_Symbol * member_symbols;
+    Type *underlying_type;
+    struct Symbol *enum_symbol;
+    Vec_EnumeratorDeclNode * enumerators;
+};
+Type *VoidType_new(void);
+Type *CharType_new(void);
+Type *IntType_new(void);
+Type *PointerType_new(Type *pointee_type);
+Type *PointerType_pointee_type(const Type *pointer_type);
+Type *FunctionType_new(
+    Type *return_type, Vec_Type * parameter_types, bool is_var_arg);
+Type *FunctionType_return_type(const Type *function_type);
+Vec_Type * FunctionType_parameter_types(const Type *function_type);
+bool FunctionType_is_var_arg(const Type *function_type);
+Type *ArrayType_new(Type *element_type, size_t array_length);
+Type *ArrayType_element_type(const Type *array_type);
+size_t ArrayType_length(const Type *array_type);
+Type *StructType_new(void);
+bool StructType_is_defined(const Type *struct_type);
+struct Symbol *
+StructType_find_member(const Type *struct_type, const char *member_name);
+Type *
+EnumType_new(Type *underlying_type, Vec_EnumeratorDeclNode * enumerators);
+size_t Type_sizeof(const Type *type);
+size_t Type_alignof(const Type *type);
+bool Type_equals(const Type *a, const Type *b);
+bool Type_is_scalar(const Type *type);
+bool Type_is_incomplete_type(const Type *type);
+bool Type_is_function_pointer_type(const Type *type);
+typedef int TokenKind;
+enum TokenKind {
+    TokenKind_unused = 256,
+TokenKind_identifier,
+TokenKind_number,
+TokenKind_character,
+TokenKind_string,
+TokenKind_kw_static,
+TokenKind_kw_typedef,
+TokenKind_kw_const,
+TokenKind_kw_void,
+TokenKind_kw_char,
+TokenKind_kw_int,
+TokenKind_kw_struct,
+TokenKind_kw_enum,
+TokenKind_kw_sizeof,
+TokenKind_kw_if,
+TokenKind_kw_else,
+TokenKind_kw_while,
+TokenKind_kw_do,
+TokenKind_kw_for,
+TokenKind_kw_break,
+TokenKind_kw_continue,
+TokenKind_kw_goto,
+TokenKind_kw_switch,
+TokenKind_kw_case,
+TokenKind_kw_default,
+TokenKind_kw_return,
+TokenKind_arrow,
+TokenKind_lesser_equal,
+TokenKind_greater_equal,
+TokenKind_equal,
+TokenKind_not_equal,
+TokenKind_and_and,
+TokenKind_or_or,
+TokenKind_dot_dot,
+TokenKind_var_arg,
+};
+typedef struct Token {
+    TokenKind kind;
+    bool is_bol;
+    bool has_spaces;
+    int string_len;
+    const char *text;
+    const char *source;
+    size_t offset;
+    size_t length;
+    const char *string;
+    HiddenSet *hidden_set;
+} Token;
+typedef enum StorageClass {
+    StorageClass_none,
+    StorageClass_static,
+    StorageClass_typedef,
+    StorageClass_enum,
+} StorageClass;
+typedef struct Symbol {
+    const char *name;
+    StorageClass storage_class;
+    Type *type;
+    int enum_value;
+    bool has_body;
+    struct NativeAddress *address;
+} Symbol;
+Symbol *Symbol_new(const char *name, StorageClass storage_class, Type *type);
+typedef struct Scope Scope;
+Scope *Scope_new(Scope *parent_scope);
+Scope *Scope_parent_scope(const Scope *s);
+Symbol *Scope_find(Scope *s, const char *name, bool recursive);
+bool Scope_try_register(Scope *s, Symbol *symbol);
+Vec_Symbol * Scope_symbols(const Scope *s);
+typedef enum NodeKind {
+NodeKind_IdentifierExpr,
+   
+
+NodeKind_EnumeratorExpr,
+   
+   
+
+NodeKind_IntegerExpr,
+   
+
+NodeKind_StringExpr,
+   
+   
+
+NodeKind_SubscriptExpr,
+   
+   
+
+NodeKind_CallExpr,
+   
+   
+
+NodeKind_DotExpr,
+   
+   
+
+NodeKind_ArrowExpr,
+   
+   
+
+NodeKind_SizeofExpr,
+   
+   
+
+NodeKind_CastExpr,
+   
+
+
+
+
+
+
+NodeKind_UnaryExpr,
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+NodeKind_BinaryExpr,
+   
+   
+   
+
+NodeKind_AssignExpr,
+   
+   
+
+NodeKind_ImplicitCastExpr,
+   
+   
+
+NodeKind_CompoundStmt,
+   
+
+NodeKind_IfStmt,
+   
+   
+   
+
+NodeKind_WhileStmt,
+   
+   
+
+NodeKind_ForStmt,
+   
+   
+   
+   
+
+NodeKind_ReturnStmt,
+   
+
+NodeKind_DeclStmt,
+   
+   
+
+NodeKind_ExprStmt,
+   
+
+NodeKind_AbstractDirectDeclarator,
+   
+
+NodeKind_DirectDeclarator,
+   
+   
+
+NodeKind_ArrayDeclarator,
+   
+   
+
+NodeKind_FunctionDeclarator,
+   
+   
+   
+
+NodeKind_PointerDeclarator,
+   
+
+NodeKind_InitDeclarator,
+   
+   
+
+NodeKind_GlobalDecl,
+   
+   
+
+NodeKind_FunctionDecl,
+   
+   
+   
+   
+
+NodeKind_MemberDecl,
+   
+   
+
+NodeKind_EnumeratorDecl,
+   
+   
+
+NodeKind_DeclSpec,
+   
+   
+
+NodeKind_TranslationUnit,
+   
+
+} NodeKind;
+typedef struct Node Node;
+typedef struct ExprNode ExprNode;
+typedef struct StmtNode StmtNode;
+typedef struct DeclaratorNode DeclaratorNode;
+typedef struct DeclNode DeclNode;
+typedef struct IdentifierExprNode IdentifierExprNode;
+   
+
+typedef struct EnumeratorExprNode EnumeratorExprNode;
+   
+   
+
+typedef struct IntegerExprNode IntegerExprNode;
+   
+
+typedef struct StringExprNode StringExprNode;
+   
+   
+
+typedef struct SubscriptExprNode SubscriptExprNode;
+   
+   
+
+typedef struct CallExprNode CallExprNode;
+   
+   
+
+typedef struct DotExprNode DotExprNode;
+   
+   
+
+typedef struct ArrowExprNode ArrowExprNode;
+   
+   
+
+typedef struct SizeofExprNode SizeofExprNode;
+   
+   
+
+typedef struct CastExprNode CastExprNode;
+   
+
+
+
+
+
+
+typedef struct UnaryExprNode UnaryExprNode;
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct BinaryExprNode BinaryExprNode;
+   
+   
+   
+
+typedef struct AssignExprNode AssignExprNode;
+   
+   
+
+typedef struct ImplicitCastExprNode ImplicitCastExprNode;
+   
+   
+
+typedef struct CompoundStmtNode CompoundStmtNode;
+   
+
+typedef struct IfStmtNode IfStmtNode;
+   
+   
+   
+
+typedef struct WhileStmtNode WhileStmtNode;
+   
+   
+
+typedef struct ForStmtNode ForStmtNode;
+   
+   
+   
+   
+
+typedef struct ReturnStmtNode ReturnStmtNode;
+   
+
+typedef struct DeclStmtNode DeclStmtNode;
+   
+   
+
+typedef struct ExprStmtNode ExprStmtNode;
+   
+
+typedef struct AbstractDirectDeclaratorNode AbstractDirectDeclaratorNode;
+   
+
+typedef struct DirectDeclaratorNode DirectDeclaratorNode;
+   
+   
+
+typedef struct ArrayDeclaratorNode ArrayDeclaratorNode;
+   
+   
+
+typedef struct FunctionDeclaratorNode FunctionDeclaratorNode;
+   
+   
+   
+
+typedef struct PointerDeclaratorNode PointerDeclaratorNode;
+   
+
+typedef struct InitDeclaratorNode InitDeclaratorNode;
+   
+   
+
+typedef struct GlobalDeclNode GlobalDeclNode;
+   
+   
+
+typedef struct FunctionDeclNode FunctionDeclNode;
+   
+   
+   
+   
+
+typedef struct MemberDeclNode MemberDeclNode;
+   
+   
+
+typedef struct EnumeratorDeclNode EnumeratorDeclNode;
+   
+   
+
+typedef struct DeclSpecNode DeclSpecNode;
+   
+   
+
+typedef struct TranslationUnitNode TranslationUnitNode;
+   
+
+struct Node {
+    NodeKind kind;
+};
+struct ExprNode {
+    NodeKind kind;
+    Type *result_type;
+    ValueCategory value_category;
+};
+struct StmtNode {
+    NodeKind kind;
+};
+struct DeclaratorNode {
+    NodeKind kind;
+};
+struct DeclNode {
+    NodeKind kind;
+};
+typedef enum UnaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+UnaryOp_positive,
+UnaryOp_negative,
+UnaryOp_not,
+UnaryOp_address_of,
+UnaryOp_indirection,
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} UnaryOp;
+typedef enum BinaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+BinaryOp_add,
+BinaryOp_sub,
+BinaryOp_mul,
+BinaryOp_div,
+BinaryOp_mod,
+BinaryOp_lesser_than,
+BinaryOp_lesser_equal,
+BinaryOp_greater_than,
+BinaryOp_greater_equal,
+BinaryOp_equal,
+BinaryOp_and,
+BinaryOp_not_equal,
+BinaryOp_logical_and,
+BinaryOp_logical_or,
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} BinaryOp;
+typedef enum ImplicitCastOp {
+    ImplicitCastOp_lvalue_to_rvalue,
+    ImplicitCastOp_function_to_function_pointer,
+    ImplicitCastOp_array_to_pointer,
+    ImplicitCastOp_integral_cast,
+    ImplicitCastOp_integer_to_pointer_cast,
+    ImplicitCastOp_pointer_to_pointer_cast,
+} ImplicitCastOp;
+Node *IdentifierExprNode_base_node(IdentifierExprNode *p); const Node *IdentifierExprNode_cbase_node(const IdentifierExprNode *p); ExprNode *IdentifierExprNode_base(IdentifierExprNode *p); const ExprNode *IdentifierExprNode_cbase(const IdentifierExprNode *p); IdentifierExprNode *IdentifierExprNode_cast_node(Node *p); const IdentifierExprNode *IdentifierExprNode_ccast_node(const Node *p); IdentifierExprNode *IdentifierExprNode_cast(ExprNode *p); const IdentifierExprNode *IdentifierExprNode_ccast(const ExprNode *p); struct IdentifierExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+};
+Node *EnumeratorExprNode_base_node(EnumeratorExprNode *p); const Node *EnumeratorExprNode_cbase_node(const EnumeratorExprNode *p); ExprNode *EnumeratorExprNode_base(EnumeratorExprNode *p); const ExprNode *EnumeratorExprNode_cbase(const EnumeratorExprNode *p); EnumeratorExprNode *EnumeratorExprNode_cast_node(Node *p); const EnumeratorExprNode *EnumeratorExprNode_ccast_node(const Node *p); EnumeratorExprNode *EnumeratorExprNode_cast(ExprNode *p); const EnumeratorExprNode *EnumeratorExprNode_ccast(const ExprNode *p); struct EnumeratorExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+    int value;
+};
+Node *IntegerExprNode_base_node(IntegerExprNode *p); const Node *IntegerExprNode_cbase_node(const IntegerExprNode *p); ExprNode *IntegerExprNode_base(IntegerExprNode *p); const ExprNode *IntegerExprNode_cbase(const IntegerExprNode *p); IntegerExprNode *IntegerExprNode_cast_node(Node *p); const IntegerExprNode *IntegerExprNode_ccast_node(const Node *p); IntegerExprNode *IntegerExprNode_cast(ExprNode *p); const IntegerExprNode *IntegerExprNode_ccast(const ExprNode *p); struct IntegerExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    int value;
+};
+Node *StringExprNode_base_node(StringExprNode *p); const Node *StringExprNode_cbase_node(const StringExprNode *p); ExprNode *StringExprNode_base(StringExprNode *p); const ExprNode *StringExprNode_cbase(const StringExprNode *p); StringExprNode *StringExprNode_cast_node(Node *p); const StringExprNode *StringExprNode_ccast_node(const Node *p); StringExprNode *StringExprNode_cast(ExprNode *p); const StringExprNode *StringExprNode_ccast(const ExprNode *p); struct StringExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    const char * value;
+    size_t length;
+};
+Node *SubscriptExprNode_base_node(SubscriptExprNode *p); const Node *SubscriptExprNode_cbase_node(const SubscriptExprNode *p); ExprNode *SubscriptExprNode_base(SubscriptExprNode *p); const ExprNode *SubscriptExprNode_cbase(const SubscriptExprNode *p); SubscriptExprNode *SubscriptExprNode_cast_node(Node *p); const SubscriptExprNode *SubscriptExprNode_ccast_node(const Node *p); SubscriptExprNode *SubscriptExprNode_cast(ExprNode *p); const SubscriptExprNode *SubscriptExprNode_ccast(const ExprNode *p); struct SubscriptExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * array;
+    ExprNode * index;
+};
+Node *CallExprNode_base_node(CallExprNode *p); const Node *CallExprNode_cbase_node(const CallExprNode *p); ExprNode *CallExprNode_base(CallExprNode *p); const ExprNode *CallExprNode_cbase(const CallExprNode *p); CallExprNode *CallExprNode_cast_node(Node *p); const CallExprNode *CallExprNode_ccast_node(const Node *p); CallExprNode *CallExprNode_cast(ExprNode *p); const CallExprNode *CallExprNode_ccast(const ExprNode *p); struct CallExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * callee;
+    Vec_ExprNode * arguments;
+};
+Node *DotExprNode_base_node(DotExprNode *p); const Node *DotExprNode_cbase_node(const DotExprNode *p); ExprNode *DotExprNode_base(DotExprNode *p); const ExprNode *DotExprNode_cbase(const DotExprNode *p); DotExprNode *DotExprNode_cast_node(Node *p); const DotExprNode *DotExprNode_ccast_node(const Node *p); DotExprNode *DotExprNode_cast(ExprNode *p); const DotExprNode *DotExprNode_ccast(const ExprNode *p); struct DotExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *ArrowExprNode_base_node(ArrowExprNode *p); const Node *ArrowExprNode_cbase_node(const ArrowExprNode *p); ExprNode *ArrowExprNode_base(ArrowExprNode *p); const ExprNode *ArrowExprNode_cbase(const ArrowExprNode *p); ArrowExprNode *ArrowExprNode_cast_node(Node *p); const ArrowExprNode *ArrowExprNode_ccast_node(const Node *p); ArrowExprNode *ArrowExprNode_cast(ExprNode *p); const ArrowExprNode *ArrowExprNode_ccast(const ExprNode *p); struct ArrowExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *SizeofExprNode_base_node(SizeofExprNode *p); const Node *SizeofExprNode_cbase_node(const SizeofExprNode *p); ExprNode *SizeofExprNode_base(SizeofExprNode *p); const ExprNode *SizeofExprNode_cbase(const SizeofExprNode *p); SizeofExprNode *SizeofExprNode_cast_node(Node *p); const SizeofExprNode *SizeofExprNode_ccast_node(const Node *p); SizeofExprNode *SizeofExprNode_cast(ExprNode *p); const SizeofExprNode *SizeofExprNode_ccast(const ExprNode *p); struct SizeofExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Type * type;
+    ExprNode * expression;
+};
+Node *CastExprNode_base_node(CastExprNode *p); const Node *CastExprNode_cbase_node(const CastExprNode *p); ExprNode *CastExprNode_base(CastExprNode *p); const ExprNode *CastExprNode_cbase(const CastExprNode *p); CastExprNode *CastExprNode_cast_node(Node *p); const CastExprNode *CastExprNode_ccast_node(const Node *p); CastExprNode *CastExprNode_cast(ExprNode *p); const CastExprNode *CastExprNode_ccast(const ExprNode *p); struct CastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * expression;
+};
+
+
+
+
+
+Node *UnaryExprNode_base_node(UnaryExprNode *p); const Node *UnaryExprNode_cbase_node(const UnaryExprNode *p); ExprNode *UnaryExprNode_base(UnaryExprNode *p); const ExprNode *UnaryExprNode_cbase(const UnaryExprNode *p); UnaryExprNode *UnaryExprNode_cast_node(Node *p); const UnaryExprNode *UnaryExprNode_ccast_node(const Node *p); UnaryExprNode *UnaryExprNode_cast(ExprNode *p); const UnaryExprNode *UnaryExprNode_ccast(const ExprNode *p); struct UnaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    UnaryOp operator;
+    ExprNode * operand;
+};
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+Node *BinaryExprNode_base_node(BinaryExprNode *p); const Node *BinaryExprNode_cbase_node(const BinaryExprNode *p); ExprNode *BinaryExprNode_base(BinaryExprNode *p); const ExprNode *BinaryExprNode_cbase(const BinaryExprNode *p); BinaryExprNode *BinaryExprNode_cast_node(Node *p); const BinaryExprNode *BinaryExprNode_ccast_node(const Node *p); BinaryExprNode *BinaryExprNode_cast(ExprNode *p); const BinaryExprNode *BinaryExprNode_ccast(const ExprNode *p); struct BinaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    BinaryOp operator;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *AssignExprNode_base_node(AssignExprNode *p); const Node *AssignExprNode_cbase_node(const AssignExprNode *p); ExprNode *AssignExprNode_base(AssignExprNode *p); const ExprNode *AssignExprNode_cbase(const AssignExprNode *p); AssignExprNode *AssignExprNode_cast_node(Node *p); const AssignExprNode *AssignExprNode_ccast_node(const Node *p); AssignExprNode *AssignExprNode_cast(ExprNode *p); const AssignExprNode *AssignExprNode_ccast(const ExprNode *p); struct AssignExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *ImplicitCastExprNode_base_node(ImplicitCastExprNode *p); const Node *ImplicitCastExprNode_cbase_node(const ImplicitCastExprNode *p); ExprNode *ImplicitCastExprNode_base(ImplicitCastExprNode *p); const ExprNode *ImplicitCastExprNode_cbase(const ImplicitCastExprNode *p); ImplicitCastExprNode *ImplicitCastExprNode_cast_node(Node *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast_node(const Node *p); ImplicitCastExprNode *ImplicitCastExprNode_cast(ExprNode *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast(const ExprNode *p); struct ImplicitCastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ImplicitCastOp operator;
+    ExprNode * expression;
+};
+Node *CompoundStmtNode_base_node(CompoundStmtNode *p); const Node *CompoundStmtNode_cbase_node(const CompoundStmtNode *p); StmtNode *CompoundStmtNode_base(CompoundStmtNode *p); const StmtNode *CompoundStmtNode_cbase(const CompoundStmtNode *p); CompoundStmtNode *CompoundStmtNode_cast_node(Node *p); const CompoundStmtNode *CompoundStmtNode_ccast_node(const Node *p); CompoundStmtNode *CompoundStmtNode_cast(StmtNode *p); const CompoundStmtNode *CompoundStmtNode_ccast(const StmtNode *p); struct CompoundStmtNode { NodeKind kind;
+    Vec_StmtNode * statements;
+};
+Node *IfStmtNode_base_node(IfStmtNode *p); const Node *IfStmtNode_cbase_node(const IfStmtNode *p); StmtNode *IfStmtNode_base(IfStmtNode *p); const StmtNode *IfStmtNode_cbase(const IfStmtNode *p); IfStmtNode *IfStmtNode_cast_node(Node *p); const IfStmtNode *IfStmtNode_ccast_node(const Node *p); IfStmtNode *IfStmtNode_cast(StmtNode *p); const IfStmtNode *IfStmtNode_ccast(const StmtNode *p); struct IfStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * if_true;
+    StmtNode * if_false;
+};
+Node *WhileStmtNode_base_node(WhileStmtNode *p); const Node *WhileStmtNode_cbase_node(const WhileStmtNode *p); StmtNode *WhileStmtNode_base(WhileStmtNode *p); const StmtNode *WhileStmtNode_cbase(const WhileStmtNode *p); WhileStmtNode *WhileStmtNode_cast_node(Node *p); const WhileStmtNode *WhileStmtNode_ccast_node(const Node *p); WhileStmtNode *WhileStmtNode_cast(StmtNode *p); const WhileStmtNode *WhileStmtNode_ccast(const StmtNode *p); struct WhileStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * body;
+};
+Node *ForStmtNode_base_node(ForStmtNode *p); const Node *ForStmtNode_cbase_node(const ForStmtNode *p); StmtNode *ForStmtNode_base(ForStmtNode *p); const StmtNode *ForStmtNode_cbase(const ForStmtNode *p); ForStmtNode *ForStmtNode_cast_node(Node *p); const ForStmtNode *ForStmtNode_ccast_node(const Node *p); ForStmtNode *ForStmtNode_cast(StmtNode *p); const ForStmtNode *ForStmtNode_ccast(const StmtNode *p); struct ForStmtNode { NodeKind kind;
+    StmtNode * initializer;
+    ExprNode * condition;
+    ExprNode * step;
+    StmtNode * body;
+};
+Node *ReturnStmtNode_base_node(ReturnStmtNode *p); const Node *ReturnStmtNode_cbase_node(const ReturnStmtNode *p); StmtNode *ReturnStmtNode_base(ReturnStmtNode *p); const StmtNode *ReturnStmtNode_cbase(const ReturnStmtNode *p); ReturnStmtNode *ReturnStmtNode_cast_node(Node *p); const ReturnStmtNode *ReturnStmtNode_ccast_node(const Node *p); ReturnStmtNode *ReturnStmtNode_cast(StmtNode *p); const ReturnStmtNode *ReturnStmtNode_ccast(const StmtNode *p); struct ReturnStmtNode { NodeKind kind;
+    ExprNode * return_value;
+};
+Node *DeclStmtNode_base_node(DeclStmtNode *p); const Node *DeclStmtNode_cbase_node(const DeclStmtNode *p); StmtNode *DeclStmtNode_base(DeclStmtNode *p); const StmtNode *DeclStmtNode_cbase(const DeclStmtNode *p); DeclStmtNode *DeclStmtNode_cast_node(Node *p); const DeclStmtNode *DeclStmtNode_ccast_node(const Node *p); DeclStmtNode *DeclStmtNode_cast(StmtNode *p); const DeclStmtNode *DeclStmtNode_ccast(const StmtNode *p); struct DeclStmtNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *ExprStmtNode_base_node(ExprStmtNode *p); const Node *ExprStmtNode_cbase_node(const ExprStmtNode *p); StmtNode *ExprStmtNode_base(ExprStmtNode *p); const StmtNode *ExprStmtNode_cbase(const ExprStmtNode *p); ExprStmtNode *ExprStmtNode_cast_node(Node *p); const ExprStmtNode *ExprStmtNode_ccast_node(const Node *p); ExprStmtNode *ExprStmtNode_cast(StmtNode *p); const ExprStmtNode *ExprStmtNode_ccast(const StmtNode *p); struct ExprStmtNode { NodeKind kind;
+    ExprNode * expression;
+};
+Node *AbstractDirectDeclaratorNode_base_node(AbstractDirectDeclaratorNode *p); const Node *AbstractDirectDeclaratorNode_cbase_node(const AbstractDirectDeclaratorNode *p); DeclaratorNode *AbstractDirectDeclaratorNode_base(AbstractDirectDeclaratorNode *p); const DeclaratorNode *AbstractDirectDeclaratorNode_cbase(const AbstractDirectDeclaratorNode *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast_node(Node *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast_node(const Node *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast(DeclaratorNode *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast(const DeclaratorNode *p); struct AbstractDirectDeclaratorNode { NodeKind kind;
+    Symbol * symbol;
+};
+Node *DirectDeclaratorNode_base_node(DirectDeclaratorNode *p); const Node *DirectDeclaratorNode_cbase_node(const DirectDeclaratorNode *p); DeclaratorNode *DirectDeclaratorNode_base(DirectDeclaratorNode *p); const DeclaratorNode *DirectDeclaratorNode_cbase(const DirectDeclaratorNode *p); DirectDeclaratorNode *DirectDeclaratorNode_cast_node(Node *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast_node(const Node *p); DirectDeclaratorNode *DirectDeclaratorNode_cast(DeclaratorNode *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast(const DeclaratorNode *p); struct DirectDeclaratorNode { NodeKind kind;
+    const char * name;
+    Symbol * symbol;
+};
+Node *ArrayDeclaratorNode_base_node(ArrayDeclaratorNode *p); const Node *ArrayDeclaratorNode_cbase_node(const ArrayDeclaratorNode *p); DeclaratorNode *ArrayDeclaratorNode_base(ArrayDeclaratorNode *p); const DeclaratorNode *ArrayDeclaratorNode_cbase(const ArrayDeclaratorNode *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast_node(Node *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast_node(const Node *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast(DeclaratorNode *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast(const DeclaratorNode *p); struct ArrayDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * array_size;
+};
+Node *FunctionDeclaratorNode_base_node(FunctionDeclaratorNode *p); const Node *FunctionDeclaratorNode_cbase_node(const FunctionDeclaratorNode *p); DeclaratorNode *FunctionDeclaratorNode_base(FunctionDeclaratorNode *p); const DeclaratorNode *FunctionDeclaratorNode_cbase(const FunctionDeclaratorNode *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast_node(Node *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast_node(const Node *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast(DeclaratorNode *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast(const DeclaratorNode *p); struct FunctionDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    Vec_DeclaratorNode * parameters;
+    bool is_var_arg;
+};
+Node *PointerDeclaratorNode_base_node(PointerDeclaratorNode *p); const Node *PointerDeclaratorNode_cbase_node(const PointerDeclaratorNode *p); DeclaratorNode *PointerDeclaratorNode_base(PointerDeclaratorNode *p); const DeclaratorNode *PointerDeclaratorNode_cbase(const PointerDeclaratorNode *p); PointerDeclaratorNode *PointerDeclaratorNode_cast_node(Node *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast_node(const Node *p); PointerDeclaratorNode *PointerDeclaratorNode_cast(DeclaratorNode *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast(const DeclaratorNode *p); struct PointerDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+};
+Node *InitDeclaratorNode_base_node(InitDeclaratorNode *p); const Node *InitDeclaratorNode_cbase_node(const InitDeclaratorNode *p); DeclaratorNode *InitDeclaratorNode_base(InitDeclaratorNode *p); const DeclaratorNode *InitDeclaratorNode_cbase(const InitDeclaratorNode *p); InitDeclaratorNode *InitDeclaratorNode_cast_node(Node *p); const InitDeclaratorNode *InitDeclaratorNode_ccast_node(const Node *p); InitDeclaratorNode *InitDeclaratorNode_cast(DeclaratorNode *p); const InitDeclaratorNode *InitDeclaratorNode_ccast(const DeclaratorNode *p); struct InitDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * initializer;
+};
+Node *GlobalDeclNode_base_node(GlobalDeclNode *p); const Node *GlobalDeclNode_cbase_node(const GlobalDeclNode *p); DeclNode *GlobalDeclNode_base(GlobalDeclNode *p); const DeclNode *GlobalDeclNode_cbase(const GlobalDeclNode *p); GlobalDeclNode *GlobalDeclNode_cast_node(Node *p); const GlobalDeclNode *GlobalDeclNode_ccast_node(const Node *p); GlobalDeclNode *GlobalDeclNode_cast(DeclNode *p); const GlobalDeclNode *GlobalDeclNode_ccast(const DeclNode *p); struct GlobalDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *FunctionDeclNode_base_node(FunctionDeclNode *p); const Node *FunctionDeclNode_cbase_node(const FunctionDeclNode *p); DeclNode *FunctionDeclNode_base(FunctionDeclNode *p); const DeclNode *FunctionDeclNode_cbase(const FunctionDeclNode *p); FunctionDeclNode *FunctionDeclNode_cast_node(Node *p); const FunctionDeclNode *FunctionDeclNode_ccast_node(const Node *p); FunctionDeclNode *FunctionDeclNode_cast(DeclNode *p); const FunctionDeclNode *FunctionDeclNode_ccast(const DeclNode *p); struct FunctionDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    DeclaratorNode * declarator;
+    StmtNode * body;
+    Vec_Symbol * local_variables;
+};
+Node *MemberDeclNode_base_node(MemberDeclNode *p); const Node *MemberDeclNode_cbase_node(const MemberDeclNode *p); DeclNode *MemberDeclNode_base(MemberDeclNode *p); const DeclNode *MemberDeclNode_cbase(const MemberDeclNode *p); MemberDeclNode *MemberDeclNode_cast_node(Node *p); const MemberDeclNode *MemberDeclNode_ccast_node(const Node *p); MemberDeclNode *MemberDeclNode_cast(DeclNode *p); const MemberDeclNode *MemberDeclNode_ccast(const DeclNode *p); struct MemberDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *EnumeratorDeclNode_base_node(EnumeratorDeclNode *p); const Node *EnumeratorDeclNode_cbase_node(const EnumeratorDeclNode *p); DeclNode *EnumeratorDeclNode_base(EnumeratorDeclNode *p); const DeclNode *EnumeratorDeclNode_cbase(const EnumeratorDeclNode *p); EnumeratorDeclNode *EnumeratorDeclNode_cast_node(Node *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast_node(const Node *p); EnumeratorDeclNode *EnumeratorDeclNode_cast(DeclNode *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast(const DeclNode *p); struct EnumeratorDeclNode { NodeKind kind;
+    Symbol * symbol;
+    ExprNode * value;
+};
+Node *DeclSpecNode_base_node(DeclSpecNode *p); const Node *DeclSpecNode_cbase_node(const DeclSpecNode *p); Node *DeclSpecNode_base(DeclSpecNode *p); const Node *DeclSpecNode_cbase(const DeclSpecNode *p); DeclSpecNode *DeclSpecNode_cast_node(Node *p); const DeclSpecNode *DeclSpecNode_ccast_node(const Node *p); DeclSpecNode *DeclSpecNode_cast(Node *p); const DeclSpecNode *DeclSpecNode_ccast(const Node *p); struct DeclSpecNode { NodeKind kind;
+    StorageClass storage_class;
+    Type * base_type;
+};
+Node *TranslationUnitNode_base_node(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase_node(const TranslationUnitNode *p); Node *TranslationUnitNode_base(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase(const TranslationUnitNode *p); TranslationUnitNode *TranslationUnitNode_cast_node(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast_node(const Node *p); TranslationUnitNode *TranslationUnitNode_cast(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast(const Node *p); struct TranslationUnitNode { NodeKind kind;
+    Vec_DeclNode * declarations;
+};
+IdentifierExprNode *IdentifierExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol);
+EnumeratorExprNode *EnumeratorExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol, int value);
+IntegerExprNode *
+IntegerExprNode_new(Type *result_type, ValueCategory value_category, int value);
+StringExprNode *StringExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    const char *string,
+    size_t length);
+SubscriptExprNode *SubscriptExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *array,
+    ExprNode *index);
+CallExprNode *CallExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *callee,
+    Vec_ExprNode * arguments);
+DotExprNode *DotExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+ArrowExprNode *ArrowExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+SizeofExprNode *SizeofExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    Type *type,
+    ExprNode *expression);
+CastExprNode *CastExprNode_new(
+    Type *result_type, ValueCategory value_category, ExprNode *expression);
+UnaryExprNode *UnaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    UnaryOp
+    operator,
+    ExprNode *operand);
+BinaryExprNode *BinaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    BinaryOp
+    operator,
+    ExprNode *lhs,
+    ExprNode *rhs);
+AssignExprNode *AssignExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *lhs,
+    ExprNode *rhs);
+ImplicitCastExprNode *ImplicitCastExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ImplicitCastOp
+    operator,
+    ExprNode *expression);
+CompoundStmtNode *CompoundStmtNode_new(Vec_StmtNode * statements);
+IfStmtNode *
+IfStmtNode_new(ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+WhileStmtNode *WhileStmtNode_new(ExprNode *condition, StmtNode *body);
+ForStmtNode *ForStmtNode_new(
+    StmtNode *initializer, ExprNode *condition, ExprNode *step, StmtNode *body);
+ReturnStmtNode *ReturnStmtNode_new(ExprNode *return_value);
+DeclStmtNode *
+DeclStmtNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+ExprStmtNode *ExprStmtNode_new(ExprNode *expression);
+AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_new(void);
+DirectDeclaratorNode *DirectDeclaratorNode_new(const char *name);
+ArrayDeclaratorNode *
+ArrayDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *array_size);
+FunctionDeclaratorNode *FunctionDeclaratorNode_new(
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+PointerDeclaratorNode *PointerDeclaratorNode_new(DeclaratorNode *declarator);
+InitDeclaratorNode *
+InitDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *initializer);
+Symbol *DeclaratorNode_symbol(const DeclaratorNode *p);
+Vec_DeclaratorNode * DeclaratorNode_parameters(const DeclaratorNode *p);
+GlobalDeclNode *
+GlobalDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+FunctionDeclNode *FunctionDeclNode_new(
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body,
+    Vec_Symbol * local_variables);
+MemberDeclNode *
+MemberDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+EnumeratorDeclNode *EnumeratorDeclNode_new(Symbol *symbol, ExprNode *value);
+DeclSpecNode *DeclSpecNode_new(StorageClass storage_class, Type *base_type);
+TranslationUnitNode *TranslationUnitNode_new(Vec_DeclNode * declarations);
+void Node_dump(const Node *p, FILE *fp);
+Arena *Node_arena(void);
+void Node_release_arena(void);
+typedef enum ScanLevel {
+    ScanLevel_scalar,
+    ScanLevel_sse2,
+    ScanLevel_avx2,
+} ScanLevel;
+ScanLevel Scan_max_level(void);
+ScanLevel Scan_level(void);
+void Scan_set_level(ScanLevel level);
+size_t Scan_spaces(const char *s);
+size_t Scan_digits(const char *s);
+size_t Scan_identifier(const char *s);
+size_t Scan_literal(const char *s, char quote);
+typedef struct Lexer Lexer;
+void Lexer_init_tables(void);
+Lexer *Lexer_new(const char *filename, const char *text);
+Token *Lexer_read(Lexer *l);
+Vec_Token * Lexer_read_all(Lexer *l);
+const char *Lexer_directive_at(const Vec_Token * tokens, size_t i);
+typedef struct SourceFile {
+    const char *path;
+    const char *text;
+    Vec_Token * tokens;
+    const char *guard_macro;
+} SourceFile;
+const SourceFile *SourceCache_load(const char *path);
+typedef struct Macro {
+    const char *name;
+    Vec_String * parameters;
+    Vec_Token * contents;
+} Macro;
+Macro *
+Macro_new(const char *name, Vec_String * parameters, Vec_Token * contents);
+Macro *Macro_new_simple(const char *name, Vec_Token * contents);
+bool Macro_is_function(const Macro *m);
+typedef struct Preprocessor Preprocessor;
+Preprocessor *Preprocessor_new(Vec_String * include_paths);
+void Preprocessor_begin(
+    Preprocessor *pp, const char *filename, const char *text);
+Token *Preprocessor_next(Preprocessor *pp);
+Vec_Token *
+    Preprocessor_run(Preprocessor *pp, const char *filename, const char *text);
+void Preprocessor_define_macro(Preprocessor *pp, Macro *macro);
+const Map_Macro * Preprocessor_macros(const Preprocessor *pp);
+void Preprocessor_mark_once(Preprocessor *pp, const char *path);
+const Map_String * Preprocessor_once_files(const Preprocessor *pp);
+Vec_Token *
+    Preprocessor_read(
+        Vec_String * include_paths, const char *filename, const char *text);
+void TokenStream_write(BinaryWriter *w, const Vec_Token * tokens);
+bool TokenStream_is_binary(const char *data, size_t size);
+Vec_Token * TokenStream_read(const char *data, size_t size);
+void TokenStream_print(const Vec_Token * tokens, FILE *fp);
+typedef struct TokenSource TokenSource;
+TokenSource *TokenSource_from_vec(const Vec_Token * tokens);
+TokenSource *TokenSource_from_preprocessor(Preprocessor *pp);
+Token *TokenSource_next(TokenSource *source);
+Vec_Token * TokenSource_read_all(TokenSource *source);
+typedef struct Parser Parser;
+Parser *Parser_new(const Vec_Token * tokens);
+Parser *Parser_new_from_source(TokenSource *source);
+TranslationUnitNode *Parser_parse(Parser *p);
+DeclNode *Parser_parse_next_decl(Parser *p);
+void Parser_release_function_decl(Parser *p, FunctionDeclNode *node);
+struct Sema *Parser_sema(Parser *p);
+typedef struct Sema Sema;
+Sema *Sema_new(void);
+Scope *Sema_global_variable_scope(const Sema *s);
+Scope *Sema_global_struct_scope(const Sema *s);
+Scope *Sema_global_enum_scope(const Sema *s);
+Type *Sema_act_on_struct_type_reference(Sema *s, const Token *identifier);
+Type *
+Sema_act_on_struct_type_start_of_member_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_struct_type_end_of_member_list(
+    Sema *s, Type *struct_type, Vec_MemberDeclNode * member_decls);
+MemberDeclNode *Sema_act_on_struct_type_member_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+Type *Sema_act_on_enum_type_reference(Sema *s, const Token *identifier);
+void Sema_act_on_enum_type_start_of_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_enum_type_end_of_list(
+    Sema *s, const Token *identifier, Vec_EnumeratorDeclNode * enumerators);
+EnumeratorDeclNode *
+Sema_act_on_enumerator(Sema *s, const Token *identifier, ExprNode *value);
+bool Sema_is_typedef_name(Sema *s, const Token *identifier);
+Type *Sema_act_on_typedef_name(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_identifier_expr(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_integer_expr(Sema *s, const Token *integer);
+ExprNode *Sema_act_on_character_expr(Sema *s, const Token *character);
+ExprNode *Sema_act_on_string_expr(Sema *s, const Token *string);
+ExprNode *Sema_act_on_subscript_expr(Sema *s, ExprNode *array, ExprNode *index);
+ExprNode *
+Sema_act_on_call_expr(Sema *s, ExprNode *callee, Vec_ExprNode * arguments);
+ExprNode *
+Sema_act_on_dot_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *
+Sema_act_on_arrow_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *Sema_act_on_sizeof_expr_type(Sema *s, Type *type);
+ExprNode *Sema_act_on_sizeof_expr_expr(Sema *s, ExprNode *expression);
+ExprNode *
+Sema_act_on_cast_expr(Sema *s, Type *destination_type, ExprNode *expression);
+ExprNode *
+Sema_act_on_unary_expr(Sema *s, const Token *operator, ExprNode *operand);
+ExprNode *Sema_act_on_binary_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+ExprNode *Sema_act_on_assign_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+void Sema_act_on_compound_stmt_begin(Sema *s);
+StmtNode *Sema_act_on_compound_stmt_end(Sema *s, Vec_StmtNode * statements);
+StmtNode *Sema_act_on_if_stmt(
+    Sema *s, ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+StmtNode *Sema_act_on_while_stmt(Sema *s, ExprNode *condition, StmtNode *body);
+void Sema_act_on_for_stmt_start(Sema *s);
+StmtNode *Sema_act_on_for_stmt_end(
+    Sema *s,
+    StmtNode *initializer,
+    ExprNode *condition,
+    ExprNode *step,
+    StmtNode *body);
+StmtNode *Sema_act_on_return_stmt(Sema *s, ExprNode *return_value);
+StmtNode *Sema_act_on_decl_stmt(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+StmtNode *Sema_act_on_expr_stmt(Sema *s, ExprNode *expression);
+DeclaratorNode *Sema_act_on_abstract_direct_declarator(Sema *s);
+DeclaratorNode *Sema_act_on_direct_declarator(Sema *s, const Token *identifier);
+DeclaratorNode *Sema_act_on_array_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *array_size);
+void Sema_act_on_function_declarator_start_of_parameter_list(Sema *s);
+DeclaratorNode *Sema_act_on_function_declarator_end_of_parameter_list(
+    Sema *s,
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+DeclaratorNode *
+Sema_act_on_pointer_declarator(Sema *s, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_declarator_completed(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_init_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *initializer);
+DeclSpecNode *
+Sema_act_on_decl_spec(Sema *s, StorageClass storage_class, Type *base_type);
+DeclaratorNode *Sema_act_on_parameter_decl(Sema *s, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_global_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+void Sema_act_on_function_decl_start_of_body(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_function_decl_end_of_body(
+    Sema *s,
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body);
+void Driver_preprocess(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    bool binary);
+void Driver_compile(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    int num_jobs,
+    bool object);
+int Driver_run(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    int num_jobs,
+    int argc,
+    char **argv);
+void Driver_compile_all(
+    Vec_String * include_paths,
+    const char *pch_path,
+    Vec_String * inputs,
+    const char *output_dir,
+    int num_jobs,
+    bool object);
+typedef enum TimeReportPhase {
+    TimeReportPhase_other,
+    TimeReportPhase_read,
+    TimeReportPhase_lex,
+    TimeReportPhase_preprocess,
+    TimeReportPhase_expand,
+    TimeReportPhase_parse,
+    TimeReportPhase_codegen,
+    TimeReportPhase_assemble,
+    TimeReportPhase_count,
+} TimeReportPhase;
+void TimeReport_enable(void);
+bool TimeReport_is_enabled(void);
+void TimeReport_begin(TimeReportPhase phase);
+void TimeReport_end(TimeReportPhase phase);
+void TimeReport_print(bool json);
+void TimeReport_allocate(size_t size);
+typedef struct StringPool StringPool;
+StringPool *StringPool_new(void);
+void StringPool_delete(StringPool *pool);
+size_t StringPool_add(StringPool *pool, const char *s, size_t len);
+size_t StringPool_len(const StringPool *pool);
+const char *StringPool_string(const StringPool *pool, size_t entry);
+size_t StringPool_length(const StringPool *pool, size_t entry);
+bool StringPool_has_nul(const StringPool *pool, size_t entry);
+void StringPool_merge_suffixes(StringPool *pool);
+size_t StringPool_root(const StringPool *pool, size_t entry, size_t *offset);
+typedef struct Emitter Emitter;
+Emitter *Emitter_new(FILE *fp);
+void Emitter_delete(Emitter *e);
+void Emitter_flush(Emitter *e);
+void Emitter_write(Emitter *e, const char *s);
+void Emitter_write_bytes(Emitter *e, const char *s, size_t len);
+void Emitter_write_char(Emitter *e, char c);
+void Emitter_write_size(Emitter *e, size_t x);
+void Emitter_write_int(Emitter *e, int x);
+void Emitter_write_signed_int(Emitter *e, int x);
+void Emitter_write_hex_byte(Emitter *e, int x);
+void Emitter_append(Emitter *e, const Emitter *other);
+const char *Emitter_data(const Emitter *e, size_t *len);
+typedef struct CodeGen CodeGen;
+CodeGen *CodeGen_new(FILE *fp);
+void CodeGen_delete(CodeGen *g);
+void CodeGen_gen_decl(CodeGen *g, DeclNode *p);
+void CodeGen_finish(CodeGen *g);
+const char *CodeGen_output(const CodeGen *g, size_t *len);
+void CodeGen_gen(TranslationUnitNode *p, FILE *fp);
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs);
+typedef struct AssemblerSymbol AssemblerSymbol;
+void Assembler_assemble(const char *text, size_t len, const char *path);
+int Assembler_run(const char *text, size_t len, int argc, char **argv);
+typedef struct PrecompiledHeader PrecompiledHeader;
+void PrecompiledHeader_emit(
+    Vec_String * include_paths, const char *header_path, const char *output);
+PrecompiledHeader *PrecompiledHeader_load(const char *path);
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp);
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s);
+void test_Vec(void);
+void test_Arena(void);
+void test_Intern(void);
+void test_HiddenSet(void);
+void test_Path(void);
+void test_File(void);
+void test_Binary(void);
+void test_Ast(void);
+void test_Scan(void);
+void test_Lexer(void);
+void test_SourceCache(void);
+void test_Preprocessor(void);
+void test_TokenStream(void);
+void test_Parser(void);
+void test_StringPool(void);
+void test_Emitter(void);
+void test_PrecompiledHeader(void);
+void bench_Scope(void);
+void bench_Preprocessor(void);
+void bench_Lexer(void);
+void check_Node_dump(
+    const char *test_name, const Node *p, const char *expected);
+Node *IdentifierExprNode_base_node(IdentifierExprNode *p) { ((void)0); return (Node *)p; } const Node *IdentifierExprNode_cbase_node(const IdentifierExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *IdentifierExprNode_base(IdentifierExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *IdentifierExprNode_cbase(const IdentifierExprNode *p) { ((void)0); return (const ExprNode *)p; } IdentifierExprNode *IdentifierExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (IdentifierExprNode *)p; } const IdentifierExprNode *IdentifierExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const IdentifierExprNode *)p; } IdentifierExprNode *IdentifierExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (IdentifierExprNode *)p; } const IdentifierExprNode *IdentifierExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const IdentifierExprNode *)p; }
+   
+
+Node *EnumeratorExprNode_base_node(EnumeratorExprNode *p) { ((void)0); return (Node *)p; } const Node *EnumeratorExprNode_cbase_node(const EnumeratorExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *EnumeratorExprNode_base(EnumeratorExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *EnumeratorExprNode_cbase(const EnumeratorExprNode *p) { ((void)0); return (const ExprNode *)p; } EnumeratorExprNode *EnumeratorExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (EnumeratorExprNode *)p; } const EnumeratorExprNode *EnumeratorExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const EnumeratorExprNode *)p; } EnumeratorExprNode *EnumeratorExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (EnumeratorExprNode *)p; } const EnumeratorExprNode *EnumeratorExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const EnumeratorExprNode *)p; }
+   
+   
+
+Node *IntegerExprNode_base_node(IntegerExprNode *p) { ((void)0); return (Node *)p; } const Node *IntegerExprNode_cbase_node(const IntegerExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *IntegerExprNode_base(IntegerExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *IntegerExprNode_cbase(const IntegerExprNode *p) { ((void)0); return (const ExprNode *)p; } IntegerExprNode *IntegerExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (IntegerExprNode *)p; } const IntegerExprNode *IntegerExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const IntegerExprNode *)p; } IntegerExprNode *IntegerExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (IntegerExprNode *)p; } const IntegerExprNode *IntegerExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const IntegerExprNode *)p; }
+   
+
+Node *StringExprNode_base_node(StringExprNode *p) { ((void)0); return (Node *)p; } const Node *StringExprNode_cbase_node(const StringExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *StringExprNode_base(StringExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *StringExprNode_cbase(const StringExprNode *p) { ((void)0); return (const ExprNode *)p; } StringExprNode *StringExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (StringExprNode *)p; } const StringExprNode *StringExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const StringExprNode *)p; } StringExprNode *StringExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (StringExprNode *)p; } const StringExprNode *StringExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const StringExprNode *)p; }
+   
+   
+
+Node *SubscriptExprNode_base_node(SubscriptExprNode *p) { ((void)0); return (Node *)p; } const Node *SubscriptExprNode_cbase_node(const SubscriptExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *SubscriptExprNode_base(SubscriptExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *SubscriptExprNode_cbase(const SubscriptExprNode *p) { ((void)0); return (const ExprNode *)p; } SubscriptExprNode *SubscriptExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (SubscriptExprNode *)p; } const SubscriptExprNode *SubscriptExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const SubscriptExprNode *)p; } SubscriptExprNode *SubscriptExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (SubscriptExprNode *)p; } const SubscriptExprNode *SubscriptExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const SubscriptExprNode *)p; }
+   
+   
+
+Node *CallExprNode_base_node(CallExprNode *p) { ((void)0); return (Node *)p; } const Node *CallExprNode_cbase_node(const CallExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *CallExprNode_base(CallExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *CallExprNode_cbase(const CallExprNode *p) { ((void)0); return (const ExprNode *)p; } CallExprNode *CallExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (CallExprNode *)p; } const CallExprNode *CallExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const CallExprNode *)p; } CallExprNode *CallExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (CallExprNode *)p; } const CallExprNode *CallExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const CallExprNode *)p; }
+   
+   
+
+Node *DotExprNode_base_node(DotExprNode *p) { ((void)0); return (Node *)p; } const Node *DotExprNode_cbase_node(const DotExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *DotExprNode_base(DotExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *DotExprNode_cbase(const DotExprNode *p) { ((void)0); return (const ExprNode *)p; } DotExprNode *DotExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (DotExprNode *)p; } const DotExprNode *DotExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const DotExprNode *)p; } DotExprNode *DotExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (DotExprNode *)p; } const DotExprNode *DotExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const DotExprNode *)p; }
+   
+   
+
+Node *ArrowExprNode_base_node(ArrowExprNode *p) { ((void)0); return (Node *)p; } const Node *ArrowExprNode_cbase_node(const ArrowExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *ArrowExprNode_base(ArrowExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *ArrowExprNode_cbase(const ArrowExprNode *p) { ((void)0); return (const ExprNode *)p; } ArrowExprNode *ArrowExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (ArrowExprNode *)p; } const ArrowExprNode *ArrowExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ArrowExprNode *)p; } ArrowExprNode *ArrowExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (ArrowExprNode *)p; } const ArrowExprNode *ArrowExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const ArrowExprNode *)p; }
+   
+   
+
+Node *SizeofExprNode_base_node(SizeofExprNode *p) { ((void)0); return (Node *)p; } const Node *SizeofExprNode_cbase_node(const SizeofExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *SizeofExprNode_base(SizeofExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *SizeofExprNode_cbase(const SizeofExprNode *p) { ((void)0); return (const ExprNode *)p; } SizeofExprNode *SizeofExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (SizeofExprNode *)p; } const SizeofExprNode *SizeofExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const SizeofExprNode *)p; } SizeofExprNode *SizeofExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (SizeofExprNode *)p; } const SizeofExprNode *SizeofExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const SizeofExprNode *)p; }
+   
+   
+
+Node *CastExprNode_base_node(CastExprNode *p) { ((void)0); return (Node *)p; } const Node *CastExprNode_cbase_node(const CastExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *CastExprNode_base(CastExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *CastExprNode_cbase(const CastExprNode *p) { ((void)0); return (const ExprNode *)p; } CastExprNode *CastExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (CastExprNode *)p; } const CastExprNode *CastExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const CastExprNode *)p; } CastExprNode *CastExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (CastExprNode *)p; } const CastExprNode *CastExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const CastExprNode *)p; }
+   
+
+
+
+
+
+
+Node *UnaryExprNode_base_node(UnaryExprNode *p) { ((void)0); return (Node *)p; } const Node *UnaryExprNode_cbase_node(const UnaryExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *UnaryExprNode_base(UnaryExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *UnaryExprNode_cbase(const UnaryExprNode *p) { ((void)0); return (const ExprNode *)p; } UnaryExprNode *UnaryExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (UnaryExprNode *)p; } const UnaryExprNode *UnaryExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const UnaryExprNode *)p; } UnaryExprNode *UnaryExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (UnaryExprNode *)p; } const UnaryExprNode *UnaryExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const UnaryExprNode *)p; }
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+Node *BinaryExprNode_base_node(BinaryExprNode *p) { ((void)0); return (Node *)p; } const Node *BinaryExprNode_cbase_node(const BinaryExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *BinaryExprNode_base(BinaryExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *BinaryExprNode_cbase(const BinaryExprNode *p) { ((void)0); return (const ExprNode *)p; } BinaryExprNode *BinaryExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (BinaryExprNode *)p; } const BinaryExprNode *BinaryExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const BinaryExprNode *)p; } BinaryExprNode *BinaryExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (BinaryExprNode *)p; } const BinaryExprNode *BinaryExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const BinaryExprNode *)p; }
+   
+   
+   
+
+Node *AssignExprNode_base_node(AssignExprNode *p) { ((void)0); return (Node *)p; } const Node *AssignExprNode_cbase_node(const AssignExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *AssignExprNode_base(AssignExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *AssignExprNode_cbase(const AssignExprNode *p) { ((void)0); return (const ExprNode *)p; } AssignExprNode *AssignExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (AssignExprNode *)p; } const AssignExprNode *AssignExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const AssignExprNode *)p; } AssignExprNode *AssignExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (AssignExprNode *)p; } const AssignExprNode *AssignExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const AssignExprNode *)p; }
+   
+   
+
+Node *ImplicitCastExprNode_base_node(ImplicitCastExprNode *p) { ((void)0); return (Node *)p; } const Node *ImplicitCastExprNode_cbase_node(const ImplicitCastExprNode *p) { ((void)0); return (const Node *)p; } ExprNode *ImplicitCastExprNode_base(ImplicitCastExprNode *p) { ((void)0); return (ExprNode *)p; } const ExprNode *ImplicitCastExprNode_cbase(const ImplicitCastExprNode *p) { ((void)0); return (const ExprNode *)p; } ImplicitCastExprNode *ImplicitCastExprNode_cast_node(Node *p) { ((void)0); ((void)0); return (ImplicitCastExprNode *)p; } const ImplicitCastExprNode *ImplicitCastExprNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ImplicitCastExprNode *)p; } ImplicitCastExprNode *ImplicitCastExprNode_cast(ExprNode *p) { ((void)0); ((void)0); return (ImplicitCastExprNode *)p; } const ImplicitCastExprNode *ImplicitCastExprNode_ccast(const ExprNode *p) { ((void)0); ((void)0); return (const ImplicitCastExprNode *)p; }
+   
+   
+
+Node *CompoundStmtNode_base_node(CompoundStmtNode *p) { ((void)0); return (Node *)p; } const Node *CompoundStmtNode_cbase_node(const CompoundStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *CompoundStmtNode_base(CompoundStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *CompoundStmtNode_cbase(const CompoundStmtNode *p) { ((void)0); return (const StmtNode *)p; } CompoundStmtNode *CompoundStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (CompoundStmtNode *)p; } const CompoundStmtNode *CompoundStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const CompoundStmtNode *)p; } CompoundStmtNode *CompoundStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (CompoundStmtNode *)p; } const CompoundStmtNode *CompoundStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const CompoundStmtNode *)p; }
+   
+
+Node *IfStmtNode_base_node(IfStmtNode *p) { ((void)0); return (Node *)p; } const Node *IfStmtNode_cbase_node(const IfStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *IfStmtNode_base(IfStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *IfStmtNode_cbase(const IfStmtNode *p) { ((void)0); return (const StmtNode *)p; } IfStmtNode *IfStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (IfStmtNode *)p; } const IfStmtNode *IfStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const IfStmtNode *)p; } IfStmtNode *IfStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (IfStmtNode *)p; } const IfStmtNode *IfStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const IfStmtNode *)p; }
+   
+   
+   
+
+Node *WhileStmtNode_base_node(WhileStmtNode *p) { ((void)0); return (Node *)p; } const Node *WhileStmtNode_cbase_node(const WhileStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *WhileStmtNode_base(WhileStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *WhileStmtNode_cbase(const WhileStmtNode *p) { ((void)0); return (const StmtNode *)p; } WhileStmtNode *WhileStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (WhileStmtNode *)p; } const WhileStmtNode *WhileStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const WhileStmtNode *)p; } WhileStmtNode *WhileStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (WhileStmtNode *)p; } const WhileStmtNode *WhileStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const WhileStmtNode *)p; }
+   
+   
+
+Node *ForStmtNode_base_node(ForStmtNode *p) { ((void)0); return (Node *)p; } const Node *ForStmtNode_cbase_node(const ForStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *ForStmtNode_base(ForStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *ForStmtNode_cbase(const ForStmtNode *p) { ((void)0); return (const StmtNode *)p; } ForStmtNode *ForStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (ForStmtNode *)p; } const ForStmtNode *ForStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ForStmtNode *)p; } ForStmtNode *ForStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (ForStmtNode *)p; } const ForStmtNode *ForStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const ForStmtNode *)p; }
+   
+   
+   
+   
+
+Node *ReturnStmtNode_base_node(ReturnStmtNode *p) { ((void)0); return (Node *)p; } const Node *ReturnStmtNode_cbase_node(const ReturnStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *ReturnStmtNode_base(ReturnStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *ReturnStmtNode_cbase(const ReturnStmtNode *p) { ((void)0); return (const StmtNode *)p; } ReturnStmtNode *ReturnStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (ReturnStmtNode *)p; } const ReturnStmtNode *ReturnStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ReturnStmtNode *)p; } ReturnStmtNode *ReturnStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (ReturnStmtNode *)p; } const ReturnStmtNode *ReturnStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const ReturnStmtNode *)p; }
+   
+
+Node *DeclStmtNode_base_node(DeclStmtNode *p) { ((void)0); return (Node *)p; } const Node *DeclStmtNode_cbase_node(const DeclStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *DeclStmtNode_base(DeclStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *DeclStmtNode_cbase(const DeclStmtNode *p) { ((void)0); return (const StmtNode *)p; } DeclStmtNode *DeclStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (DeclStmtNode *)p; } const DeclStmtNode *DeclStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const DeclStmtNode *)p; } DeclStmtNode *DeclStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (DeclStmtNode *)p; } const DeclStmtNode *DeclStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const DeclStmtNode *)p; }
+   
+   
+
+Node *ExprStmtNode_base_node(ExprStmtNode *p) { ((void)0); return (Node *)p; } const Node *ExprStmtNode_cbase_node(const ExprStmtNode *p) { ((void)0); return (const Node *)p; } StmtNode *ExprStmtNode_base(ExprStmtNode *p) { ((void)0); return (StmtNode *)p; } const StmtNode *ExprStmtNode_cbase(const ExprStmtNode *p) { ((void)0); return (const StmtNode *)p; } ExprStmtNode *ExprStmtNode_cast_node(Node *p) { ((void)0); ((void)0); return (ExprStmtNode *)p; } const ExprStmtNode *ExprStmtNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ExprStmtNode *)p; } ExprStmtNode *ExprStmtNode_cast(StmtNode *p) { ((void)0); ((void)0); return (ExprStmtNode *)p; } const ExprStmtNode *ExprStmtNode_ccast(const StmtNode *p) { ((void)0); ((void)0); return (const ExprStmtNode *)p; }
+   
+
+Node *AbstractDirectDeclaratorNode_base_node(AbstractDirectDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *AbstractDirectDeclaratorNode_cbase_node(const AbstractDirectDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *AbstractDirectDeclaratorNode_base(AbstractDirectDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *AbstractDirectDeclaratorNode_cbase(const AbstractDirectDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (AbstractDirectDeclaratorNode *)p; } const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const AbstractDirectDeclaratorNode *)p; } AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (AbstractDirectDeclaratorNode *)p; } const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const AbstractDirectDeclaratorNode *)p; }
+   
+
+Node *DirectDeclaratorNode_base_node(DirectDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *DirectDeclaratorNode_cbase_node(const DirectDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *DirectDeclaratorNode_base(DirectDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *DirectDeclaratorNode_cbase(const DirectDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } DirectDeclaratorNode *DirectDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (DirectDeclaratorNode *)p; } const DirectDeclaratorNode *DirectDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const DirectDeclaratorNode *)p; } DirectDeclaratorNode *DirectDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (DirectDeclaratorNode *)p; } const DirectDeclaratorNode *DirectDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const DirectDeclaratorNode *)p; }
+   
+   
+
+Node *ArrayDeclaratorNode_base_node(ArrayDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *ArrayDeclaratorNode_cbase_node(const ArrayDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *ArrayDeclaratorNode_base(ArrayDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *ArrayDeclaratorNode_cbase(const ArrayDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } ArrayDeclaratorNode *ArrayDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (ArrayDeclaratorNode *)p; } const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const ArrayDeclaratorNode *)p; } ArrayDeclaratorNode *ArrayDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (ArrayDeclaratorNode *)p; } const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const ArrayDeclaratorNode *)p; }
+   
+   
+
+Node *FunctionDeclaratorNode_base_node(FunctionDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *FunctionDeclaratorNode_cbase_node(const FunctionDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *FunctionDeclaratorNode_base(FunctionDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *FunctionDeclaratorNode_cbase(const FunctionDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } FunctionDeclaratorNode *FunctionDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (FunctionDeclaratorNode *)p; } const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const FunctionDeclaratorNode *)p; } FunctionDeclaratorNode *FunctionDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (FunctionDeclaratorNode *)p; } const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const FunctionDeclaratorNode *)p; }
+   
+   
+   
+
+Node *PointerDeclaratorNode_base_node(PointerDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *PointerDeclaratorNode_cbase_node(const PointerDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *PointerDeclaratorNode_base(PointerDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *PointerDeclaratorNode_cbase(const PointerDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } PointerDeclaratorNode *PointerDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (PointerDeclaratorNode *)p; } const PointerDeclaratorNode *PointerDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const PointerDeclaratorNode *)p; } PointerDeclaratorNode *PointerDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (PointerDeclaratorNode *)p; } const PointerDeclaratorNode *PointerDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const PointerDeclaratorNode *)p; }
+   
+
+Node *InitDeclaratorNode_base_node(InitDeclaratorNode *p) { ((void)0); return (Node *)p; } const Node *InitDeclaratorNode_cbase_node(const InitDeclaratorNode *p) { ((void)0); return (const Node *)p; } DeclaratorNode *InitDeclaratorNode_base(InitDeclaratorNode *p) { ((void)0); return (DeclaratorNode *)p; } const DeclaratorNode *InitDeclaratorNode_cbase(const InitDeclaratorNode *p) { ((void)0); return (const DeclaratorNode *)p; } InitDeclaratorNode *InitDeclaratorNode_cast_node(Node *p) { ((void)0); ((void)0); return (InitDeclaratorNode *)p; } const InitDeclaratorNode *InitDeclaratorNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const InitDeclaratorNode *)p; } InitDeclaratorNode *InitDeclaratorNode_cast(DeclaratorNode *p) { ((void)0); ((void)0); return (InitDeclaratorNode *)p; } const InitDeclaratorNode *InitDeclaratorNode_ccast(const DeclaratorNode *p) { ((void)0); ((void)0); return (const InitDeclaratorNode *)p; }
+   
+   
+
+Node *GlobalDeclNode_base_node(GlobalDeclNode *p) { ((void)0); return (Node *)p; } const Node *GlobalDeclNode_cbase_node(const GlobalDeclNode *p) { ((void)0); return (const Node *)p; } DeclNode *GlobalDeclNode_base(GlobalDeclNode *p) { ((void)0); return (DeclNode *)p; } const DeclNode *GlobalDeclNode_cbase(const GlobalDeclNode *p) { ((void)0); return (const DeclNode *)p; } GlobalDeclNode *GlobalDeclNode_cast_node(Node *p) { ((void)0); ((void)0); return (GlobalDeclNode *)p; } const GlobalDeclNode *GlobalDeclNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const GlobalDeclNode *)p; } GlobalDeclNode *GlobalDeclNode_cast(DeclNode *p) { ((void)0); ((void)0); return (GlobalDeclNode *)p; } const GlobalDeclNode *GlobalDeclNode_ccast(const DeclNode *p) { ((void)0); ((void)0); return (const GlobalDeclNode *)p; }
+   
+   
+
+Node *FunctionDeclNode_base_node(FunctionDeclNode *p) { ((void)0); return (Node *)p; } const Node *FunctionDeclNode_cbase_node(const FunctionDeclNode *p) { ((void)0); return (const Node *)p; } DeclNode *FunctionDeclNode_base(FunctionDeclNode *p) { ((void)0); return (DeclNode *)p; } const DeclNode *FunctionDeclNode_cbase(const FunctionDeclNode *p) { ((void)0); return (const DeclNode *)p; } FunctionDeclNode *FunctionDeclNode_cast_node(Node *p) { ((void)0); ((void)0); return (FunctionDeclNode *)p; } const FunctionDeclNode *FunctionDeclNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const FunctionDeclNode *)p; } FunctionDeclNode *FunctionDeclNode_cast(DeclNode *p) { ((void)0); ((void)0); return (FunctionDeclNode *)p; } const FunctionDeclNode *FunctionDeclNode_ccast(const DeclNode *p) { ((void)0); ((void)0); return (const FunctionDeclNode *)p; }
+   
+   
+   
+   
+
+Node *MemberDeclNode_base_node(MemberDeclNode *p) { ((void)0); return (Node *)p; } const Node *MemberDeclNode_cbase_node(const MemberDeclNode *p) { ((void)0); return (const Node *)p; } DeclNode *MemberDeclNode_base(MemberDeclNode *p) { ((void)0); return (DeclNode *)p; } const DeclNode *MemberDeclNode_cbase(const MemberDeclNode *p) { ((void)0); return (const DeclNode *)p; } MemberDeclNode *MemberDeclNode_cast_node(Node *p) { ((void)0); ((void)0); return (MemberDeclNode *)p; } const MemberDeclNode *MemberDeclNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const MemberDeclNode *)p; } MemberDeclNode *MemberDeclNode_cast(DeclNode *p) { ((void)0); ((void)0); return (MemberDeclNode *)p; } const MemberDeclNode *MemberDeclNode_ccast(const DeclNode *p) { ((void)0); ((void)0); return (const MemberDeclNode *)p; }
+   
+   
+
+Node *EnumeratorDeclNode_base_node(EnumeratorDeclNode *p) { ((void)0); return (Node *)p; } const Node *EnumeratorDeclNode_cbase_node(const EnumeratorDeclNode *p) { ((void)0); return (const Node *)p; } DeclNode *EnumeratorDeclNode_base(EnumeratorDeclNode *p) { ((void)0); return (DeclNode *)p; } const DeclNode *EnumeratorDeclNode_cbase(const EnumeratorDeclNode *p) { ((void)0); return (const DeclNode *)p; } EnumeratorDeclNode *EnumeratorDeclNode_cast_node(Node *p) { ((void)0); ((void)0); return (EnumeratorDeclNode *)p; } const EnumeratorDeclNode *EnumeratorDeclNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const EnumeratorDeclNode *)p; } EnumeratorDeclNode *EnumeratorDeclNode_cast(DeclNode *p) { ((void)0); ((void)0); return (EnumeratorDeclNode *)p; } const EnumeratorDeclNode *EnumeratorDeclNode_ccast(const DeclNode *p) { ((void)0); ((void)0); return (const EnumeratorDeclNode *)p; }
+   
+   
+
+Node *DeclSpecNode_base_node(DeclSpecNode *p) { ((void)0); return (Node *)p; } const Node *DeclSpecNode_cbase_node(const DeclSpecNode *p) { ((void)0); return (const Node *)p; } Node *DeclSpecNode_base(DeclSpecNode *p) { ((void)0); return (Node *)p; } const Node *DeclSpecNode_cbase(const DeclSpecNode *p) { ((void)0); return (const Node *)p; } DeclSpecNode *DeclSpecNode_cast_node(Node *p) { ((void)0); ((void)0); return (DeclSpecNode *)p; } const DeclSpecNode *DeclSpecNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const DeclSpecNode *)p; } DeclSpecNode *DeclSpecNode_cast(Node *p) { ((void)0); ((void)0); return (DeclSpecNode *)p; } const DeclSpecNode *DeclSpecNode_ccast(const Node *p) { ((void)0); ((void)0); return (const DeclSpecNode *)p; }
+   
+   
+
+Node *TranslationUnitNode_base_node(TranslationUnitNode *p) { ((void)0); return (Node *)p; } const Node *TranslationUnitNode_cbase_node(const TranslationUnitNode *p) { ((void)0); return (const Node *)p; } Node *TranslationUnitNode_base(TranslationUnitNode *p) { ((void)0); return (Node *)p; } const Node *TranslationUnitNode_cbase(const TranslationUnitNode *p) { ((void)0); return (const Node *)p; } TranslationUnitNode *TranslationUnitNode_cast_node(Node *p) { ((void)0); ((void)0); return (TranslationUnitNode *)p; } const TranslationUnitNode *TranslationUnitNode_ccast_node(const Node *p) { ((void)0); ((void)0); return (const TranslationUnitNode *)p; } TranslationUnitNode *TranslationUnitNode_cast(Node *p) { ((void)0); ((void)0); return (TranslationUnitNode *)p; } const TranslationUnitNode *TranslationUnitNode_ccast(const Node *p) { ((void)0); ((void)0); return (const TranslationUnitNode *)p; }
+   
+
+static Arena *Node_current_arena;
+Arena *Node_arena(void) {
+    if (!Node_current_arena) {
+        Node_current_arena = Arena_new();
+    }
+    return Node_current_arena;
+}
+void Node_release_arena(void) {
+    if (Node_current_arena) {
+        Arena_release(Node_current_arena);
+    }
+}
+static IdentifierExprNode *IdentifierExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); IdentifierExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_IdentifierExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+
+static EnumeratorExprNode *EnumeratorExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); EnumeratorExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_EnumeratorExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static IntegerExprNode *IntegerExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); IntegerExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_IntegerExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+
+static StringExprNode *StringExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); StringExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_StringExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static SubscriptExprNode *SubscriptExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); SubscriptExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_SubscriptExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static CallExprNode *CallExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); CallExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_CallExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static DotExprNode *DotExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); DotExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_DotExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static ArrowExprNode *ArrowExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); ArrowExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ArrowExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static SizeofExprNode *SizeofExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); SizeofExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_SizeofExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static CastExprNode *CastExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); CastExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_CastExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+
+
+
+
+
+
+static UnaryExprNode *UnaryExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); UnaryExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_UnaryExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static BinaryExprNode *BinaryExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); BinaryExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_BinaryExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+   
+
+static AssignExprNode *AssignExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); AssignExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_AssignExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static ImplicitCastExprNode *ImplicitCastExprNode_alloc( Type *result_type, ValueCategory value_category) { ((void)0); ImplicitCastExprNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ImplicitCastExpr; p->result_type = result_type; p->value_category = value_category; return p; }
+   
+   
+
+static CompoundStmtNode *CompoundStmtNode_alloc(void) { CompoundStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_CompoundStmt; return p; }
+   
+
+static IfStmtNode *IfStmtNode_alloc(void) { IfStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_IfStmt; return p; }
+   
+   
+   
+
+static WhileStmtNode *WhileStmtNode_alloc(void) { WhileStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_WhileStmt; return p; }
+   
+   
+
+static ForStmtNode *ForStmtNode_alloc(void) { ForStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ForStmt; return p; }
+   
+   
+   
+   
+
+static ReturnStmtNode *ReturnStmtNode_alloc(void) { ReturnStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ReturnStmt; return p; }
+   
+
+static DeclStmtNode *DeclStmtNode_alloc(void) { DeclStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_DeclStmt; return p; }
+   
+   
+
+static ExprStmtNode *ExprStmtNode_alloc(void) { ExprStmtNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ExprStmt; return p; }
+   
+
+static AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_alloc(void) { AbstractDirectDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_AbstractDirectDeclarator; return p; }
+   
+
+static DirectDeclaratorNode *DirectDeclaratorNode_alloc(void) { DirectDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_DirectDeclarator; return p; }
+   
+   
+
+static ArrayDeclaratorNode *ArrayDeclaratorNode_alloc(void) { ArrayDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_ArrayDeclarator; return p; }
+   
+   
+
+static FunctionDeclaratorNode *FunctionDeclaratorNode_alloc(void) { FunctionDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_FunctionDeclarator; return p; }
+   
+   
+   
+
+static PointerDeclaratorNode *PointerDeclaratorNode_alloc(void) { PointerDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_PointerDeclarator; return p; }
+   
+
+static InitDeclaratorNode *InitDeclaratorNode_alloc(void) { InitDeclaratorNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_InitDeclarator; return p; }
+   
+   
+
+static GlobalDeclNode *GlobalDeclNode_alloc(void) { GlobalDeclNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_GlobalDecl; return p; }
+   
+   
+
+static FunctionDeclNode *FunctionDeclNode_alloc(void) { FunctionDeclNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_FunctionDecl; return p; }
+   
+   
+   
+   
+
+static MemberDeclNode *MemberDeclNode_alloc(void) { MemberDeclNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_MemberDecl; return p; }
+   
+   
+
+static EnumeratorDeclNode *EnumeratorDeclNode_alloc(void) { EnumeratorDeclNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_EnumeratorDecl; return p; }
+   
+   
+
+static DeclSpecNode *DeclSpecNode_alloc(void) { DeclSpecNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_DeclSpec; return p; }
+   
+   
+
+static TranslationUnitNode *TranslationUnitNode_alloc(void) { TranslationUnitNode *p = Arena_alloc(Node_arena(), sizeof(*p)); p->kind = NodeKind_TranslationUnit; return p; }
+   
+
+IdentifierExprNode *IdentifierExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol) {
+    ((void)0);
+    IdentifierExprNode *p =
+        IdentifierExprNode_alloc(result_type, value_category);
+    p->symbol = symbol;
+    return p;
+}
+EnumeratorExprNode *EnumeratorExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    Symbol *symbol,
+    int value) {
+    ((void)0);
+    EnumeratorExprNode *p =
+        EnumeratorExprNode_alloc(result_type, value_category);
+    p->symbol = symbol;
+    p->value = value;
+    return p;
+}
+IntegerExprNode *IntegerExprNode_new(
+    Type *result_type, ValueCategory value_category, int value) {
+    IntegerExprNode *p = IntegerExprNode_alloc(result_type, value_category);
+    p->value = value;
+    return p;
+}
+StringExprNode *StringExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    const char *string,
+    size_t length) {
+    ((void)0);
+    StringExprNode *p = StringExprNode_alloc(result_type, value_category);
+    p->value = string;
+    p->length = length;
+    return p;
+}
+SubscriptExprNode *SubscriptExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *array,
+    ExprNode *index) {
+    ((void)0);
+    ((void)0);
+    SubscriptExprNode *p = SubscriptExprNode_alloc(result_type, value_category);
+    p->array = array;
+    p->index = index;
+    return p;
+}
+CallExprNode *CallExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *callee,
+    Vec_ExprNode * arguments) {
+    ((void)0);
+    ((void)0);
+    CallExprNode *p = CallExprNode_alloc(result_type, value_category);
+    p->callee = callee;
+    p->arguments = arguments;
+    return p;
+}
+DotExprNode *DotExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol) {
+    ((void)0);
+    ((void)0);
+    DotExprNode *p = DotExprNode_alloc(result_type, value_category);
+    p->parent = parent;
+    p->member_symbol = member_symbol;
+    return p;
+}
+ArrowExprNode *ArrowExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol) {
+    ((void)0);
+    ((void)0);
+    ArrowExprNode *p = ArrowExprNode_alloc(result_type, value_category);
+    p->parent = parent;
+    p->member_symbol = member_symbol;
+    return p;
+}
+SizeofExprNode *SizeofExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    Type *type,
+    ExprNode *expression) {
+    ((void)0);
+    SizeofExprNode *p = SizeofExprNode_alloc(result_type, value_category);
+    p->type = type;
+    p->expression = expression;
+    return p;
+}
+CastExprNode *CastExprNode_new(
+    Type *result_type, ValueCategory value_category, ExprNode *expression) {
+    ((void)0);
+    CastExprNode *p = CastExprNode_alloc(result_type, value_category);
+    p->expression = expression;
+    return p;
+}
+UnaryExprNode *UnaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    UnaryOp
+    operator,
+    ExprNode *operand) {
+    ((void)0);
+    UnaryExprNode *p = UnaryExprNode_alloc(result_type, value_category);
+    p->operator= operator;
+    p->operand = operand;
+    return p;
+}
+BinaryExprNode *BinaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    BinaryOp
+    operator,
+    ExprNode *lhs,
+    ExprNode *rhs) {
+    ((void)0);
+    ((void)0);
+    BinaryExprNode *p = BinaryExprNode_alloc(result_type, value_category);
+    p->operator= operator;
+    p->lhs = lhs;
+    p->rhs = rhs;
+    return p;
+}
+AssignExprNode *AssignExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *lhs,
+    ExprNode *rhs) {
+    ((void)0);
+    ((void)0);
+    AssignExprNode *p = AssignExprNode_alloc(result_type, value_category);
+    p->lhs = lhs;
+    p->rhs = rhs;
+    return p;
+}
+ImplicitCastExprNode *ImplicitCastExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ImplicitCastOp
+    operator,
+    ExprNode *expression) {
+    ((void)0);
+    ImplicitCastExprNode *p =
+        ImplicitCastExprNode_alloc(result_type, value_category);
+    p->operator= operator;
+    p->expression = expression;
+    return p;
+}
+CompoundStmtNode *CompoundStmtNode_new(Vec_StmtNode * statements) {
+    ((void)0);
+    CompoundStmtNode *p = CompoundStmtNode_alloc();
+    p->statements = statements;
+    return p;
+}
+IfStmtNode *
+IfStmtNode_new(ExprNode *condition, StmtNode *if_true, StmtNode *if_false) {
+    ((void)0);
+    ((void)0);
+    IfStmtNode *p = IfStmtNode_alloc();
+    p->condition = condition;
+    p->if_true = if_true;
+    p->if_false = if_false;
+    return p;
+}
+WhileStmtNode *WhileStmtNode_new(ExprNode *condition, StmtNode *body) {
+    ((void)0);
+    ((void)0);
+    WhileStmtNode *p = WhileStmtNode_alloc();
+    p->condition = condition;
+    p->body = body;
+    return p;
+}
+ForStmtNode *ForStmtNode_new(
+    StmtNode *initializer,
+    ExprNode *condition,
+    ExprNode *step,
+    StmtNode *body) {
+    ((void)0);
+    ForStmtNode *p = ForStmtNode_alloc();
+    p->initializer = initializer;
+    p->condition = condition;
+    p->step = step;
+    p->body = body;
+    return p;
+}
+ReturnStmtNode *ReturnStmtNode_new(ExprNode *return_value) {
+    ReturnStmtNode *p = ReturnStmtNode_alloc();
+    p->return_value = return_value;
+    return p;
+}
+DeclStmtNode *
+DeclStmtNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators) {
+    ((void)0);
+    ((void)0);
+    DeclStmtNode *p = DeclStmtNode_alloc();
+    p->decl_spec = decl_spec;
+    p->declarators = declarators;
+    return p;
+}
+ExprStmtNode *ExprStmtNode_new(ExprNode *expression) {
+    ((void)0);
+    ExprStmtNode *p = ExprStmtNode_alloc();
+    p->expression = expression;
+    return p;
+}
+AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_new(void) {
+    AbstractDirectDeclaratorNode *p = AbstractDirectDeclaratorNode_alloc();
+    p->symbol = ((void *)0);
+    return p;
+}
+static Symbol *
+AbstractDirectDeclaratorNode_symbol(const AbstractDirectDeclaratorNode *p) {
+    ((void)0);
+    return p->symbol;
+}
+static Vec_DeclaratorNode * AbstractDirectDeclaratorNode_parameters(
+                                 const AbstractDirectDeclaratorNode *p) {
+    ((void)0);
+    (void)p;
+    return ((void *)0);
+}
+DirectDeclaratorNode *DirectDeclaratorNode_new(const char *name) {
+    ((void)0);
+    DirectDeclaratorNode *p = DirectDeclaratorNode_alloc();
+    p->name = name;
+    p->symbol = ((void *)0);
+    return p;
+}
+static Symbol *DirectDeclaratorNode_symbol(const DirectDeclaratorNode *p) {
+    ((void)0);
+    return p->symbol;
+}
+static Vec_DeclaratorNode *
+    DirectDeclaratorNode_parameters(const DirectDeclaratorNode *p) {
+    ((void)0);
+    (void)p;
+    return ((void *)0);
+}
+ArrayDeclaratorNode *
+ArrayDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *array_size) {
+    ((void)0);
+    ArrayDeclaratorNode *p = ArrayDeclaratorNode_alloc();
+    p->declarator = declarator;
+    p->array_size = array_size;
+    return p;
+}
+static Symbol *ArrayDeclaratorNode_symbol(const ArrayDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_symbol(p->declarator);
+}
+static Vec_DeclaratorNode *
+    ArrayDeclaratorNode_parameters(const ArrayDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_parameters(p->declarator);
+}
+FunctionDeclaratorNode *FunctionDeclaratorNode_new(
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg) {
+    ((void)0);
+    ((void)0);
+    FunctionDeclaratorNode *p = FunctionDeclaratorNode_alloc();
+    p->declarator = declarator;
+    p->parameters = parameters;
+    p->is_var_arg = is_var_arg;
+    return p;
+}
+static Symbol *FunctionDeclaratorNode_symbol(const FunctionDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_symbol(p->declarator);
+}
+static Vec_DeclaratorNode *
+    FunctionDeclaratorNode_parameters(const FunctionDeclaratorNode *p) {
+    ((void)0);
+    Vec_DeclaratorNode *parameters = DeclaratorNode_parameters(p->declarator);
+    if (parameters) {
+        return parameters;
+    }
+    return p->parameters;
+}
+PointerDeclaratorNode *PointerDeclaratorNode_new(DeclaratorNode *declarator) {
+    ((void)0);
+    PointerDeclaratorNode *p = PointerDeclaratorNode_alloc();
+    p->declarator = declarator;
+    return p;
+}
+static Symbol *PointerDeclaratorNode_symbol(const PointerDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_symbol(p->declarator);
+}
+static Vec_DeclaratorNode *
+    PointerDeclaratorNode_parameters(const PointerDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_parameters(p->declarator);
+}
+InitDeclaratorNode *
+InitDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *initializer) {
+    ((void)0);
+    ((void)0);
+    InitDeclaratorNode *p = InitDeclaratorNode_alloc();
+    p->declarator = declarator;
+    p->initializer = initializer;
+    return p;
+}
+static Symbol *InitDeclaratorNode_symbol(const InitDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_symbol(p->declarator);
+}
+static Vec_DeclaratorNode *
+    InitDeclaratorNode_parameters(const InitDeclaratorNode *p) {
+    ((void)0);
+    return DeclaratorNode_parameters(p->declarator);
+}
+Symbol *DeclaratorNode_symbol(const DeclaratorNode *p) {
+    ((void)0);
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+if (p->kind == NodeKind_AbstractDirectDeclarator) { return AbstractDirectDeclaratorNode_symbol(AbstractDirectDeclaratorNode_ccast(p)); }
+   
+
+if (p->kind == NodeKind_DirectDeclarator) { return DirectDeclaratorNode_symbol(DirectDeclaratorNode_ccast(p)); }
+   
+   
+
+if (p->kind == NodeKind_ArrayDeclarator) { return ArrayDeclaratorNode_symbol(ArrayDeclaratorNode_ccast(p)); }
+   
+   
+
+if (p->kind == NodeKind_FunctionDeclarator) { return FunctionDeclaratorNode_symbol(FunctionDeclaratorNode_ccast(p)); }
+   
+   
+   
+
+if (p->kind == NodeKind_PointerDeclarator) { return PointerDeclaratorNode_symbol(PointerDeclaratorNode_ccast(p)); }
+   
+
+if (p->kind == NodeKind_InitDeclarator) { return InitDeclaratorNode_symbol(InitDeclaratorNode_ccast(p)); }
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+    (exit(1));
+}
+Vec_DeclaratorNode * DeclaratorNode_parameters(const DeclaratorNode *p) {
+    ((void)0);
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+if (p->kind == NodeKind_AbstractDirectDeclarator) { return AbstractDirectDeclaratorNode_parameters(AbstractDirectDeclaratorNode_ccast(p)); }
+   
+
+if (p->kind == NodeKind_DirectDeclarator) { return DirectDeclaratorNode_parameters(DirectDeclaratorNode_ccast(p)); }
+   
+   
+
+if (p->kind == NodeKind_ArrayDeclarator) { return ArrayDeclaratorNode_parameters(ArrayDeclaratorNode_ccast(p)); }
+   
+   
+
+if (p->kind == NodeKind_FunctionDeclarator) { return FunctionDeclaratorNode_parameters(FunctionDeclaratorNode_ccast(p)); }
+   
+   
+   
+
+if (p->kind == NodeKind_PointerDeclarator) { return PointerDeclaratorNode_parameters(PointerDeclaratorNode_ccast(p)); }
+   
+
+if (p->kind == NodeKind_InitDeclarator) { return InitDeclaratorNode_parameters(InitDeclaratorNode_ccast(p)); }
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+    (exit(1));
+}
+GlobalDeclNode *
+GlobalDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators) {
+    ((void)0);
+    ((void)0);
+    GlobalDeclNode *p = GlobalDeclNode_alloc();
+    p->decl_spec = decl_spec;
+    p->declarators = declarators;
+    return p;
+}
+FunctionDeclNode *FunctionDeclNode_new(
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body,
+    Vec_Symbol * local_variables) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    FunctionDeclNode *p = FunctionDeclNode_alloc();
+    p->decl_spec = decl_spec;
+    p->declarator = declarator;
+    p->body = body;
+    p->local_variables = local_variables;
+    return p;
+}
+MemberDeclNode *
+MemberDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators) {
+    ((void)0);
+    ((void)0);
+    MemberDeclNode *p = MemberDeclNode_alloc();
+    p->decl_spec = decl_spec;
+    p->declarators = declarators;
+    return p;
+}
+EnumeratorDeclNode *EnumeratorDeclNode_new(Symbol *symbol, ExprNode *value) {
+    ((void)0);
+    EnumeratorDeclNode *p = EnumeratorDeclNode_alloc();
+    p->symbol = symbol;
+    p->value = value;
+    return p;
+}
+DeclSpecNode *DeclSpecNode_new(StorageClass storage_class, Type *base_type) {
+    ((void)0);
+    DeclSpecNode *p = DeclSpecNode_alloc();
+    p->storage_class = storage_class;
+    p->base_type = base_type;
+    return p;
+}
+TranslationUnitNode *TranslationUnitNode_new(Vec_DeclNode * declarations) {
+    ((void)0);
+    TranslationUnitNode *p = TranslationUnitNode_alloc();
+    p->declarations = declarations;
+    return p;
+}
+static void Node_dump_impl(const Node *p, FILE *fp, size_t depth);
+static void Node_dump_indent(FILE *fp, size_t depth) {
+    ((void)0);
+    for (size_t i = 0; i < depth; i = i + 1) {
+        fprintf(fp, "  ");
+    }
+}
+static void Node_dump_Symbol(const Symbol *x, FILE *fp, size_t depth) {
+    ((void)0);
+    ((void)0);
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(symbol %s)\n", x->name);
+}
+static void Node_dump_bool(bool x, FILE *fp, size_t depth) {
+    ((void)0);
+    Node_dump_indent(fp, depth);
+    if (x) {
+        fprintf(fp, "(bool true)\n");
+    } else {
+        fprintf(fp, "(bool false)\n");
+    }
+}
+static void Node_dump_int(int x, FILE *fp, size_t depth) {
+    ((void)0);
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(int %d)\n", x);
+}
+static void Node_dump_string(const char *x, FILE *fp, size_t depth) {
+    ((void)0);
+    ((void)0);
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(string %s)\n", x);
+}
+static void Node_dump_size_t(size_t x, FILE *fp, size_t depth) {
+    ((void)0);
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(size_t %zu)\n", x);
+}
+static void Node_dump_StorageClass(StorageClass x, FILE *fp, size_t depth) {
+    ((void)0);
+    const char *text;
+    if (x == StorageClass_none) {
+        text = "none";
+    } else if (x == StorageClass_static) {
+        text = "static";
+    } else if (x == StorageClass_typedef) {
+        text = "typedef";
+    } else if (x == StorageClass_enum) {
+        text = "enum";
+    } else {
+        (exit(1));
+    }
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(StorageClass %s)\n", text);
+}
+static void Node_dump_UnaryOp(UnaryOp x, FILE *fp, size_t depth) {
+    ((void)0);
+    const char *text;
+    if (0) {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} else if (x == UnaryOp_positive) { text = "positive";
+} else if (x == UnaryOp_negative) { text = "negative";
+} else if (x == UnaryOp_not) { text = "not";
+} else if (x == UnaryOp_address_of) { text = "address_of";
+} else if (x == UnaryOp_indirection) { text = "indirection";
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+    } else {
+        (exit(1));
+    }
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(UnaryOp %s)\n", text);
+}
+static void Node_dump_BinaryOp(BinaryOp x, FILE *fp, size_t depth) {
+    ((void)0);
+    const char *text;
+    if (0) {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+} else if (x == BinaryOp_add) { text = "add";
+} else if (x == BinaryOp_sub) { text = "sub";
+} else if (x == BinaryOp_mul) { text = "mul";
+} else if (x == BinaryOp_div) { text = "div";
+} else if (x == BinaryOp_mod) { text = "mod";
+} else if (x == BinaryOp_lesser_than) { text = "lesser_than";
+} else if (x == BinaryOp_lesser_equal) { text = "lesser_equal";
+} else if (x == BinaryOp_greater_than) { text = "greater_than";
+} else if (x == BinaryOp_greater_equal) { text = "greater_equal";
+} else if (x == BinaryOp_equal) { text = "equal";
+} else if (x == BinaryOp_and) { text = "and";
+} else if (x == BinaryOp_not_equal) { text = "not_equal";
+} else if (x == BinaryOp_logical_and) { text = "logical_and";
+} else if (x == BinaryOp_logical_or) { text = "logical_or";
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+    } else {
+        (exit(1));
+    }
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(BinaryOp %s)\n", text);
+}
+static void Node_dump_ImplicitCastOp(ImplicitCastOp x, FILE *fp, size_t depth) {
+    ((void)0);
+    const char *text;
+    if (x == ImplicitCastOp_lvalue_to_rvalue) {
+        text = "lvalue_to_rvalue";
+    } else if (x == ImplicitCastOp_function_to_function_pointer) {
+        text = "function_to_function_pointer";
+    } else if (x == ImplicitCastOp_array_to_pointer) {
+        text = "array_to_pointer";
+    } else if (x == ImplicitCastOp_integral_cast) {
+        text = "integral_cast";
+    } else if (x == ImplicitCastOp_integer_to_pointer_cast) {
+        text = "integer_to_pointer_cast";
+    } else if (x == ImplicitCastOp_pointer_to_pointer_cast) {
+        text = "pointer_to_pointer_cast";
+    } else {
+        (exit(1));
+    }
+    Node_dump_indent(fp, depth);
+    fprintf(fp, "(ImplicitCastOp %s)\n", text);
+}
+static void Node_dump_Expr(const ExprNode *x, FILE *fp, size_t depth) {
+    Node_dump_impl((const Node *)x, fp, depth);
+}
+static void Node_dump_Exprs(const Vec_ExprNode * x, FILE *fp, size_t depth) {
+    for (size_t i = 0; i < Vec_len_ExprNode(x); i = i + 1) {
+        Node_dump_Expr(Vec_get_ExprNode(x, i), fp, depth);
+    }
+}
+static void Node_dump_Stmt(const StmtNode *x, FILE *fp, size_t depth) {
+    Node_dump_impl((const Node *)x, fp, depth);
+}
+static void Node_dump_Stmts(const Vec_StmtNode * x, FILE *fp, size_t depth) {
+    for (size_t i = 0; i < Vec_len_StmtNode(x); i = i + 1) {
+        Node_dump_Stmt(Vec_get_StmtNode(x, i), fp, depth);
+    }
+}
+static void
+Node_dump_Declarator(const DeclaratorNode *x, FILE *fp, size_t depth) {
+    Node_dump_impl((const Node *)x, fp, depth);
+}
+static void
+Node_dump_Declarators(const Vec_DeclaratorNode * x, FILE *fp, size_t depth) {
+    for (size_t i = 0; i < Vec_len_DeclaratorNode(x); i = i + 1) {
+        Node_dump_Declarator(Vec_get_DeclaratorNode(x, i), fp, depth);
+    }
+}
+static void Node_dump_Decl(const DeclNode *x, FILE *fp, size_t depth) {
+    Node_dump_impl((const Node *)x, fp, depth);
+}
+static void Node_dump_Decls(const Vec_DeclNode * x, FILE *fp, size_t depth) {
+    for (size_t i = 0; i < Vec_len_DeclNode(x); i = i + 1) {
+        Node_dump_Decl(Vec_get_DeclNode(x, i), fp, depth);
+    }
+}
+static void Node_dump_DeclSpec(const DeclSpecNode *x, FILE *fp, size_t depth) {
+    Node_dump_impl(DeclSpecNode_cbase_node(x), fp, depth);
+}
+static void Node_dump_impl(const Node *p, FILE *fp, size_t depth) {
+    ((void)0);
+    if (p == (const Node *)((void *)0)) {
+        Node_dump_indent(fp, depth);
+        fprintf(fp, "(null)\n");
+        return;
+    }
+if (p->kind==NodeKind_IdentifierExpr) { const IdentifierExprNode *q = IdentifierExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Identifier", "Expr");
+    Node_dump_Symbol(q->symbol, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_EnumeratorExpr) { const EnumeratorExprNode *q = EnumeratorExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Enumerator", "Expr");
+    Node_dump_Symbol(q->symbol, fp, depth + 1);
+   
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_IntegerExpr) { const IntegerExprNode *q = IntegerExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Integer", "Expr");
+    Node_dump_int(q->value, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_StringExpr) { const StringExprNode *q = StringExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "String", "Expr");
+    Node_dump_string(q->value, fp, depth + 1);
+    Node_dump_size_t(q->length, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_SubscriptExpr) { const SubscriptExprNode *q = SubscriptExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Subscript", "Expr");
+    Node_dump_Expr(q->array, fp, depth + 1);
+    Node_dump_Expr(q->index, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_CallExpr) { const CallExprNode *q = CallExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Call", "Expr");
+    Node_dump_Expr(q->callee, fp, depth + 1);
+    Node_dump_Exprs(q->arguments, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_DotExpr) { const DotExprNode *q = DotExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Dot", "Expr");
+    Node_dump_Expr(q->parent, fp, depth + 1);
+    Node_dump_Symbol(q->member_symbol, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ArrowExpr) { const ArrowExprNode *q = ArrowExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Arrow", "Expr");
+    Node_dump_Expr(q->parent, fp, depth + 1);
+    Node_dump_Symbol(q->member_symbol, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_SizeofExpr) { const SizeofExprNode *q = SizeofExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Sizeof", "Expr");
+   
+    Node_dump_Expr(q->expression, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_CastExpr) { const CastExprNode *q = CastExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Cast", "Expr");
+    Node_dump_Expr(q->expression, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+
+
+
+
+
+if (p->kind==NodeKind_UnaryExpr) { const UnaryExprNode *q = UnaryExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Unary", "Expr");
+    Node_dump_UnaryOp(q->operator, fp, depth + 1);
+    Node_dump_Expr(q->operand, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+if (p->kind==NodeKind_BinaryExpr) { const BinaryExprNode *q = BinaryExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Binary", "Expr");
+    Node_dump_BinaryOp(q->operator, fp, depth + 1);
+    Node_dump_Expr(q->lhs, fp, depth + 1);
+    Node_dump_Expr(q->rhs, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_AssignExpr) { const AssignExprNode *q = AssignExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Assign", "Expr");
+    Node_dump_Expr(q->lhs, fp, depth + 1);
+    Node_dump_Expr(q->rhs, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ImplicitCastExpr) { const ImplicitCastExprNode *q = ImplicitCastExprNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "ImplicitCast", "Expr");
+    Node_dump_ImplicitCastOp(q->operator, fp, depth + 1);
+    Node_dump_Expr(q->expression, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_CompoundStmt) { const CompoundStmtNode *q = CompoundStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Compound", "Stmt");
+    Node_dump_Stmts(q->statements, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_IfStmt) { const IfStmtNode *q = IfStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "If", "Stmt");
+    Node_dump_Expr(q->condition, fp, depth + 1);
+    Node_dump_Stmt(q->if_true, fp, depth + 1);
+    Node_dump_Stmt(q->if_false, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_WhileStmt) { const WhileStmtNode *q = WhileStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "While", "Stmt");
+    Node_dump_Expr(q->condition, fp, depth + 1);
+    Node_dump_Stmt(q->body, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ForStmt) { const ForStmtNode *q = ForStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "For", "Stmt");
+    Node_dump_Stmt(q->initializer, fp, depth + 1);
+    Node_dump_Expr(q->condition, fp, depth + 1);
+    Node_dump_Expr(q->step, fp, depth + 1);
+    Node_dump_Stmt(q->body, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ReturnStmt) { const ReturnStmtNode *q = ReturnStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Return", "Stmt");
+    Node_dump_Expr(q->return_value, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_DeclStmt) { const DeclStmtNode *q = DeclStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Decl", "Stmt");
+    Node_dump_DeclSpec(q->decl_spec, fp, depth + 1);
+    Node_dump_Declarators(q->declarators, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ExprStmt) { const ExprStmtNode *q = ExprStmtNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Expr", "Stmt");
+    Node_dump_Expr(q->expression, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_AbstractDirectDeclarator) { const AbstractDirectDeclaratorNode *q = AbstractDirectDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "AbstractDirect", "Declarator");
+    Node_dump_Symbol(q->symbol, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_DirectDeclarator) { const DirectDeclaratorNode *q = DirectDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Direct", "Declarator");
+   
+    Node_dump_Symbol(q->symbol, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_ArrayDeclarator) { const ArrayDeclaratorNode *q = ArrayDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Array", "Declarator");
+    Node_dump_Declarator(q->declarator, fp, depth + 1);
+    Node_dump_Expr(q->array_size, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_FunctionDeclarator) { const FunctionDeclaratorNode *q = FunctionDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Function", "Declarator");
+    Node_dump_Declarator(q->declarator, fp, depth + 1);
+    Node_dump_Declarators(q->parameters, fp, depth + 1);
+    Node_dump_bool(q->is_var_arg, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_PointerDeclarator) { const PointerDeclaratorNode *q = PointerDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Pointer", "Declarator");
+    Node_dump_Declarator(q->declarator, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_InitDeclarator) { const InitDeclaratorNode *q = InitDeclaratorNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Init", "Declarator");
+    Node_dump_Declarator(q->declarator, fp, depth + 1);
+    Node_dump_Expr(q->initializer, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_GlobalDecl) { const GlobalDeclNode *q = GlobalDeclNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Global", "Decl");
+    Node_dump_DeclSpec(q->decl_spec, fp, depth + 1);
+    Node_dump_Declarators(q->declarators, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_FunctionDecl) { const FunctionDeclNode *q = FunctionDeclNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Function", "Decl");
+    Node_dump_DeclSpec(q->decl_spec, fp, depth + 1);
+    Node_dump_Declarator(q->declarator, fp, depth + 1);
+    Node_dump_Stmt(q->body, fp, depth + 1);
+   
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_MemberDecl) { const MemberDeclNode *q = MemberDeclNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Member", "Decl");
+    Node_dump_DeclSpec(q->decl_spec, fp, depth + 1);
+    Node_dump_Declarators(q->declarators, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_EnumeratorDecl) { const EnumeratorDeclNode *q = EnumeratorDeclNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "Enumerator", "Decl");
+    Node_dump_Symbol(q->symbol, fp, depth + 1);
+    Node_dump_Expr(q->value, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_DeclSpec) { const DeclSpecNode *q = DeclSpecNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "DeclSpec", "");
+    Node_dump_StorageClass(q->storage_class, fp, depth + 1);
+   
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+if (p->kind==NodeKind_TranslationUnit) { const TranslationUnitNode *q = TranslationUnitNode_ccast_node(p); (void)q; Node_dump_indent(fp, depth); fprintf(fp, "(%s%s\n", "TranslationUnit", "");
+    Node_dump_Decls(q->declarations, fp, depth + 1);
+Node_dump_indent(fp, depth); fprintf(fp, ")\n"); return; }
+    (exit(1));
+}
+void Node_dump(const Node *p, FILE *fp) {
+    ((void)0);
+    Node_dump_impl(p, fp, 0);
+}
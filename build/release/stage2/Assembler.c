@@ -0,0 +1,2420 @@
+int isspace(int c);
+int isdigit(int c);
+int isalpha(int c);
+int isalnum(int c);
+typedef int size_t;
+void *malloc(size_t size);
+void *realloc(void *ptr, size_t size);
+void free(void *ptr);
+void exit(int);
+int atoi(const char *s);
+typedef struct FILE FILE;
+FILE *fopen(const char *path, const char *mode);
+void fclose(FILE *fp);
+int fseek(FILE *fp, int off, int origin);
+int ftell(FILE *fp);
+size_t fread(void *buf, size_t size, size_t n, FILE *fp);
+size_t fwrite(const void *buf, size_t size, size_t n, FILE *fp);
+int fprintf(FILE *fp, const char *fmt, ...);
+int printf(const char *fmt, ...);
+int snprintf(char *buf, size_t size, const char *fmt, ...);
+int remove(const char *path);
+size_t strlen(const char *s);
+int strcmp(const char *s1, const char *s2);
+int strncmp(const char *s1, const char *s2, size_t n);
+char *strcpy(char *s1, const char *s2);
+char *strcat(char *s1, const char *s2);
+char *strdup(const char *s);
+char *strndup(const char *s, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+void *memcpy(void *s1, const void *s2, size_t n);
+typedef int bool;
+typedef struct Vec_String Vec_String; typedef const char * Vec_Element_String; Vec_String * Vec_new_String(void); size_t Vec_len_String(const Vec_String * v); Vec_Element_String * Vec_ptr_String(Vec_String * v); const Vec_Element_String * Vec_cptr_String(const Vec_String * v); Vec_Element_String Vec_get_String(const Vec_String * v, size_t i); void Vec_set_String(Vec_String * v, size_t i, Vec_Element_String x); void Vec_push_String(Vec_String * v, Vec_Element_String x); Vec_Element_String Vec_pop_String(Vec_String * v); void Vec_reserve_String(Vec_String * v, size_t cap); void Vec_resize_String(Vec_String * v, size_t len); void Vec_delete_String(Vec_String * v);
+typedef struct Vec_size_t Vec_size_t; typedef size_t Vec_Element_size_t; Vec_size_t * Vec_new_size_t(void); size_t Vec_len_size_t(const Vec_size_t * v); Vec_Element_size_t * Vec_ptr_size_t(Vec_size_t * v); const Vec_Element_size_t * Vec_cptr_size_t(const Vec_size_t * v); Vec_Element_size_t Vec_get_size_t(const Vec_size_t * v, size_t i); void Vec_set_size_t(Vec_size_t * v, size_t i, Vec_Element_size_t x); void Vec_push_size_t(Vec_size_t * v, Vec_Element_size_t x); Vec_Element_size_t Vec_pop_size_t(Vec_size_t * v); void Vec_reserve_size_t(Vec_size_t * v, size_t cap); void Vec_resize_size_t(Vec_size_t * v, size_t len); void Vec_delete_size_t(Vec_size_t * v);
+typedef struct Vec_Token Vec_Token; typedef struct Token * Vec_Element_Token; Vec_Token * Vec_new_Token(void); size_t Vec_len_Token(const Vec_Token * v); Vec_Element_Token * Vec_ptr_Token(Vec_Token * v); const Vec_Element_Token * Vec_cptr_Token(const Vec_Token * v); Vec_Element_Token Vec_get_Token(const Vec_Token * v, size_t i); void Vec_set_Token(Vec_Token * v, size_t i, Vec_Element_Token x); void Vec_push_Token(Vec_Token * v, Vec_Element_Token x); Vec_Element_Token Vec_pop_Token(Vec_Token * v); void Vec_reserve_Token(Vec_Token * v, size_t cap); void Vec_resize_Token(Vec_Token * v, size_t len); void Vec_delete_Token(Vec_Token * v);
+typedef struct Vec_Type Vec_Type; typedef struct Type * Vec_Element_Type; Vec_Type * Vec_new_Type(void); size_t Vec_len_Type(const Vec_Type * v); Vec_Element_Type * Vec_ptr_Type(Vec_Type * v); const Vec_Element_Type * Vec_cptr_Type(const Vec_Type * v); Vec_Element_Type Vec_get_Type(const Vec_Type * v, size_t i); void Vec_set_Type(Vec_Type * v, size_t i, Vec_Element_Type x); void Vec_push_Type(Vec_Type * v, Vec_Element_Type x); Vec_Element_Type Vec_pop_Type(Vec_Type * v); void Vec_reserve_Type(Vec_Type * v, size_t cap); void Vec_resize_Type(Vec_Type * v, size_t len); void Vec_delete_Type(Vec_Type * v);
+typedef struct Vec_Symbol Vec_Symbol; typedef struct Symbol * Vec_Element_Symbol; Vec_Symbol * Vec_new_Symbol(void); size_t Vec_len_Symbol(const Vec_Symbol * v); Vec_Element_Symbol * Vec_ptr_Symbol(Vec_Symbol * v); const Vec_Element_Symbol * Vec_cptr_Symbol(const Vec_Symbol * v); Vec_Element_Symbol Vec_get_Symbol(const Vec_Symbol * v, size_t i); void Vec_set_Symbol(Vec_Symbol * v, size_t i, Vec_Element_Symbol x); void Vec_push_Symbol(Vec_Symbol * v, Vec_Element_Symbol x); Vec_Element_Symbol Vec_pop_Symbol(Vec_Symbol * v); void Vec_reserve_Symbol(Vec_Symbol * v, size_t cap); void Vec_resize_Symbol(Vec_Symbol * v, size_t len); void Vec_delete_Symbol(Vec_Symbol * v);
+typedef struct Vec_Macro Vec_Macro; typedef struct Macro * Vec_Element_Macro; Vec_Macro * Vec_new_Macro(void); size_t Vec_len_Macro(const Vec_Macro * v); Vec_Element_Macro * Vec_ptr_Macro(Vec_Macro * v); const Vec_Element_Macro * Vec_cptr_Macro(const Vec_Macro * v); Vec_Element_Macro Vec_get_Macro(const Vec_Macro * v, size_t i); void Vec_set_Macro(Vec_Macro * v, size_t i, Vec_Element_Macro x); void Vec_push_Macro(Vec_Macro * v, Vec_Element_Macro x); Vec_Element_Macro Vec_pop_Macro(Vec_Macro * v); void Vec_reserve_Macro(Vec_Macro * v, size_t cap); void Vec_resize_Macro(Vec_Macro * v, size_t len); void Vec_delete_Macro(Vec_Macro * v);
+typedef struct Vec_ExprNode Vec_ExprNode; typedef struct ExprNode * Vec_Element_ExprNode; Vec_ExprNode * Vec_new_ExprNode(void); size_t Vec_len_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode * Vec_ptr_ExprNode(Vec_ExprNode * v); const Vec_Element_ExprNode * Vec_cptr_ExprNode(const Vec_ExprNode * v); Vec_Element_ExprNode Vec_get_ExprNode(const Vec_ExprNode * v, size_t i); void Vec_set_ExprNode(Vec_ExprNode * v, size_t i, Vec_Element_ExprNode x); void Vec_push_ExprNode(Vec_ExprNode * v, Vec_Element_ExprNode x); Vec_Element_ExprNode Vec_pop_ExprNode(Vec_ExprNode * v); void Vec_reserve_ExprNode(Vec_ExprNode * v, size_t cap); void Vec_resize_ExprNode(Vec_ExprNode * v, size_t len); void Vec_delete_ExprNode(Vec_ExprNode * v);
+typedef struct Vec_StmtNode Vec_StmtNode; typedef struct StmtNode * Vec_Element_StmtNode; Vec_StmtNode * Vec_new_StmtNode(void); size_t Vec_len_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode * Vec_ptr_StmtNode(Vec_StmtNode * v); const Vec_Element_StmtNode * Vec_cptr_StmtNode(const Vec_StmtNode * v); Vec_Element_StmtNode Vec_get_StmtNode(const Vec_StmtNode * v, size_t i); void Vec_set_StmtNode(Vec_StmtNode * v, size_t i, Vec_Element_StmtNode x); void Vec_push_StmtNode(Vec_StmtNode * v, Vec_Element_StmtNode x); Vec_Element_StmtNode Vec_pop_StmtNode(Vec_StmtNode * v); void Vec_reserve_StmtNode(Vec_StmtNode * v, size_t cap); void Vec_resize_StmtNode(Vec_StmtNode * v, size_t len); void Vec_delete_StmtNode(Vec_StmtNode * v);
+typedef struct Vec_DeclaratorNode Vec_DeclaratorNode; typedef struct DeclaratorNode * Vec_Element_DeclaratorNode; Vec_DeclaratorNode * Vec_new_DeclaratorNode(void); size_t Vec_len_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode * Vec_ptr_DeclaratorNode(Vec_DeclaratorNode * v); const Vec_Element_DeclaratorNode * Vec_cptr_DeclaratorNode(const Vec_DeclaratorNode * v); Vec_Element_DeclaratorNode Vec_get_DeclaratorNode(const Vec_DeclaratorNode * v, size_t i); void Vec_set_DeclaratorNode(Vec_DeclaratorNode * v, size_t i, Vec_Element_DeclaratorNode x); void Vec_push_DeclaratorNode(Vec_DeclaratorNode * v, Vec_Element_DeclaratorNode x); Vec_Element_DeclaratorNode Vec_pop_DeclaratorNode(Vec_DeclaratorNode * v); void Vec_reserve_DeclaratorNode(Vec_DeclaratorNode * v, size_t cap); void Vec_resize_DeclaratorNode(Vec_DeclaratorNode * v, size_t len); void Vec_delete_DeclaratorNode(Vec_DeclaratorNode * v);
+typedef struct Vec_DeclNode Vec_DeclNode; typedef struct DeclNode * Vec_Element_DeclNode; Vec_DeclNode * Vec_new_DeclNode(void); size_t Vec_len_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode * Vec_ptr_DeclNode(Vec_DeclNode * v); const Vec_Element_DeclNode * Vec_cptr_DeclNode(const Vec_DeclNode * v); Vec_Element_DeclNode Vec_get_DeclNode(const Vec_DeclNode * v, size_t i); void Vec_set_DeclNode(Vec_DeclNode * v, size_t i, Vec_Element_DeclNode x); void Vec_push_DeclNode(Vec_DeclNode * v, Vec_Element_DeclNode x); Vec_Element_DeclNode Vec_pop_DeclNode(Vec_DeclNode * v); void Vec_reserve_DeclNode(Vec_DeclNode * v, size_t cap); void Vec_resize_DeclNode(Vec_DeclNode * v, size_t len); void Vec_delete_DeclNode(Vec_DeclNode * v);
+typedef struct Vec_MemberDeclNode Vec_MemberDeclNode; typedef struct MemberDeclNode * Vec_Element_MemberDeclNode; Vec_MemberDeclNode * Vec_new_MemberDeclNode(void); size_t Vec_len_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode * Vec_ptr_MemberDeclNode(Vec_MemberDeclNode * v); const Vec_Element_MemberDeclNode * Vec_cptr_MemberDeclNode(const Vec_MemberDeclNode * v); Vec_Element_MemberDeclNode Vec_get_MemberDeclNode(const Vec_MemberDeclNode * v, size_t i); void Vec_set_MemberDeclNode(Vec_MemberDeclNode * v, size_t i, Vec_Element_MemberDeclNode x); void Vec_push_MemberDeclNode(Vec_MemberDeclNode * v, Vec_Element_MemberDeclNode x); Vec_Element_MemberDeclNode Vec_pop_MemberDeclNode(Vec_MemberDeclNode * v); void Vec_reserve_MemberDeclNode(Vec_MemberDeclNode * v, size_t cap); void Vec_resize_MemberDeclNode(Vec_MemberDeclNode * v, size_t len); void Vec_delete_MemberDeclNode(Vec_MemberDeclNode * v);
+typedef struct Vec_EnumeratorDeclNode Vec_EnumeratorDeclNode; typedef struct EnumeratorDeclNode * Vec_Element_EnumeratorDeclNode; Vec_EnumeratorDeclNode * Vec_new_EnumeratorDeclNode(void); size_t Vec_len_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode * Vec_ptr_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); const Vec_Element_EnumeratorDeclNode * Vec_cptr_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v); Vec_Element_EnumeratorDeclNode Vec_get_EnumeratorDeclNode(const Vec_EnumeratorDeclNode * v, size_t i); void Vec_set_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t i, Vec_Element_EnumeratorDeclNode x); void Vec_push_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, Vec_Element_EnumeratorDeclNode x); Vec_Element_EnumeratorDeclNode Vec_pop_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v); void Vec_reserve_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t cap); void Vec_resize_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v, size_t len); void Vec_delete_EnumeratorDeclNode(Vec_EnumeratorDeclNode * v);
+typedef struct Vec_AssemblerSymbol Vec_AssemblerSymbol; typedef struct AssemblerSymbol * Vec_Element_AssemblerSymbol; Vec_AssemblerSymbol * Vec_new_AssemblerSymbol(void); size_t Vec_len_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol * Vec_ptr_AssemblerSymbol(Vec_AssemblerSymbol * v); const Vec_Element_AssemblerSymbol * Vec_cptr_AssemblerSymbol(const Vec_AssemblerSymbol * v); Vec_Element_AssemblerSymbol Vec_get_AssemblerSymbol(const Vec_AssemblerSymbol * v, size_t i); void Vec_set_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t i, Vec_Element_AssemblerSymbol x); void Vec_push_AssemblerSymbol(Vec_AssemblerSymbol * v, Vec_Element_AssemblerSymbol x); Vec_Element_AssemblerSymbol Vec_pop_AssemblerSymbol(Vec_AssemblerSymbol * v); void Vec_reserve_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t cap); void Vec_resize_AssemblerSymbol(Vec_AssemblerSymbol * v, size_t len); void Vec_delete_AssemblerSymbol(Vec_AssemblerSymbol * v);
+typedef struct Map_Symbol Map_Symbol; typedef struct Symbol * Map_Element_Symbol; Map_Symbol * Map_new_Symbol(void); size_t Map_len_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_find_Symbol(const Map_Symbol * m, const char *key); bool Map_insert_Symbol(Map_Symbol * m, const char *key, Map_Element_Symbol x); bool Map_remove_Symbol(Map_Symbol * m, const char *key); size_t Map_cap_Symbol(const Map_Symbol * m); Map_Element_Symbol Map_value_at_Symbol(const Map_Symbol * m, size_t i);
+typedef struct Map_Macro Map_Macro; typedef struct Macro * Map_Element_Macro; Map_Macro * Map_new_Macro(void); size_t Map_len_Macro(const Map_Macro * m); Map_Element_Macro Map_find_Macro(const Map_Macro * m, const char *key); bool Map_insert_Macro(Map_Macro * m, const char *key, Map_Element_Macro x); bool Map_remove_Macro(Map_Macro * m, const char *key); size_t Map_cap_Macro(const Map_Macro * m); Map_Element_Macro Map_value_at_Macro(const Map_Macro * m, size_t i);
+typedef struct Map_SourceFile Map_SourceFile; typedef struct SourceFile * Map_Element_SourceFile; Map_SourceFile * Map_new_SourceFile(void); size_t Map_len_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_find_SourceFile(const Map_SourceFile * m, const char *key); bool Map_insert_SourceFile(Map_SourceFile * m, const char *key, Map_Element_SourceFile x); bool Map_remove_SourceFile(Map_SourceFile * m, const char *key); size_t Map_cap_SourceFile(const Map_SourceFile * m); Map_Element_SourceFile Map_value_at_SourceFile(const Map_SourceFile * m, size_t i);
+typedef struct Map_String Map_String; typedef const char * Map_Element_String; Map_String * Map_new_String(void); size_t Map_len_String(const Map_String * m); Map_Element_String Map_find_String(const Map_String * m, const char *key); bool Map_insert_String(Map_String * m, const char *key, Map_Element_String x); bool Map_remove_String(Map_String * m, const char *key); size_t Map_cap_String(const Map_String * m); Map_Element_String Map_value_at_String(const Map_String * m, size_t i);
+typedef struct Map_AssemblerSymbol Map_AssemblerSymbol; typedef struct AssemblerSymbol * Map_Element_AssemblerSymbol; Map_AssemblerSymbol * Map_new_AssemblerSymbol(void); size_t Map_len_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_find_AssemblerSymbol(const Map_AssemblerSymbol * m, const char *key); bool Map_insert_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key, Map_Element_AssemblerSymbol x); bool Map_remove_AssemblerSymbol(Map_AssemblerSymbol * m, const char *key); size_t Map_cap_AssemblerSymbol(const Map_AssemblerSymbol * m); Map_Element_AssemblerSymbol Map_value_at_AssemblerSymbol(const Map_AssemblerSymbol * m, size_t i);
+typedef struct Arena Arena;
+Arena *Arena_new(void);
+void Arena_delete(Arena *a);
+void *Arena_alloc(Arena *a, size_t size);
+void Arena_release(Arena *a);
+typedef struct ArenaMark {
+    struct ArenaChunk *chunk;
+    size_t used;
+    size_t num_allocations;
+    size_t allocated_bytes;
+} ArenaMark;
+void Arena_mark(const Arena *a, ArenaMark *mark);
+void Arena_reset(Arena *a, const ArenaMark *mark);
+size_t Arena_num_allocations(const Arena *a);
+size_t Arena_allocated_bytes(const Arena *a);
+size_t Arena_reserved_bytes(const Arena *a);
+const char *Intern_string(const char *s);
+const char *Intern_substring(const char *s, size_t len);
+size_t Intern_hash(const char *interned);
+size_t Intern_length(const char *interned);
+typedef struct HiddenSet HiddenSet;
+typedef struct HiddenSetTable HiddenSetTable;
+HiddenSetTable *HiddenSetTable_new(void);
+HiddenSet *HiddenSet_add(HiddenSetTable *t, HiddenSet *set, const char *name);
+bool HiddenSet_contains(const HiddenSet *set, const char *name);
+size_t HiddenSet_len(const HiddenSet *set);
+char *Path_join(const char *dir, const char *rel_path);
+char *Path_dir(const char *path);
+char *Path_base(const char *path);
+char *Path_normalize(const char *path);
+const char *File_read(const char *path);
+const char *File_read_with_size(const char *path, size_t *size);
+typedef struct BinaryWriter BinaryWriter;
+typedef struct BinaryReader BinaryReader;
+BinaryWriter *BinaryWriter_new(void);
+void BinaryWriter_delete(BinaryWriter *w);
+void BinaryWriter_write_byte(BinaryWriter *w, int byte);
+void BinaryWriter_write_int(BinaryWriter *w, int x);
+void BinaryWriter_patch_int(BinaryWriter *w, size_t pos, int x);
+void BinaryWriter_write_bytes(BinaryWriter *w, const char *s, size_t len);
+void BinaryWriter_write_string(BinaryWriter *w, const char *s);
+const char *BinaryWriter_data(const BinaryWriter *w);
+size_t BinaryWriter_len(const BinaryWriter *w);
+bool BinaryWriter_save(const BinaryWriter *w, const char *path);
+BinaryReader *BinaryReader_new(const char *data, size_t size);
+int BinaryReader_read_int(BinaryReader *r);
+const char *BinaryReader_read_bytes(BinaryReader *r, size_t len);
+const char *BinaryReader_read_string(BinaryReader *r);
+bool BinaryReader_at_end(const BinaryReader *r);
+typedef enum ValueCategory {
+    ValueCategory_lvalue,
+    ValueCategory_rvalue,
+} ValueCategory;
+typedef enum TypeKind {
+    TypeKind_void,
+    TypeKind_char,
+    TypeKind_int,
+    TypeKind_pointer,
+    TypeKind_function,
+    TypeKind_array,
+    TypeKind_struct,
+    TypeKind_enum,
+} TypeKind;
+typedef struct Type Type;
+struct Type {
+    TypeKind kind;
+    Type *pointee_type;
+    Type *return_type;
+    Vec_Type * parameter_types;
+    bool is_var_arg;
+    Type *element_type;
+    size_t array_length;
+    struct Symbol *struct_symbol;
+    Vec_MemberDeclNode * member_decls;
+    Vec_Symbol * member_symbols;
+    Type *underlying_type;
+    struct Symbol *enum_symbol;
+    Vec_EnumeratorDeclNode * enumerators;
+};
+Type *VoidType_new(void);
+Type *CharType_new(void);
+Type *IntType_new(void);
+Type *PointerType_new(Type *pointee_type);
+Type *PointerType_pointee_type(const Type *pointer_type);
+Type *FunctionType_new(
+    Type *return_type, Vec_Type * parameter_types, bool is_var_arg);
+Type *FunctionType_return_type(const Type *function_type);
+Vec_Type * FunctionType_parameter_types(const Type *function_type);
+bool FunctionType_is_var_arg(const Type *function_type);
+Type *ArrayType_new(Type *element_type, size_t array_length);
+Type *ArrayType_element_type(const Type *array_type);
+size_t ArrayType_length(const Type *array_type);
+Type *StructType_new(void);
+bool StructType_is_defined(const Type *struct_type);
+struct Symbol *
+StructType_find_member(const Type *struct_type, const char *member_name);
+Type *
+EnumType_new(Type *underlying_type, Vec_EnumeratorDeclNode * enumerators);
+size_t Type_sizeof(const Type *type);
+size_t Type_alignof(const Type *type);
+bool Type_equals(const Type *a, const Type *b);
+bool Type_is_scalar(const Type *type);
+bool Type_is_incomplete_type(const Type *type);
+bool Type_is_function_pointer_type(const Type *type);
+typedef int TokenKind;
+enum TokenKind {
+    TokenKind_unused = 256,
+TokenKind_identifier,
+TokenKind_number,
+TokenKind_character,
+TokenKind_string,
+TokenKind_kw_static,
+TokenKind_kw_typedef,
+TokenKind_kw_const,
+TokenKind_kw_void,
+TokenKind_kw_char,
+TokenKind_kw_int,
+TokenKind_kw_struct,
+TokenKind_kw_enum,
+TokenKind_kw_sizeof,
+TokenKind_kw_if,
+TokenKind_kw_else,
+TokenKind_kw_while,
+TokenKind_kw_do,
+TokenKind_kw_for,
+TokenKind_kw_break,
+TokenKind_kw_continue,
+TokenKind_kw_goto,
+TokenKind_kw_switch,
+TokenKind_kw_case,
+TokenKind_kw_default,
+TokenKind_kw_return,
+TokenKind_arrow,
+TokenKind_lesser_equal,
+TokenKind_greater_equal,
+TokenKind_equal,
+TokenKind_not_equal,
+TokenKind_and_and,
+TokenKind_or_or,
+TokenKind_dot_dot,
+TokenKind_var_arg,
+};
+typedef struct Token {
+    TokenKind kind;
+    bool is_bol;
+    bool has_spaces;
+    int string_len;
+    const char *text;
+    const char *source;
+    size_t offset;
+    size_t length;
+    const char *string;
+    HiddenSet *hidden_set;
+} Token;
+typedef enum StorageClass {
+    StorageClass_none,
+    StorageClass_static,
+    StorageClass_typedef,
+    StorageClass_enum,
+} StorageClass;
+typedef struct Symbol {
+    const char *name;
+    StorageClass storage_class;
+    Type *type;
+    int enum_value;
+    bool has_body;
+    struct NativeAddress *address;
+} Symbol;
+Symbol *Symbol_new(const char *name, StorageClass storage_class, Type *type);
+typedef struct Scope Scope;
+Scope *Scope_new(Scope *parent_scope);
+Scope *Scope_parent_scope(const Scope *s);
+Symbol *Scope_find(Scope *s, const char *name, bool recursive);
+bool Scope_try_register(Scope *s, Symbol *symbol);
+Vec_Symbol * Scope_symbols(const Scope *s);
+typedef enum NodeKind {
+NodeKind_IdentifierExpr,
+   
+
+NodeKind_EnumeratorExpr,
+   
+   
+
+NodeKind_IntegerExpr,
+   
+
+NodeKind_StringExpr,
+   
+   
+
+NodeKind_SubscriptExpr,
+   
+   
+
+NodeKind_CallExpr,
+   
+   
+
+NodeKind_DotExpr,
+   
+   
+
+NodeKind_ArrowExpr,
+   
+   
+
+NodeKind_SizeofExpr,
+   
+   
+
+NodeKind_CastExpr,
+   
+
+
+
+
+
+
+NodeKind_UnaryExpr,
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+NodeKind_BinaryExpr,
+   
+   
+   
+
+NodeKind_AssignExpr,
+   
+   
+
+NodeKind_ImplicitCastExpr,
+   
+   
+
+NodeKind_CompoundStmt,
+   
+
+NodeKind_IfStmt,
+   
+   
+   
+
+NodeKind_WhileStmt,
+   
+   
+
+NodeKind_ForStmt,
+   
+   
+   
+   
+
+NodeKind_ReturnStmt,
+   
+
+NodeKind_DeclStmt,
+   
+   
+
+NodeKind_ExprStmt,
+   
+
+NodeKind_AbstractDirectDeclarator,
+   
+
+NodeKind_DirectDeclarator,
+   
+   
+
+NodeKind_ArrayDeclarator,
+   
+   
+
+NodeKind_FunctionDeclarator,
+   
+   
+   
+
+NodeKind_PointerDeclarator,
+   
+
+NodeKind_InitDeclarator,
+   
+   
+
+NodeKind_GlobalDecl,
+   
+   
+
+NodeKind_FunctionDecl,
+   
+   
+   
+   
+
+NodeKind_MemberDecl,
+   
+   
+
+NodeKind_EnumeratorDecl,
+   
+   
+
+NodeKind_DeclSpec,
+   
+   
+
+NodeKind_TranslationUnit,
+   
+
+} NodeKind;
+typedef struct Node Node;
+typedef struct ExprNode ExprNode;
+typedef struct StmtNode StmtNode;
+typedef struct DeclaratorNode DeclaratorNode;
+typedef struct DeclNode DeclNode;
+typedef struct IdentifierExprNode IdentifierExprNode;
+   
+
+typedef struct EnumeratorExprNode EnumeratorExprNode;
+   
+   
+
+typedef struct IntegerExprNode IntegerExprNode;
+   
+
+typedef struct StringExprNode StringExprNode;
+   
+   
+
+typedef struct SubscriptExprNode SubscriptExprNode;
+   
+   
+
+typedef struct CallExprNode CallExprNode;
+   
+   
+
+typedef struct DotExprNode DotExprNode;
+   
+   
+
+typedef struct ArrowExprNode ArrowExprNode;
+   
+   
+
+typedef struct SizeofExprNode SizeofExprNode;
+   
+   
+
+typedef struct CastExprNode CastExprNode;
+   
+
+
+
+
+
+
+typedef struct UnaryExprNode UnaryExprNode;
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct BinaryExprNode BinaryExprNode;
+   
+   
+   
+
+typedef struct AssignExprNode AssignExprNode;
+   
+   
+
+typedef struct ImplicitCastExprNode ImplicitCastExprNode;
+   
+   
+
+typedef struct CompoundStmtNode CompoundStmtNode;
+   
+
+typedef struct IfStmtNode IfStmtNode;
+   
+   
+   
+
+typedef struct WhileStmtNode WhileStmtNode;
+   
+   
+
+typedef struct ForStmtNode ForStmtNode;
+   
+   
+   
+   
+
+typedef struct ReturnStmtNode ReturnStmtNode;
+   
+
+typedef struct DeclStmtNode DeclStmtNode;
+   
+   
+
+typedef struct ExprStmtNode ExprStmtNode;
+   
+
+typedef struct AbstractDirectDeclaratorNode AbstractDirectDeclaratorNode;
+   
+
+typedef struct DirectDeclaratorNode DirectDeclaratorNode;
+   
+   
+
+typedef struct ArrayDeclaratorNode ArrayDeclaratorNode;
+   
+   
+
+typedef struct FunctionDeclaratorNode FunctionDeclaratorNode;
+   
+   
+   
+
+typedef struct PointerDeclaratorNode PointerDeclaratorNode;
+   
+
+typedef struct InitDeclaratorNode InitDeclaratorNode;
+   
+   
+
+typedef struct GlobalDeclNode GlobalDeclNode;
+   
+   
+
+typedef struct FunctionDeclNode FunctionDeclNode;
+   
+   
+   
+   
+
+typedef struct MemberDeclNode MemberDeclNode;
+   
+   
+
+typedef struct EnumeratorDeclNode EnumeratorDeclNode;
+   
+   
+
+typedef struct DeclSpecNode DeclSpecNode;
+   
+   
+
+typedef struct TranslationUnitNode TranslationUnitNode;
+   
+
+struct Node {
+    NodeKind kind;
+};
+struct ExprNode {
+    NodeKind kind;
+    Type *result_type;
+    ValueCategory value_category;
+};
+struct StmtNode {
+    NodeKind kind;
+};
+struct DeclaratorNode {
+    NodeKind kind;
+};
+struct DeclNode {
+    NodeKind kind;
+};
+typedef enum UnaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+UnaryOp_positive,
+UnaryOp_negative,
+UnaryOp_not,
+UnaryOp_address_of,
+UnaryOp_indirection,
+
+   
+   
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} UnaryOp;
+typedef enum BinaryOp {
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+
+
+
+
+
+   
+   
+
+BinaryOp_add,
+BinaryOp_sub,
+BinaryOp_mul,
+BinaryOp_div,
+BinaryOp_mod,
+BinaryOp_lesser_than,
+BinaryOp_lesser_equal,
+BinaryOp_greater_than,
+BinaryOp_greater_equal,
+BinaryOp_equal,
+BinaryOp_and,
+BinaryOp_not_equal,
+BinaryOp_logical_and,
+BinaryOp_logical_or,
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+
+
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+   
+
+
+   
+
+} BinaryOp;
+typedef enum ImplicitCastOp {
+    ImplicitCastOp_lvalue_to_rvalue,
+    ImplicitCastOp_function_to_function_pointer,
+    ImplicitCastOp_array_to_pointer,
+    ImplicitCastOp_integral_cast,
+    ImplicitCastOp_integer_to_pointer_cast,
+    ImplicitCastOp_pointer_to_pointer_cast,
+} ImplicitCastOp;
+Node *IdentifierExprNode_base_node(IdentifierExprNode *p); const Node *IdentifierExprNode_cbase_node(const IdentifierExprNode *p); ExprNode *IdentifierExprNode_base(IdentifierExprNode *p); const ExprNode *IdentifierExprNode_cbase(const IdentifierExprNode *p); IdentifierExprNode *IdentifierExprNode_cast_node(Node *p); const IdentifierExprNode *IdentifierExprNode_ccast_node(const Node *p); IdentifierExprNode *IdentifierExprNode_cast(ExprNode *p); const IdentifierExprNode *IdentifierExprNode_ccast(const ExprNode *p); struct IdentifierExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+};
+Node *EnumeratorExprNode_base_node(EnumeratorExprNode *p); const Node *EnumeratorExprNode_cbase_node(const EnumeratorExprNode *p); ExprNode *EnumeratorExprNode_base(EnumeratorExprNode *p); const ExprNode *EnumeratorExprNode_cbase(const EnumeratorExprNode *p); EnumeratorExprNode *EnumeratorExprNode_cast_node(Node *p); const EnumeratorExprNode *EnumeratorExprNode_ccast_node(const Node *p); EnumeratorExprNode *EnumeratorExprNode_cast(ExprNode *p); const EnumeratorExprNode *EnumeratorExprNode_ccast(const ExprNode *p); struct EnumeratorExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Symbol * symbol;
+    int value;
+};
+Node *IntegerExprNode_base_node(IntegerExprNode *p); const Node *IntegerExprNode_cbase_node(const IntegerExprNode *p); ExprNode *IntegerExprNode_base(IntegerExprNode *p); const ExprNode *IntegerExprNode_cbase(const IntegerExprNode *p); IntegerExprNode *IntegerExprNode_cast_node(Node *p); const IntegerExprNode *IntegerExprNode_ccast_node(const Node *p); IntegerExprNode *IntegerExprNode_cast(ExprNode *p); const IntegerExprNode *IntegerExprNode_ccast(const ExprNode *p); struct IntegerExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    int value;
+};
+Node *StringExprNode_base_node(StringExprNode *p); const Node *StringExprNode_cbase_node(const StringExprNode *p); ExprNode *StringExprNode_base(StringExprNode *p); const ExprNode *StringExprNode_cbase(const StringExprNode *p); StringExprNode *StringExprNode_cast_node(Node *p); const StringExprNode *StringExprNode_ccast_node(const Node *p); StringExprNode *StringExprNode_cast(ExprNode *p); const StringExprNode *StringExprNode_ccast(const ExprNode *p); struct StringExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    const char * value;
+    size_t length;
+};
+Node *SubscriptExprNode_base_node(SubscriptExprNode *p); const Node *SubscriptExprNode_cbase_node(const SubscriptExprNode *p); ExprNode *SubscriptExprNode_base(SubscriptExprNode *p); const ExprNode *SubscriptExprNode_cbase(const SubscriptExprNode *p); SubscriptExprNode *SubscriptExprNode_cast_node(Node *p); const SubscriptExprNode *SubscriptExprNode_ccast_node(const Node *p); SubscriptExprNode *SubscriptExprNode_cast(ExprNode *p); const SubscriptExprNode *SubscriptExprNode_ccast(const ExprNode *p); struct SubscriptExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * array;
+    ExprNode * index;
+};
+Node *CallExprNode_base_node(CallExprNode *p); const Node *CallExprNode_cbase_node(const CallExprNode *p); ExprNode *CallExprNode_base(CallExprNode *p); const ExprNode *CallExprNode_cbase(const CallExprNode *p); CallExprNode *CallExprNode_cast_node(Node *p); const CallExprNode *CallExprNode_ccast_node(const Node *p); CallExprNode *CallExprNode_cast(ExprNode *p); const CallExprNode *CallExprNode_ccast(const ExprNode *p); struct CallExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * callee;
+    Vec_ExprNode * arguments;
+};
+Node *DotExprNode_base_node(DotExprNode *p); const Node *DotExprNode_cbase_node(const DotExprNode *p); ExprNode *DotExprNode_base(DotExprNode *p); const ExprNode *DotExprNode_cbase(const DotExprNode *p); DotExprNode *DotExprNode_cast_node(Node *p); const DotExprNode *DotExprNode_ccast_node(const Node *p); DotExprNode *DotExprNode_cast(ExprNode *p); const DotExprNode *DotExprNode_ccast(const ExprNode *p); struct DotExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *ArrowExprNode_base_node(ArrowExprNode *p); const Node *ArrowExprNode_cbase_node(const ArrowExprNode *p); ExprNode *ArrowExprNode_base(ArrowExprNode *p); const ExprNode *ArrowExprNode_cbase(const ArrowExprNode *p); ArrowExprNode *ArrowExprNode_cast_node(Node *p); const ArrowExprNode *ArrowExprNode_ccast_node(const Node *p); ArrowExprNode *ArrowExprNode_cast(ExprNode *p); const ArrowExprNode *ArrowExprNode_ccast(const ExprNode *p); struct ArrowExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * parent;
+    Symbol * member_symbol;
+};
+Node *SizeofExprNode_base_node(SizeofExprNode *p); const Node *SizeofExprNode_cbase_node(const SizeofExprNode *p); ExprNode *SizeofExprNode_base(SizeofExprNode *p); const ExprNode *SizeofExprNode_cbase(const SizeofExprNode *p); SizeofExprNode *SizeofExprNode_cast_node(Node *p); const SizeofExprNode *SizeofExprNode_ccast_node(const Node *p); SizeofExprNode *SizeofExprNode_cast(ExprNode *p); const SizeofExprNode *SizeofExprNode_ccast(const ExprNode *p); struct SizeofExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    Type * type;
+    ExprNode * expression;
+};
+Node *CastExprNode_base_node(CastExprNode *p); const Node *CastExprNode_cbase_node(const CastExprNode *p); ExprNode *CastExprNode_base(CastExprNode *p); const ExprNode *CastExprNode_cbase(const CastExprNode *p); CastExprNode *CastExprNode_cast_node(Node *p); const CastExprNode *CastExprNode_ccast_node(const Node *p); CastExprNode *CastExprNode_cast(ExprNode *p); const CastExprNode *CastExprNode_ccast(const ExprNode *p); struct CastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * expression;
+};
+
+
+
+
+
+Node *UnaryExprNode_base_node(UnaryExprNode *p); const Node *UnaryExprNode_cbase_node(const UnaryExprNode *p); ExprNode *UnaryExprNode_base(UnaryExprNode *p); const ExprNode *UnaryExprNode_cbase(const UnaryExprNode *p); UnaryExprNode *UnaryExprNode_cast_node(Node *p); const UnaryExprNode *UnaryExprNode_ccast_node(const Node *p); UnaryExprNode *UnaryExprNode_cast(ExprNode *p); const UnaryExprNode *UnaryExprNode_ccast(const ExprNode *p); struct UnaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    UnaryOp operator;
+    ExprNode * operand;
+};
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+Node *BinaryExprNode_base_node(BinaryExprNode *p); const Node *BinaryExprNode_cbase_node(const BinaryExprNode *p); ExprNode *BinaryExprNode_base(BinaryExprNode *p); const ExprNode *BinaryExprNode_cbase(const BinaryExprNode *p); BinaryExprNode *BinaryExprNode_cast_node(Node *p); const BinaryExprNode *BinaryExprNode_ccast_node(const Node *p); BinaryExprNode *BinaryExprNode_cast(ExprNode *p); const BinaryExprNode *BinaryExprNode_ccast(const ExprNode *p); struct BinaryExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    BinaryOp operator;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *AssignExprNode_base_node(AssignExprNode *p); const Node *AssignExprNode_cbase_node(const AssignExprNode *p); ExprNode *AssignExprNode_base(AssignExprNode *p); const ExprNode *AssignExprNode_cbase(const AssignExprNode *p); AssignExprNode *AssignExprNode_cast_node(Node *p); const AssignExprNode *AssignExprNode_ccast_node(const Node *p); AssignExprNode *AssignExprNode_cast(ExprNode *p); const AssignExprNode *AssignExprNode_ccast(const ExprNode *p); struct AssignExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ExprNode * lhs;
+    ExprNode * rhs;
+};
+Node *ImplicitCastExprNode_base_node(ImplicitCastExprNode *p); const Node *ImplicitCastExprNode_cbase_node(const ImplicitCastExprNode *p); ExprNode *ImplicitCastExprNode_base(ImplicitCastExprNode *p); const ExprNode *ImplicitCastExprNode_cbase(const ImplicitCastExprNode *p); ImplicitCastExprNode *ImplicitCastExprNode_cast_node(Node *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast_node(const Node *p); ImplicitCastExprNode *ImplicitCastExprNode_cast(ExprNode *p); const ImplicitCastExprNode *ImplicitCastExprNode_ccast(const ExprNode *p); struct ImplicitCastExprNode { NodeKind kind; Type * result_type; ValueCategory value_category;
+    ImplicitCastOp operator;
+    ExprNode * expression;
+};
+Node *CompoundStmtNode_base_node(CompoundStmtNode *p); const Node *CompoundStmtNode_cbase_node(const CompoundStmtNode *p); StmtNode *CompoundStmtNode_base(CompoundStmtNode *p); const StmtNode *CompoundStmtNode_cbase(const CompoundStmtNode *p); CompoundStmtNode *CompoundStmtNode_cast_node(Node *p); const CompoundStmtNode *CompoundStmtNode_ccast_node(const Node *p); CompoundStmtNode *CompoundStmtNode_cast(StmtNode *p); const CompoundStmtNode *CompoundStmtNode_ccast(const StmtNode *p); struct CompoundStmtNode { NodeKind kind;
+    Vec_StmtNode * statements;
+};
+Node *IfStmtNode_base_node(IfStmtNode *p); const Node *IfStmtNode_cbase_node(const IfStmtNode *p); StmtNode *IfStmtNode_base(IfStmtNode *p); const StmtNode *IfStmtNode_cbase(const IfStmtNode *p); IfStmtNode *IfStmtNode_cast_node(Node *p); const IfStmtNode *IfStmtNode_ccast_node(const Node *p); IfStmtNode *IfStmtNode_cast(StmtNode *p); const IfStmtNode *IfStmtNode_ccast(const StmtNode *p); struct IfStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * if_true;
+    StmtNode * if_false;
+};
+Node *WhileStmtNode_base_node(WhileStmtNode *p); const Node *WhileStmtNode_cbase_node(const WhileStmtNode *p); StmtNode *WhileStmtNode_base(WhileStmtNode *p); const StmtNode *WhileStmtNode_cbase(const WhileStmtNode *p); WhileStmtNode *WhileStmtNode_cast_node(Node *p); const WhileStmtNode *WhileStmtNode_ccast_node(const Node *p); WhileStmtNode *WhileStmtNode_cast(StmtNode *p); const WhileStmtNode *WhileStmtNode_ccast(const StmtNode *p); struct WhileStmtNode { NodeKind kind;
+    ExprNode * condition;
+    StmtNode * body;
+};
+Node *ForStmtNode_base_node(ForStmtNode *p); const Node *ForStmtNode_cbase_node(const ForStmtNode *p); StmtNode *ForStmtNode_base(ForStmtNode *p); const StmtNode *ForStmtNode_cbase(const ForStmtNode *p); ForStmtNode *ForStmtNode_cast_node(Node *p); const ForStmtNode *ForStmtNode_ccast_node(const Node *p); ForStmtNode *ForStmtNode_cast(StmtNode *p); const ForStmtNode *ForStmtNode_ccast(const StmtNode *p); struct ForStmtNode { NodeKind kind;
+    StmtNode * initializer;
+    ExprNode * condition;
+    ExprNode * step;
+    StmtNode * body;
+};
+Node *ReturnStmtNode_base_node(ReturnStmtNode *p); const Node *ReturnStmtNode_cbase_node(const ReturnStmtNode *p); StmtNode *ReturnStmtNode_base(ReturnStmtNode *p); const StmtNode *ReturnStmtNode_cbase(const ReturnStmtNode *p); ReturnStmtNode *ReturnStmtNode_cast_node(Node *p); const ReturnStmtNode *ReturnStmtNode_ccast_node(const Node *p); ReturnStmtNode *ReturnStmtNode_cast(StmtNode *p); const ReturnStmtNode *ReturnStmtNode_ccast(const StmtNode *p); struct ReturnStmtNode { NodeKind kind;
+    ExprNode * return_value;
+};
+Node *DeclStmtNode_base_node(DeclStmtNode *p); const Node *DeclStmtNode_cbase_node(const DeclStmtNode *p); StmtNode *DeclStmtNode_base(DeclStmtNode *p); const StmtNode *DeclStmtNode_cbase(const DeclStmtNode *p); DeclStmtNode *DeclStmtNode_cast_node(Node *p); const DeclStmtNode *DeclStmtNode_ccast_node(const Node *p); DeclStmtNode *DeclStmtNode_cast(StmtNode *p); const DeclStmtNode *DeclStmtNode_ccast(const StmtNode *p); struct DeclStmtNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *ExprStmtNode_base_node(ExprStmtNode *p); const Node *ExprStmtNode_cbase_node(const ExprStmtNode *p); StmtNode *ExprStmtNode_base(ExprStmtNode *p); const StmtNode *ExprStmtNode_cbase(const ExprStmtNode *p); ExprStmtNode *ExprStmtNode_cast_node(Node *p); const ExprStmtNode *ExprStmtNode_ccast_node(const Node *p); ExprStmtNode *ExprStmtNode_cast(StmtNode *p); const ExprStmtNode *ExprStmtNode_ccast(const StmtNode *p); struct ExprStmtNode { NodeKind kind;
+    ExprNode * expression;
+};
+Node *AbstractDirectDeclaratorNode_base_node(AbstractDirectDeclaratorNode *p); const Node *AbstractDirectDeclaratorNode_cbase_node(const AbstractDirectDeclaratorNode *p); DeclaratorNode *AbstractDirectDeclaratorNode_base(AbstractDirectDeclaratorNode *p); const DeclaratorNode *AbstractDirectDeclaratorNode_cbase(const AbstractDirectDeclaratorNode *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast_node(Node *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast_node(const Node *p); AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_cast(DeclaratorNode *p); const AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_ccast(const DeclaratorNode *p); struct AbstractDirectDeclaratorNode { NodeKind kind;
+    Symbol * symbol;
+};
+Node *DirectDeclaratorNode_base_node(DirectDeclaratorNode *p); const Node *DirectDeclaratorNode_cbase_node(const DirectDeclaratorNode *p); DeclaratorNode *DirectDeclaratorNode_base(DirectDeclaratorNode *p); const DeclaratorNode *DirectDeclaratorNode_cbase(const DirectDeclaratorNode *p); DirectDeclaratorNode *DirectDeclaratorNode_cast_node(Node *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast_node(const Node *p); DirectDeclaratorNode *DirectDeclaratorNode_cast(DeclaratorNode *p); const DirectDeclaratorNode *DirectDeclaratorNode_ccast(const DeclaratorNode *p); struct DirectDeclaratorNode { NodeKind kind;
+    const char * name;
+    Symbol * symbol;
+};
+Node *ArrayDeclaratorNode_base_node(ArrayDeclaratorNode *p); const Node *ArrayDeclaratorNode_cbase_node(const ArrayDeclaratorNode *p); DeclaratorNode *ArrayDeclaratorNode_base(ArrayDeclaratorNode *p); const DeclaratorNode *ArrayDeclaratorNode_cbase(const ArrayDeclaratorNode *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast_node(Node *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast_node(const Node *p); ArrayDeclaratorNode *ArrayDeclaratorNode_cast(DeclaratorNode *p); const ArrayDeclaratorNode *ArrayDeclaratorNode_ccast(const DeclaratorNode *p); struct ArrayDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * array_size;
+};
+Node *FunctionDeclaratorNode_base_node(FunctionDeclaratorNode *p); const Node *FunctionDeclaratorNode_cbase_node(const FunctionDeclaratorNode *p); DeclaratorNode *FunctionDeclaratorNode_base(FunctionDeclaratorNode *p); const DeclaratorNode *FunctionDeclaratorNode_cbase(const FunctionDeclaratorNode *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast_node(Node *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast_node(const Node *p); FunctionDeclaratorNode *FunctionDeclaratorNode_cast(DeclaratorNode *p); const FunctionDeclaratorNode *FunctionDeclaratorNode_ccast(const DeclaratorNode *p); struct FunctionDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    Vec_DeclaratorNode * parameters;
+    bool is_var_arg;
+};
+Node *PointerDeclaratorNode_base_node(PointerDeclaratorNode *p); const Node *PointerDeclaratorNode_cbase_node(const PointerDeclaratorNode *p); DeclaratorNode *PointerDeclaratorNode_base(PointerDeclaratorNode *p); const DeclaratorNode *PointerDeclaratorNode_cbase(const PointerDeclaratorNode *p); PointerDeclaratorNode *PointerDeclaratorNode_cast_node(Node *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast_node(const Node *p); PointerDeclaratorNode *PointerDeclaratorNode_cast(DeclaratorNode *p); const PointerDeclaratorNode *PointerDeclaratorNode_ccast(const DeclaratorNode *p); struct PointerDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+};
+Node *InitDeclaratorNode_base_node(InitDeclaratorNode *p); const Node *InitDeclaratorNode_cbase_node(const InitDeclaratorNode *p); DeclaratorNode *InitDeclaratorNode_base(InitDeclaratorNode *p); const DeclaratorNode *InitDeclaratorNode_cbase(const InitDeclaratorNode *p); InitDeclaratorNode *InitDeclaratorNode_cast_node(Node *p); const InitDeclaratorNode *InitDeclaratorNode_ccast_node(const Node *p); InitDeclaratorNode *InitDeclaratorNode_cast(DeclaratorNode *p); const InitDeclaratorNode *InitDeclaratorNode_ccast(const DeclaratorNode *p); struct InitDeclaratorNode { NodeKind kind;
+    DeclaratorNode * declarator;
+    ExprNode * initializer;
+};
+Node *GlobalDeclNode_base_node(GlobalDeclNode *p); const Node *GlobalDeclNode_cbase_node(const GlobalDeclNode *p); DeclNode *GlobalDeclNode_base(GlobalDeclNode *p); const DeclNode *GlobalDeclNode_cbase(const GlobalDeclNode *p); GlobalDeclNode *GlobalDeclNode_cast_node(Node *p); const GlobalDeclNode *GlobalDeclNode_ccast_node(const Node *p); GlobalDeclNode *GlobalDeclNode_cast(DeclNode *p); const GlobalDeclNode *GlobalDeclNode_ccast(const DeclNode *p); struct GlobalDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *FunctionDeclNode_base_node(FunctionDeclNode *p); const Node *FunctionDeclNode_cbase_node(const FunctionDeclNode *p); DeclNode *FunctionDeclNode_base(FunctionDeclNode *p); const DeclNode *FunctionDeclNode_cbase(const FunctionDeclNode *p); FunctionDeclNode *FunctionDeclNode_cast_node(Node *p); const FunctionDeclNode *FunctionDeclNode_ccast_node(const Node *p); FunctionDeclNode *FunctionDeclNode_cast(DeclNode *p); const FunctionDeclNode *FunctionDeclNode_ccast(const DeclNode *p); struct FunctionDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    DeclaratorNode * declarator;
+    StmtNode * body;
+    Vec_Symbol * local_variables;
+};
+Node *MemberDeclNode_base_node(MemberDeclNode *p); const Node *MemberDeclNode_cbase_node(const MemberDeclNode *p); DeclNode *MemberDeclNode_base(MemberDeclNode *p); const DeclNode *MemberDeclNode_cbase(const MemberDeclNode *p); MemberDeclNode *MemberDeclNode_cast_node(Node *p); const MemberDeclNode *MemberDeclNode_ccast_node(const Node *p); MemberDeclNode *MemberDeclNode_cast(DeclNode *p); const MemberDeclNode *MemberDeclNode_ccast(const DeclNode *p); struct MemberDeclNode { NodeKind kind;
+    DeclSpecNode * decl_spec;
+    Vec_DeclaratorNode * declarators;
+};
+Node *EnumeratorDeclNode_base_node(EnumeratorDeclNode *p); const Node *EnumeratorDeclNode_cbase_node(const EnumeratorDeclNode *p); DeclNode *EnumeratorDeclNode_base(EnumeratorDeclNode *p); const DeclNode *EnumeratorDeclNode_cbase(const EnumeratorDeclNode *p); EnumeratorDeclNode *EnumeratorDeclNode_cast_node(Node *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast_node(const Node *p); EnumeratorDeclNode *EnumeratorDeclNode_cast(DeclNode *p); const EnumeratorDeclNode *EnumeratorDeclNode_ccast(const DeclNode *p); struct EnumeratorDeclNode { NodeKind kind;
+    Symbol * symbol;
+    ExprNode * value;
+};
+Node *DeclSpecNode_base_node(DeclSpecNode *p); const Node *DeclSpecNode_cbase_node(const DeclSpecNode *p); Node *DeclSpecNode_base(DeclSpecNode *p); const Node *DeclSpecNode_cbase(const DeclSpecNode *p); DeclSpecNode *DeclSpecNode_cast_node(Node *p); const DeclSpecNode *DeclSpecNode_ccast_node(const Node *p); DeclSpecNode *DeclSpecNode_cast(Node *p); const DeclSpecNode *DeclSpecNode_ccast(const Node *p); struct DeclSpecNode { NodeKind kind;
+    StorageClass storage_class;
+    Type * base_type;
+};
+Node *TranslationUnitNode_base_node(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase_node(const TranslationUnitNode *p); Node *TranslationUnitNode_base(TranslationUnitNode *p); const Node *TranslationUnitNode_cbase(const TranslationUnitNode *p); TranslationUnitNode *TranslationUnitNode_cast_node(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast_node(const Node *p); TranslationUnitNode *TranslationUnitNode_cast(Node *p); const TranslationUnitNode *TranslationUnitNode_ccast(const Node *p); struct TranslationUnitNode { NodeKind kind;
+    Vec_DeclNode * declarations;
+};
+IdentifierExprNode *IdentifierExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol);
+EnumeratorExprNode *EnumeratorExprNode_new(
+    Type *result_type, ValueCategory value_category, Symbol *symbol, int value);
+IntegerExprNode *
+IntegerExprNode_new(Type *result_type, ValueCategory value_category, int value);
+StringExprNode *StringExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    const char *string,
+    size_t length);
+SubscriptExprNode *SubscriptExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *array,
+    ExprNode *index);
+CallExprNode *CallExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *callee,
+    Vec_ExprNode * arguments);
+DotExprNode *DotExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+ArrowExprNode *ArrowExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *parent,
+    Symbol *member_symbol);
+SizeofExprNode *SizeofExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    Type *type,
+    ExprNode *expression);
+CastExprNode *CastExprNode_new(
+    Type *result_type, ValueCategory value_category, ExprNode *expression);
+UnaryExprNode *UnaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    UnaryOp
+    operator,
+    ExprNode *operand);
+BinaryExprNode *BinaryExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    BinaryOp
+    operator,
+    ExprNode *lhs,
+    ExprNode *rhs);
+AssignExprNode *AssignExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ExprNode *lhs,
+    ExprNode *rhs);
+ImplicitCastExprNode *ImplicitCastExprNode_new(
+    Type *result_type,
+    ValueCategory value_category,
+    ImplicitCastOp
+    operator,
+    ExprNode *expression);
+CompoundStmtNode *CompoundStmtNode_new(Vec_StmtNode * statements);
+IfStmtNode *
+IfStmtNode_new(ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+WhileStmtNode *WhileStmtNode_new(ExprNode *condition, StmtNode *body);
+ForStmtNode *ForStmtNode_new(
+    StmtNode *initializer, ExprNode *condition, ExprNode *step, StmtNode *body);
+ReturnStmtNode *ReturnStmtNode_new(ExprNode *return_value);
+DeclStmtNode *
+DeclStmtNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+ExprStmtNode *ExprStmtNode_new(ExprNode *expression);
+AbstractDirectDeclaratorNode *AbstractDirectDeclaratorNode_new(void);
+DirectDeclaratorNode *DirectDeclaratorNode_new(const char *name);
+ArrayDeclaratorNode *
+ArrayDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *array_size);
+FunctionDeclaratorNode *FunctionDeclaratorNode_new(
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+PointerDeclaratorNode *PointerDeclaratorNode_new(DeclaratorNode *declarator);
+InitDeclaratorNode *
+InitDeclaratorNode_new(DeclaratorNode *declarator, ExprNode *initializer);
+Symbol *DeclaratorNode_symbol(const DeclaratorNode *p);
+Vec_DeclaratorNode * DeclaratorNode_parameters(const DeclaratorNode *p);
+GlobalDeclNode *
+GlobalDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+FunctionDeclNode *FunctionDeclNode_new(
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body,
+    Vec_Symbol * local_variables);
+MemberDeclNode *
+MemberDeclNode_new(DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+EnumeratorDeclNode *EnumeratorDeclNode_new(Symbol *symbol, ExprNode *value);
+DeclSpecNode *DeclSpecNode_new(StorageClass storage_class, Type *base_type);
+TranslationUnitNode *TranslationUnitNode_new(Vec_DeclNode * declarations);
+void Node_dump(const Node *p, FILE *fp);
+Arena *Node_arena(void);
+void Node_release_arena(void);
+typedef enum ScanLevel {
+    ScanLevel_scalar,
+    ScanLevel_sse2,
+    ScanLevel_avx2,
+} ScanLevel;
+ScanLevel Scan_max_level(void);
+ScanLevel Scan_level(void);
+void Scan_set_level(ScanLevel level);
+size_t Scan_spaces(const char *s);
+size_t Scan_digits(const char *s);
+size_t Scan_identifier(const char *s);
+size_t Scan_literal(const char *s, char quote);
+typedef struct Lexer Lexer;
+void Lexer_init_tables(void);
+Lexer *Lexer_new(const char *filename, const char *text);
+Token *Lexer_read(Lexer *l);
+Vec_Token * Lexer_read_all(Lexer *l);
+const char *Lexer_directive_at(const Vec_Token * tokens, size_t i);
+typedef struct SourceFile {
+    const char *path;
+    const char *text;
+    Vec_Token * tokens;
+    const char *guard_macro;
+} SourceFile;
+const SourceFile *SourceCache_load(const char *path);
+typedef struct Macro {
+    const char *name;
+    Vec_String * parameters;
+    Vec_Token * contents;
+} Macro;
+Macro *
+Macro_new(const char *name, Vec_String * parameters, Vec_Token * contents);
+Macro *Macro_new_simple(const char *name, Vec_Token * contents);
+bool Macro_is_function(const Macro *m);
+typedef struct Preprocessor Preprocessor;
+Preprocessor *Preprocessor_new(Vec_String * include_paths);
+void Preprocessor_begin(
+    Preprocessor *pp, const char *filename, const char *text);
+Token *Preprocessor_next(Preprocessor *pp);
+Vec_Token *
+    Preprocessor_run(Preprocessor *pp, const char *filename, const char *text);
+void Preprocessor_define_macro(Preprocessor *pp, Macro *macro);
+const Map_Macro * Preprocessor_macros(const Preprocessor *pp);
+void Preprocessor_mark_once(Preprocessor *pp, const char *path);
+const Map_String * Preprocessor_once_files(const Preprocessor *pp);
+Vec_Token *
+    Preprocessor_read(
+        Vec_String * include_paths, const char *filename, const char *text);
+void TokenStream_write(BinaryWriter *w, const Vec_Token * tokens);
+bool TokenStream_is_binary(const char *data, size_t size);
+Vec_Token * TokenStream_read(const char *data, size_t size);
+void TokenStream_print(const Vec_Token * tokens, FILE *fp);
+typedef struct TokenSource TokenSource;
+TokenSource *TokenSource_from_vec(const Vec_Token * tokens);
+TokenSource *TokenSource_from_preprocessor(Preprocessor *pp);
+Token *TokenSource_next(TokenSource *source);
+Vec_Token * TokenSource_read_all(TokenSource *source);
+typedef struct Parser Parser;
+Parser *Parser_new(const Vec_Token * tokens);
+Parser *Parser_new_from_source(TokenSource *source);
+TranslationUnitNode *Parser_parse(Parser *p);
+DeclNode *Parser_parse_next_decl(Parser *p);
+void Parser_release_function_decl(Parser *p, FunctionDeclNode *node);
+struct Sema *Parser_sema(Parser *p);
+typedef struct Sema Sema;
+Sema *Sema_new(void);
+Scope *Sema_global_variable_scope(const Sema *s);
+Scope *Sema_global_struct_scope(const Sema *s);
+Scope *Sema_global_enum_scope(const Sema *s);
+Type *Sema_act_on_struct_type_reference(Sema *s, const Token *identifier);
+Type *
+Sema_act_on_struct_type_start_of_member_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_struct_type_end_of_member_list(
+    Sema *s, Type *struct_type, Vec_MemberDeclNode * member_decls);
+MemberDeclNode *Sema_act_on_struct_type_member_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+Type *Sema_act_on_enum_type_reference(Sema *s, const Token *identifier);
+void Sema_act_on_enum_type_start_of_list(Sema *s, const Token *identifier);
+Type *Sema_act_on_enum_type_end_of_list(
+    Sema *s, const Token *identifier, Vec_EnumeratorDeclNode * enumerators);
+EnumeratorDeclNode *
+Sema_act_on_enumerator(Sema *s, const Token *identifier, ExprNode *value);
+bool Sema_is_typedef_name(Sema *s, const Token *identifier);
+Type *Sema_act_on_typedef_name(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_identifier_expr(Sema *s, const Token *identifier);
+ExprNode *Sema_act_on_integer_expr(Sema *s, const Token *integer);
+ExprNode *Sema_act_on_character_expr(Sema *s, const Token *character);
+ExprNode *Sema_act_on_string_expr(Sema *s, const Token *string);
+ExprNode *Sema_act_on_subscript_expr(Sema *s, ExprNode *array, ExprNode *index);
+ExprNode *
+Sema_act_on_call_expr(Sema *s, ExprNode *callee, Vec_ExprNode * arguments);
+ExprNode *
+Sema_act_on_dot_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *
+Sema_act_on_arrow_expr(Sema *s, ExprNode *parent, const Token *identifier);
+ExprNode *Sema_act_on_sizeof_expr_type(Sema *s, Type *type);
+ExprNode *Sema_act_on_sizeof_expr_expr(Sema *s, ExprNode *expression);
+ExprNode *
+Sema_act_on_cast_expr(Sema *s, Type *destination_type, ExprNode *expression);
+ExprNode *
+Sema_act_on_unary_expr(Sema *s, const Token *operator, ExprNode *operand);
+ExprNode *Sema_act_on_binary_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+ExprNode *Sema_act_on_assign_expr(
+    Sema *s, ExprNode *lhs, const Token *operator, ExprNode *rhs);
+void Sema_act_on_compound_stmt_begin(Sema *s);
+StmtNode *Sema_act_on_compound_stmt_end(Sema *s, Vec_StmtNode * statements);
+StmtNode *Sema_act_on_if_stmt(
+    Sema *s, ExprNode *condition, StmtNode *if_true, StmtNode *if_false);
+StmtNode *Sema_act_on_while_stmt(Sema *s, ExprNode *condition, StmtNode *body);
+void Sema_act_on_for_stmt_start(Sema *s);
+StmtNode *Sema_act_on_for_stmt_end(
+    Sema *s,
+    StmtNode *initializer,
+    ExprNode *condition,
+    ExprNode *step,
+    StmtNode *body);
+StmtNode *Sema_act_on_return_stmt(Sema *s, ExprNode *return_value);
+StmtNode *Sema_act_on_decl_stmt(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+StmtNode *Sema_act_on_expr_stmt(Sema *s, ExprNode *expression);
+DeclaratorNode *Sema_act_on_abstract_direct_declarator(Sema *s);
+DeclaratorNode *Sema_act_on_direct_declarator(Sema *s, const Token *identifier);
+DeclaratorNode *Sema_act_on_array_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *array_size);
+void Sema_act_on_function_declarator_start_of_parameter_list(Sema *s);
+DeclaratorNode *Sema_act_on_function_declarator_end_of_parameter_list(
+    Sema *s,
+    DeclaratorNode *declarator,
+    Vec_DeclaratorNode * parameters,
+    bool is_var_arg);
+DeclaratorNode *
+Sema_act_on_pointer_declarator(Sema *s, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_declarator_completed(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclaratorNode *Sema_act_on_init_declarator(
+    Sema *s, DeclaratorNode *declarator, ExprNode *initializer);
+DeclSpecNode *
+Sema_act_on_decl_spec(Sema *s, StorageClass storage_class, Type *base_type);
+DeclaratorNode *Sema_act_on_parameter_decl(Sema *s, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_global_decl(
+    Sema *s, DeclSpecNode *decl_spec, Vec_DeclaratorNode * declarators);
+void Sema_act_on_function_decl_start_of_body(
+    Sema *s, DeclSpecNode *decl_spec, DeclaratorNode *declarator);
+DeclNode *Sema_act_on_function_decl_end_of_body(
+    Sema *s,
+    DeclSpecNode *decl_spec,
+    DeclaratorNode *declarator,
+    StmtNode *body);
+void Driver_preprocess(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    bool binary);
+void Driver_compile(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    int num_jobs,
+    bool object);
+int Driver_run(
+    Vec_String * include_paths,
+    const char *pch_path,
+    const char *input,
+    int num_jobs,
+    int argc,
+    char **argv);
+void Driver_compile_all(
+    Vec_String * include_paths,
+    const char *pch_path,
+    Vec_String * inputs,
+    const char *output_dir,
+    int num_jobs,
+    bool object);
+typedef enum TimeReportPhase {
+    TimeReportPhase_other,
+    TimeReportPhase_read,
+    TimeReportPhase_lex,
+    TimeReportPhase_preprocess,
+    TimeReportPhase_expand,
+    TimeReportPhase_parse,
+    TimeReportPhase_codegen,
+    TimeReportPhase_assemble,
+    TimeReportPhase_count,
+} TimeReportPhase;
+void TimeReport_enable(void);
+bool TimeReport_is_enabled(void);
+void TimeReport_begin(TimeReportPhase phase);
+void TimeReport_end(TimeReportPhase phase);
+void TimeReport_print(bool json);
+void TimeReport_allocate(size_t size);
+typedef struct StringPool StringPool;
+StringPool *StringPool_new(void);
+void StringPool_delete(StringPool *pool);
+size_t StringPool_add(StringPool *pool, const char *s, size_t len);
+size_t StringPool_len(const StringPool *pool);
+const char *StringPool_string(const StringPool *pool, size_t entry);
+size_t StringPool_length(const StringPool *pool, size_t entry);
+bool StringPool_has_nul(const StringPool *pool, size_t entry);
+void StringPool_merge_suffixes(StringPool *pool);
+size_t StringPool_root(const StringPool *pool, size_t entry, size_t *offset);
+typedef struct Emitter Emitter;
+Emitter *Emitter_new(FILE *fp);
+void Emitter_delete(Emitter *e);
+void Emitter_flush(Emitter *e);
+void Emitter_write(Emitter *e, const char *s);
+void Emitter_write_bytes(Emitter *e, const char *s, size_t len);
+void Emitter_write_char(Emitter *e, char c);
+void Emitter_write_size(Emitter *e, size_t x);
+void Emitter_write_int(Emitter *e, int x);
+void Emitter_write_signed_int(Emitter *e, int x);
+void Emitter_write_hex_byte(Emitter *e, int x);
+void Emitter_append(Emitter *e, const Emitter *other);
+const char *Emitter_data(const Emitter *e, size_t *len);
+typedef struct CodeGen CodeGen;
+CodeGen *CodeGen_new(FILE *fp);
+void CodeGen_delete(CodeGen *g);
+void CodeGen_gen_decl(CodeGen *g, DeclNode *p);
+void CodeGen_finish(CodeGen *g);
+const char *CodeGen_output(const CodeGen *g, size_t *len);
+void CodeGen_gen(TranslationUnitNode *p, FILE *fp);
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs);
+typedef struct AssemblerSymbol AssemblerSymbol;
+void Assembler_assemble(const char *text, size_t len, const char *path);
+int Assembler_run(const char *text, size_t len, int argc, char **argv);
+typedef struct PrecompiledHeader PrecompiledHeader;
+void PrecompiledHeader_emit(
+    Vec_String * include_paths, const char *header_path, const char *output);
+PrecompiledHeader *PrecompiledHeader_load(const char *path);
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp);
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s);
+void test_Vec(void);
+void test_Arena(void);
+void test_Intern(void);
+void test_HiddenSet(void);
+void test_Path(void);
+void test_File(void);
+void test_Binary(void);
+void test_Ast(void);
+void test_Scan(void);
+void test_Lexer(void);
+void test_SourceCache(void);
+void test_Preprocessor(void);
+void test_TokenStream(void);
+void test_Parser(void);
+void test_StringPool(void);
+void test_Emitter(void);
+void test_PrecompiledHeader(void);
+void bench_Scope(void);
+void bench_Preprocessor(void);
+void bench_Lexer(void);
+void check_Node_dump(
+    const char *test_name, const Node *p, const char *expected);
+struct AssemblerSymbol {
+    const char *name;
+    int section;
+    size_t value;
+    size_t size;
+    bool is_global;
+    size_t index;
+};
+typedef struct AssemblerOperand {
+    int kind;
+    int reg;
+    int size;
+    int index;
+    int value;
+    AssemblerSymbol *symbol;
+} AssemblerOperand;
+typedef struct Assembler {
+    BinaryWriter *sections[3];
+    int section;
+    Map_AssemblerSymbol * symbols;
+    Vec_AssemblerSymbol * symbol_list;
+    Vec_size_t * relocation_offsets;
+    Vec_AssemblerSymbol * relocation_symbols;
+    Vec_size_t * jump_offsets;
+    Vec_AssemblerSymbol * jump_symbols;
+    char *line;
+    size_t line_cap;
+    const char *p;
+    int line_number;
+    const char *register_names[48];
+    int register_numbers[48];
+    int register_sizes[48];
+    int num_registers;
+} Assembler;
+static void Assembler_add_register(
+    Assembler *a, const char *name, int number, int size) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    a->register_names[a->num_registers] = name;
+    a->register_numbers[a->num_registers] = number;
+    a->register_sizes[a->num_registers] = size;
+    a->num_registers = a->num_registers + 1;
+}
+static void Assembler_add_registers(
+    Assembler *a,
+    int number,
+    const char *qword,
+    const char *dword,
+    const char *byte) {
+    ((void)0);
+    Assembler_add_register(a, qword, number, 8);
+    Assembler_add_register(a, dword, number, 4);
+    Assembler_add_register(a, byte, number, 1);
+}
+static Assembler *Assembler_new(void) {
+    Assembler *a = malloc(sizeof(Assembler));
+    for (int i = 0; i < 3; i = i + 1) {
+        a->sections[i] = BinaryWriter_new();
+    }
+    a->section = 0;
+    a->symbols = Map_new_AssemblerSymbol();
+    a->symbol_list = Vec_new_AssemblerSymbol();
+    a->relocation_offsets = Vec_new_size_t();
+    a->relocation_symbols = Vec_new_AssemblerSymbol();
+    a->jump_offsets = Vec_new_size_t();
+    a->jump_symbols = Vec_new_AssemblerSymbol();
+    a->line_cap = 256;
+    a->line = malloc(sizeof(char) * a->line_cap);
+    a->p = a->line;
+    a->line_number = 0;
+    a->num_registers = 0;
+    Assembler_add_registers(a, 0, "rax", "eax", "al");
+    Assembler_add_registers(a, 7, "rdi", "edi", "dil");
+    Assembler_add_registers(a, 5, "rbp", "ebp", "bpl");
+    Assembler_add_registers(a, 4, "rsp", "esp", "spl");
+    Assembler_add_registers(a, 6, "rsi", "esi", "sil");
+    Assembler_add_registers(a, 2, "rdx", "edx", "dl");
+    Assembler_add_registers(a, 1, "rcx", "ecx", "cl");
+    Assembler_add_registers(a, 3, "rbx", "ebx", "bl");
+    Assembler_add_registers(a, 8, "r8", "r8d", "r8b");
+    Assembler_add_registers(a, 9, "r9", "r9d", "r9b");
+    Assembler_add_registers(a, 10, "r10", "r10d", "r10b");
+    Assembler_add_registers(a, 11, "r11", "r11d", "r11b");
+    Assembler_add_registers(a, 12, "r12", "r12d", "r12b");
+    Assembler_add_registers(a, 13, "r13", "r13d", "r13b");
+    Assembler_add_registers(a, 14, "r14", "r14d", "r14b");
+    Assembler_add_registers(a, 15, "r15", "r15d", "r15b");
+    return a;
+}
+static void Assembler_delete(Assembler *a) {
+    ((void)0);
+    for (int i = 0; i < 3; i = i + 1) {
+        BinaryWriter_delete(a->sections[i]);
+    }
+    for (size_t i = 0; i < Vec_len_AssemblerSymbol(a->symbol_list);
+         i = i + 1) {
+        free(Vec_get_AssemblerSymbol(a->symbol_list, i));
+    }
+    Vec_delete_AssemblerSymbol(a->symbol_list);
+    Vec_delete_size_t(a->relocation_offsets);
+    Vec_delete_AssemblerSymbol(a->relocation_symbols);
+    Vec_delete_size_t(a->jump_offsets);
+    Vec_delete_AssemblerSymbol(a->jump_symbols);
+    free(a->line);
+    free(a);
+}
+static void Assembler_error(Assembler *a, const char *message) {
+    ((void)0);
+    ((void)0);
+    (exit(1));
+}
+static AssemblerSymbol *Assembler_symbol(Assembler *a, const char *name) {
+    ((void)0);
+    ((void)0);
+    AssemblerSymbol *symbol = Map_find_AssemblerSymbol(a->symbols, name);
+    if (!symbol) {
+        symbol = malloc(sizeof(AssemblerSymbol));
+        symbol->name = name;
+        symbol->section = 3;
+        symbol->value = 0;
+        symbol->size = 0;
+        symbol->is_global = 0;
+        symbol->index = 0;
+        Map_insert_AssemblerSymbol(a->symbols, name, symbol);
+        Vec_push_AssemblerSymbol(a->symbol_list, symbol);
+    }
+    return symbol;
+}
+static void Assembler_define(
+    Assembler *a, AssemblerSymbol *symbol, int section, size_t value) {
+    ((void)0);
+    ((void)0);
+    if (symbol->section != 3) {
+        Assembler_error(a, "symbol is already defined");
+    }
+    symbol->section = section;
+    symbol->value = value;
+}
+static BinaryWriter *Assembler_text(Assembler *a) {
+    ((void)0);
+    return a->sections[0];
+}
+static void Assembler_byte(Assembler *a, int byte) {
+    ((void)0);
+    BinaryWriter_write_byte(a->sections[a->section], byte);
+}
+static bool Assembler_is_name(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '$';
+}
+static void Assembler_skip_spaces(Assembler *a) {
+    ((void)0);
+    while (a->p[0] == ' ') {
+        a->p = &a->p[1];
+    }
+}
+static bool Assembler_consume(Assembler *a, char c) {
+    ((void)0);
+    Assembler_skip_spaces(a);
+    if (a->p[0] != c) {
+        return 0;
+    }
+    a->p = &a->p[1];
+    return 1;
+}
+static void Assembler_expect(Assembler *a, char c) {
+    ((void)0);
+    if (!Assembler_consume(a, c)) {
+        Assembler_error(a, "unexpected character");
+    }
+}
+static void Assembler_expect_end(Assembler *a) {
+    ((void)0);
+    Assembler_skip_spaces(a);
+    if (a->p[0] != '\0') {
+        Assembler_error(a, "extra characters");
+    }
+}
+static size_t Assembler_peek_name(Assembler *a) {
+    ((void)0);
+    Assembler_skip_spaces(a);
+    size_t len = 0;
+    while (Assembler_is_name(a->p[len])) {
+        len = len + 1;
+    }
+    return len;
+}
+static const char *Assembler_name(Assembler *a) {
+    ((void)0);
+    size_t len = Assembler_peek_name(a);
+    if (len == 0) {
+        Assembler_error(a, "name expected");
+    }
+    const char *name = Intern_substring(a->p, len);
+    a->p = &a->p[len];
+    return name;
+}
+static int Assembler_number(Assembler *a) {
+    ((void)0);
+    Assembler_skip_spaces(a);
+    bool negative = a->p[0] == '-';
+    if (negative) {
+        a->p = &a->p[1];
+    }
+    if (!(a->p[0] >= '0' && a->p[0] <= '9')) {
+        Assembler_error(a, "number expected");
+    }
+    int x = 0;
+    while (a->p[0] >= '0' && a->p[0] <= '9') {
+        x = x * 10 - (a->p[0] - '0');
+        a->p = &a->p[1];
+    }
+    if (negative) {
+        return x;
+    }
+    return -x;
+}
+static bool Assembler_word_is(Assembler *a, size_t len, const char *word) {
+    ((void)0);
+    ((void)0);
+    return strlen(word) == len && strncmp(a->p, word, len) == 0;
+}
+static int Assembler_find_register(Assembler *a, size_t len) {
+    ((void)0);
+    for (int i = 0; i < a->num_registers; i = i + 1) {
+        if (Assembler_word_is(a, len, a->register_names[i])) {
+            return i;
+        }
+    }
+    return 48;
+}
+static int Assembler_register(Assembler *a, int size) {
+    ((void)0);
+    size_t len = Assembler_peek_name(a);
+    int i = Assembler_find_register(a, len);
+    if (i == 48 || a->register_sizes[i] != size) {
+        Assembler_error(a, "register expected");
+    }
+    a->p = &a->p[len];
+    return a->register_numbers[i];
+}
+static void Assembler_memory(Assembler *a, AssemblerOperand *operand) {
+    ((void)0);
+    ((void)0);
+    operand->kind = 1;
+    operand->reg = Assembler_register(a, 8);
+    operand->index = 16;
+    operand->value = 0;
+    Assembler_skip_spaces(a);
+    if (a->p[0] == '-') {
+        operand->value = Assembler_number(a);
+    } else if (Assembler_consume(a, '+')) {
+        Assembler_skip_spaces(a);
+        if (a->p[0] >= '0' && a->p[0] <= '9') {
+            operand->value = Assembler_number(a);
+        } else {
+            operand->index = Assembler_register(a, 8);
+        }
+    }
+    Assembler_expect(a, ']');
+}
+static void Assembler_operand(Assembler *a, AssemblerOperand *operand) {
+    ((void)0);
+    ((void)0);
+    operand->reg = 16;
+    operand->size = 0;
+    operand->index = 16;
+    operand->value = 0;
+    operand->symbol = ((void *)0);
+    Assembler_skip_spaces(a);
+    if (Assembler_consume(a, '[')) {
+        Assembler_memory(a, operand);
+        return;
+    }
+    if (a->p[0] == '-' || (a->p[0] >= '0' && a->p[0] <= '9')) {
+        operand->kind = 2;
+        operand->value = Assembler_number(a);
+        return;
+    }
+    size_t len = Assembler_peek_name(a);
+    int i = Assembler_find_register(a, len);
+    if (i != 48) {
+        operand->kind = 0;
+        operand->reg = a->register_numbers[i];
+        operand->size = a->register_sizes[i];
+        a->p = &a->p[len];
+        return;
+    }
+    operand->kind = 3;
+    operand->symbol = Assembler_symbol(a, Assembler_name(a));
+    if (Assembler_consume(a, '@')) {
+        if (!Assembler_word_is(a, Assembler_peek_name(a), "GOTPCREL")) {
+            Assembler_error(a, "unknown relocation");
+        }
+        a->p = &a->p[8];
+        Assembler_expect(a, '[');
+        if (!Assembler_word_is(a, Assembler_peek_name(a), "rip")) {
+            Assembler_error(a, "rip expected");
+        }
+        a->p = &a->p[3];
+        Assembler_expect(a, ']');
+        operand->kind = 4;
+    }
+}
+static void Assembler_int(Assembler *a, int x) {
+    ((void)0);
+    BinaryWriter_write_int(a->sections[a->section], x);
+}
+static bool Assembler_is_int8(int x) {
+    if ((x & (-2147483647 - 1)) != 0) {
+        int magnitude = -(x + 1);
+        return magnitude <= 127;
+    }
+    return x <= 127;
+}
+static bool Assembler_needs_rex(const AssemblerOperand *operand) {
+    ((void)0);
+    return operand->kind == 0 && operand->size == 1 &&
+           operand->reg >= 4 && operand->reg <= 7;
+}
+static int Assembler_low(int reg) {
+    return reg % 8;
+}
+static int Assembler_high(int reg) {
+    if (reg >= 8) {
+        return 1;
+    }
+    return 0;
+}
+static void Assembler_modrm(
+    Assembler *a,
+    bool rex_w,
+    int opcode,
+    const AssemblerOperand *reg,
+    int extension,
+    const AssemblerOperand *rm) {
+    ((void)0);
+    ((void)0);
+    int reg_field = extension;
+    bool rex = rex_w || Assembler_needs_rex(rm);
+    if (reg) {
+        reg_field = reg->reg;
+        rex = rex || Assembler_needs_rex(reg);
+    }
+    int x = 0;
+    if (rm->kind == 1 && rm->index != 16) {
+        x = Assembler_high(rm->index);
+    }
+    int b = 0;
+    if (rm->kind == 0 || rm->kind == 1) {
+        b = Assembler_high(rm->reg);
+    }
+    int r = Assembler_high(reg_field);
+    if (rex || r + x + b > 0) {
+        int w = 0;
+        if (rex_w) {
+            w = 1;
+        }
+        Assembler_byte(a, 64 + w * 8 + r * 4 + x * 2 + b);
+    }
+    if (opcode >= 3840) {
+        Assembler_byte(a, 15);
+        opcode = opcode - 3840;
+    }
+    Assembler_byte(a, opcode);
+    int reg_bits = Assembler_low(reg_field) * 8;
+    if (rm->kind == 0) {
+        Assembler_byte(a, 192 + reg_bits + Assembler_low(rm->reg));
+        return;
+    }
+    if (rm->kind == 4) {
+        Assembler_byte(a, reg_bits + 5);
+        Vec_push_size_t(
+            a->relocation_offsets, BinaryWriter_len(Assembler_text(a)));
+        Vec_push_AssemblerSymbol(a->relocation_symbols, rm->symbol);
+        Assembler_int(a, 0);
+        return;
+    }
+    if (rm->kind != 1) {
+        Assembler_error(a, "invalid operand");
+    }
+    int mod = 2;
+    if (rm->value == 0 && Assembler_low(rm->reg) != 5) {
+        mod = 0;
+    } else if (Assembler_is_int8(rm->value)) {
+        mod = 1;
+    }
+    if (rm->index != 16 || Assembler_low(rm->reg) == 4) {
+        int index = 4;
+        if (rm->index != 16) {
+            index = Assembler_low(rm->index);
+        }
+        Assembler_byte(a, mod * 64 + reg_bits + 4);
+        Assembler_byte(a, index * 8 + Assembler_low(rm->reg));
+    } else {
+        Assembler_byte(a, mod * 64 + reg_bits + Assembler_low(rm->reg));
+    }
+    if (mod == 1) {
+        Assembler_byte(a, rm->value & 255);
+    } else if (mod == 2) {
+        Assembler_int(a, rm->value);
+    }
+}
+static void Assembler_opcode_register(
+    Assembler *a, int opcode, const AssemblerOperand *operand) {
+    ((void)0);
+    ((void)0);
+    if (operand->kind != 0 || operand->size != 8) {
+        Assembler_error(a, "64-bit register expected");
+    }
+    if (operand->reg >= 8) {
+        Assembler_byte(a, 65);
+    }
+    Assembler_byte(a, opcode + Assembler_low(operand->reg));
+}
+static void Assembler_immediate(
+    Assembler *a,
+    int opcode8,
+    int opcode32,
+    int extension,
+    const AssemblerOperand *dst,
+    const AssemblerOperand *src) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    bool rex_w = dst->size == 8;
+    if (Assembler_is_int8(src->value)) {
+        Assembler_modrm(a, rex_w, opcode8, ((void *)0), extension, dst);
+        Assembler_byte(a, src->value & 255);
+    } else {
+        Assembler_modrm(a, rex_w, opcode32, ((void *)0), extension, dst);
+        Assembler_int(a, src->value);
+    }
+}
+static int Assembler_condition(Assembler *a, const char *suffix) {
+    ((void)0);
+    ((void)0);
+    if (strcmp(suffix, "e") == 0) {
+        return 4;
+    } else if (strcmp(suffix, "ne") == 0) {
+        return 5;
+    } else if (strcmp(suffix, "l") == 0) {
+        return 12;
+    } else if (strcmp(suffix, "ge") == 0) {
+        return 13;
+    } else if (strcmp(suffix, "le") == 0) {
+        return 14;
+    } else if (strcmp(suffix, "g") == 0) {
+        return 15;
+    }
+    Assembler_error(a, "unknown condition");
+    return 0;
+}
+static void
+Assembler_jump(Assembler *a, int opcode, const AssemblerOperand *target) {
+    ((void)0);
+    ((void)0);
+    if (target->kind != 3) {
+        Assembler_error(a, "label expected");
+    }
+    if (opcode >= 3840) {
+        Assembler_byte(a, 15);
+        opcode = opcode - 3840;
+    }
+    Assembler_byte(a, opcode);
+    Vec_push_size_t(a->jump_offsets, BinaryWriter_len(Assembler_text(a)));
+    Vec_push_AssemblerSymbol(a->jump_symbols, target->symbol);
+    Assembler_int(a, 0);
+}
+static bool
+Assembler_alu(const char *mnemonic, int *opcode, int *extension) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    if (strcmp(mnemonic, "add") == 0) {
+        *opcode = 1;
+        *extension = 0;
+    } else if (strcmp(mnemonic, "and") == 0) {
+        *opcode = 33;
+        *extension = 4;
+    } else if (strcmp(mnemonic, "sub") == 0) {
+        *opcode = 41;
+        *extension = 5;
+    } else if (strcmp(mnemonic, "cmp") == 0) {
+        *opcode = 57;
+        *extension = 7;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+static void Assembler_mov(
+    Assembler *a, const AssemblerOperand *dst, const AssemblerOperand *src) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    if (src->kind == 0) {
+        int opcode = 137;
+        if (src->size == 1) {
+            opcode = 136;
+        }
+        Assembler_modrm(a, src->size == 8, opcode, src, 0, dst);
+    } else if (
+        src->kind == 1 || src->kind == 4) {
+        int opcode = 139;
+        if (dst->size == 1) {
+            opcode = 138;
+        }
+        Assembler_modrm(a, dst->size == 8, opcode, dst, 0, src);
+    } else if (src->kind == 2) {
+        Assembler_modrm(a, dst->size == 8, 199, ((void *)0), 0, dst);
+        Assembler_int(a, src->value);
+    } else {
+        Assembler_error(a, "invalid operands");
+    }
+}
+static void Assembler_instruction(Assembler *a, const char *mnemonic) {
+    ((void)0);
+    ((void)0);
+    AssemblerOperand operands[2];
+    int num_operands = 0;
+    Assembler_skip_spaces(a);
+    if (a->p[0] != '\0') {
+        Assembler_operand(a, &operands[0]);
+        num_operands = 1;
+        if (Assembler_consume(a, ',')) {
+            Assembler_operand(a, &operands[1]);
+            num_operands = 2;
+        }
+    }
+    Assembler_expect_end(a);
+    AssemblerOperand *dst = &operands[0];
+    AssemblerOperand *src = &operands[1];
+    int opcode = 0;
+    int extension = 0;
+    bool is_alu = Assembler_alu(mnemonic, &opcode, &extension);
+    if (num_operands == 0) {
+        if (strcmp(mnemonic, "ret") == 0) {
+            Assembler_byte(a, 195);
+        } else if (strcmp(mnemonic, "cqo") == 0) {
+            Assembler_byte(a, 72);
+            Assembler_byte(a, 153);
+        } else {
+            Assembler_error(a, "unknown instruction");
+        }
+    } else if (num_operands == 1) {
+        if (strcmp(mnemonic, "push") == 0 &&
+            dst->kind == 2) {
+            if (Assembler_is_int8(dst->value)) {
+                Assembler_byte(a, 106);
+                Assembler_byte(a, dst->value & 255);
+            } else {
+                Assembler_byte(a, 104);
+                Assembler_int(a, dst->value);
+            }
+        } else if (strcmp(mnemonic, "push") == 0) {
+            Assembler_opcode_register(a, 80, dst);
+        } else if (strcmp(mnemonic, "pop") == 0) {
+            Assembler_opcode_register(a, 88, dst);
+        } else if (strcmp(mnemonic, "jmp") == 0) {
+            Assembler_jump(a, 233, dst);
+        } else if (mnemonic[0] == 'j') {
+            Assembler_jump(
+                a,
+                3840 + 128 + Assembler_condition(a, &mnemonic[1]),
+                dst);
+        } else if (strncmp(mnemonic, "set", 3) == 0) {
+            Assembler_modrm(
+                a,
+                0,
+                3840 + 144 + Assembler_condition(a, &mnemonic[3]),
+                ((void *)0),
+                0,
+                dst);
+        } else if (strcmp(mnemonic, "neg") == 0) {
+            Assembler_modrm(a, dst->size == 8, 247, ((void *)0), 3, dst);
+        } else if (strcmp(mnemonic, "idiv") == 0) {
+            Assembler_modrm(a, dst->size == 8, 247, ((void *)0), 7, dst);
+        } else if (strcmp(mnemonic, "call") == 0) {
+            Assembler_modrm(a, 0, 255, ((void *)0), 2, dst);
+        } else {
+            Assembler_error(a, "unknown instruction");
+        }
+    } else if (dst->kind != 0 &&
+               dst->kind != 1) {
+        Assembler_error(a, "invalid destination");
+    } else if (strcmp(mnemonic, "mov") == 0) {
+        Assembler_mov(a, dst, src);
+    } else if (is_alu && src->kind == 2) {
+        Assembler_immediate(a, 131, 129, extension, dst, src);
+    } else if (is_alu) {
+        Assembler_modrm(a, src->size == 8, opcode, src, 0, dst);
+    } else if (strcmp(mnemonic, "lea") == 0) {
+        Assembler_modrm(a, dst->size == 8, 141, dst, 0, src);
+    } else if (
+        strcmp(mnemonic, "imul") == 0 && src->kind == 2) {
+        if (Assembler_is_int8(src->value)) {
+            Assembler_modrm(a, dst->size == 8, 107, dst, 0, dst);
+            Assembler_byte(a, src->value & 255);
+        } else {
+            Assembler_modrm(a, dst->size == 8, 105, dst, 0, dst);
+            Assembler_int(a, src->value);
+        }
+    } else if (strcmp(mnemonic, "imul") == 0) {
+        Assembler_modrm(
+            a, dst->size == 8, 3840 + 175, dst, 0, src);
+    } else if (strcmp(mnemonic, "movsx") == 0) {
+        Assembler_modrm(
+            a, dst->size == 8, 3840 + 190, dst, 0, src);
+    } else {
+        Assembler_error(a, "unknown instruction");
+    }
+}
+static void Assembler_string(Assembler *a) {
+    ((void)0);
+    Assembler_expect(a, '"');
+    while (a->p[0] != '"') {
+        int c = a->p[0];
+        if (c == '\0') {
+            Assembler_error(a, "unterminated string");
+        } else if (c != '\\') {
+            a->p = &a->p[1];
+        } else if (a->p[1] == '"' || a->p[1] == '\\') {
+            c = a->p[1];
+            a->p = &a->p[2];
+        } else {
+            a->p = &a->p[1];
+            c = 0;
+            for (int i = 0; i < 3; i = i + 1) {
+                if (!(a->p[0] >= '0' && a->p[0] <= '7')) {
+                    Assembler_error(a, "invalid escape");
+                }
+                c = c * 8 + (a->p[0] - '0');
+                a->p = &a->p[1];
+            }
+        }
+        Assembler_byte(a, c);
+    }
+    a->p = &a->p[1];
+    Assembler_expect_end(a);
+}
+static void Assembler_section(Assembler *a) {
+    ((void)0);
+    const char *name = Assembler_name(a);
+    if (strcmp(name, ".rodata.str1.1") == 0) {
+        a->section = 1;
+    } else if (strcmp(name, ".rodata") == 0) {
+        a->section = 2;
+    } else if (strcmp(name, ".text") == 0) {
+        a->section = 0;
+    } else {
+        Assembler_error(a, "unknown section");
+    }
+    a->p = "";
+}
+static void Assembler_directive(Assembler *a, const char *directive) {
+    ((void)0);
+    ((void)0);
+    if (strcmp(directive, ".string") == 0) {
+        Assembler_string(a);
+        Assembler_byte(a, 0);
+    } else if (strcmp(directive, ".ascii") == 0) {
+        Assembler_string(a);
+    } else if (strcmp(directive, ".byte") == 0) {
+        Assembler_byte(a, Assembler_number(a) & 255);
+        Assembler_expect_end(a);
+    } else if (strcmp(directive, ".set") == 0) {
+        AssemblerSymbol *symbol = Assembler_symbol(a, Assembler_name(a));
+        Assembler_expect(a, ',');
+        AssemblerSymbol *target = Assembler_symbol(a, Assembler_name(a));
+        if (target->section >= 3) {
+            Assembler_error(a, "symbol is not defined yet");
+        }
+        int offset = 0;
+        if (Assembler_consume(a, '+')) {
+            offset = Assembler_number(a);
+        }
+        Assembler_expect_end(a);
+        Assembler_define(a, symbol, target->section, target->value + offset);
+    } else if (strcmp(directive, ".global") == 0) {
+        Assembler_symbol(a, Assembler_name(a))->is_global = 1;
+        Assembler_expect_end(a);
+    } else if (strcmp(directive, ".comm") == 0) {
+        AssemblerSymbol *symbol = Assembler_symbol(a, Assembler_name(a));
+        Assembler_expect(a, ',');
+        size_t size = Assembler_number(a);
+        Assembler_expect(a, ',');
+        size_t align = Assembler_number(a);
+        Assembler_expect_end(a);
+        Assembler_define(a, symbol, 4, align);
+        symbol->size = size;
+        symbol->is_global = 1;
+    } else if (strcmp(directive, ".section") == 0) {
+        Assembler_section(a);
+    } else if (strcmp(directive, ".text") == 0) {
+        a->section = 0;
+    } else if (
+        strcmp(directive, ".intel_syntax") == 0 ||
+        strncmp(directive, ".cfi_", 5) == 0) {
+        a->p = "";
+    } else {
+        Assembler_error(a, "unknown directive");
+    }
+}
+static void Assembler_line(Assembler *a) {
+    ((void)0);
+    Assembler_skip_spaces(a);
+    if (a->p[0] == '\0') {
+        return;
+    }
+    const char *name = Assembler_name(a);
+    if (Assembler_consume(a, ':')) {
+        Assembler_define(
+            a,
+            Assembler_symbol(a, name),
+            a->section,
+            BinaryWriter_len(a->sections[a->section]));
+        Assembler_expect_end(a);
+    } else if (name[0] == '.') {
+        Assembler_directive(a, name);
+    } else if (a->section != 0) {
+        Assembler_error(a, "instruction outside .text");
+    } else {
+        Assembler_instruction(a, name);
+    }
+}
+static void Assembler_patch_jumps(Assembler *a) {
+    ((void)0);
+    for (size_t i = 0; i < Vec_len_size_t(a->jump_offsets); i = i + 1) {
+        size_t offset = Vec_get_size_t(a->jump_offsets, i);
+        AssemblerSymbol *symbol = Vec_get_AssemblerSymbol(a->jump_symbols, i);
+        if (symbol->section != 0) {
+            (exit(1));
+        }
+        BinaryWriter_patch_int(
+            Assembler_text(a), offset, symbol->value - (offset + 4));
+    }
+}
+static void Assembler_write_half(BinaryWriter *w, int x) {
+    ((void)0);
+    BinaryWriter_write_byte(w, x % 256);
+    BinaryWriter_write_byte(w, x / 256);
+}
+static void Assembler_write_xword(BinaryWriter *w, int x) {
+    ((void)0);
+    BinaryWriter_write_int(w, x);
+    if ((x & (-2147483647 - 1)) != 0) {
+        BinaryWriter_write_int(w, -1);
+    } else {
+        BinaryWriter_write_int(w, 0);
+    }
+}
+static void Assembler_align(BinaryWriter *w, size_t align) {
+    ((void)0);
+    while (BinaryWriter_len(w) % align != 0) {
+        BinaryWriter_write_byte(w, 0);
+    }
+}
+static size_t Assembler_add_name(BinaryWriter *w, const char *name) {
+    ((void)0);
+    ((void)0);
+    size_t offset = BinaryWriter_len(w);
+    BinaryWriter_write_bytes(w, name, strlen(name));
+    BinaryWriter_write_byte(w, 0);
+    return offset;
+}
+static bool Assembler_is_local_label(const AssemblerSymbol *symbol) {
+    ((void)0);
+    return symbol->name[0] == '.' && symbol->name[1] == 'L';
+}
+static int Assembler_shndx(const AssemblerSymbol *symbol) {
+    ((void)0);
+    if (symbol->section == 0) {
+        return 1;
+    } else if (symbol->section == 1) {
+        return 3;
+    } else if (symbol->section == 2) {
+        return 4;
+    } else if (symbol->section == 4) {
+        return 65522;
+    }
+    return 0;
+}
+static void Assembler_write_symbol(
+    BinaryWriter *symtab, BinaryWriter *strtab, AssemblerSymbol *symbol) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    int bind = 0;
+    if (symbol->is_global || symbol->section == 3) {
+        bind = 1;
+    }
+    int type = 0;
+    if (symbol->section == 4) {
+        type = 1;
+    }
+    symbol->index = BinaryWriter_len(symtab) / 24;
+    BinaryWriter_write_int(symtab, Assembler_add_name(strtab, symbol->name));
+    BinaryWriter_write_byte(symtab, bind * 16 + type);
+    BinaryWriter_write_byte(symtab, 0);
+    Assembler_write_half(symtab, Assembler_shndx(symbol));
+    Assembler_write_xword(symtab, symbol->value);
+    Assembler_write_xword(symtab, symbol->size);
+}
+static size_t Assembler_write_symbols(
+    Assembler *a, BinaryWriter *symtab, BinaryWriter *strtab) {
+    ((void)0);
+    ((void)0);
+    ((void)0);
+    size_t len = Vec_len_AssemblerSymbol(a->symbol_list);
+    for (int i = 0; i < 24; i = i + 1) {
+        BinaryWriter_write_byte(symtab, 0);
+    }
+    BinaryWriter_write_byte(strtab, 0);
+    for (size_t i = 0; i < len; i = i + 1) {
+        AssemblerSymbol *symbol = Vec_get_AssemblerSymbol(a->symbol_list, i);
+        if (!symbol->is_global && symbol->section != 3 &&
+            !Assembler_is_local_label(symbol)) {
+            Assembler_write_symbol(symtab, strtab, symbol);
+        }
+    }
+    size_t first_global = BinaryWriter_len(symtab) / 24;
+    for (size_t i = 0; i < len; i = i + 1) {
+        AssemblerSymbol *symbol = Vec_get_AssemblerSymbol(a->symbol_list, i);
+        if (symbol->is_global || symbol->section == 3) {
+            Assembler_write_symbol(symtab, strtab, symbol);
+        }
+    }
+    return first_global;
+}
+static void Assembler_write_relocations(Assembler *a, BinaryWriter *rela) {
+    ((void)0);
+    ((void)0);
+    for (size_t i = 0; i < Vec_len_size_t(a->relocation_offsets); i = i + 1) {
+        AssemblerSymbol *symbol =
+            Vec_get_AssemblerSymbol(a->relocation_symbols, i);
+        if (Assembler_is_local_label(symbol)) {
+            (exit(1));
+        }
+        Assembler_write_xword(
+            rela, Vec_get_size_t(a->relocation_offsets, i));
+        BinaryWriter_write_int(rela, 42);
+        BinaryWriter_write_int(rela, symbol->index);
+        Assembler_write_xword(rela, -4);
+    }
+}
+typedef struct AssemblerSectionHeader {
+    int name;
+    int type;
+    int flags;
+    size_t offset;
+    size_t size;
+    int link;
+    int info;
+    int align;
+    int entsize;
+} AssemblerSectionHeader;
+static void Assembler_section_header(
+    AssemblerSectionHeader *h,
+    int name,
+    int type,
+    int flags,
+    size_t offset,
+    const BinaryWriter *part) {
+    ((void)0);
+    h->name = name;
+    h->type = type;
+    h->flags = flags;
+    h->offset = offset;
+    h->size = 0;
+    h->link = 0;
+    h->info = 0;
+    h->align = 1;
+    h->entsize = 0;
+    if (part) {
+        h->size = BinaryWriter_len(part);
+    }
+}
+static void Assembler_write_section_header(
+    BinaryWriter *w, const AssemblerSectionHeader *h) {
+    ((void)0);
+    ((void)0);
+    BinaryWriter_write_int(w, h->name);
+    BinaryWriter_write_int(w, h->type);
+    Assembler_write_xword(w, h->flags);
+    Assembler_write_xword(w, 0);
+    Assembler_write_xword(w, h->offset);
+    Assembler_write_xword(w, h->size);
+    BinaryWriter_write_int(w, h->link);
+    BinaryWriter_write_int(w, h->info);
+    Assembler_write_xword(w, h->align);
+    Assembler_write_xword(w, h->entsize);
+}
+static void Assembler_write_elf_header(BinaryWriter *w, size_t shoff) {
+    ((void)0);
+    BinaryWriter_write_byte(w, 127);
+    BinaryWriter_write_bytes(w, "ELF", 3);
+    BinaryWriter_write_byte(w, 2);
+    BinaryWriter_write_byte(w, 1);
+    BinaryWriter_write_byte(w, 1);
+    for (int i = 7; i < 16; i = i + 1) {
+        BinaryWriter_write_byte(w, 0);
+    }
+    Assembler_write_half(w, 1);
+    Assembler_write_half(w, 62);
+    BinaryWriter_write_int(w, 1);
+    Assembler_write_xword(w, 0);
+    Assembler_write_xword(w, 0);
+    Assembler_write_xword(w, shoff);
+    BinaryWriter_write_int(w, 0);
+    Assembler_write_half(w, 64);
+    Assembler_write_half(w, 0);
+    Assembler_write_half(w, 0);
+    Assembler_write_half(w, 64);
+    Assembler_write_half(w, 9);
+    Assembler_write_half(w, 8);
+}
+static void Assembler_write_object(Assembler *a, const char *path) {
+    ((void)0);
+    ((void)0);
+    BinaryWriter *symtab = BinaryWriter_new();
+    BinaryWriter *strtab = BinaryWriter_new();
+    BinaryWriter *rela = BinaryWriter_new();
+    BinaryWriter *shstrtab = BinaryWriter_new();
+    size_t first_global = Assembler_write_symbols(a, symtab, strtab);
+    Assembler_write_relocations(a, rela);
+    BinaryWriter_write_byte(shstrtab, 0);
+    int text_name = Assembler_add_name(shstrtab, ".text");
+    int rela_name = Assembler_add_name(shstrtab, ".rela.text");
+    int strings_name = Assembler_add_name(shstrtab, ".rodata.str1.1");
+    int rodata_name = Assembler_add_name(shstrtab, ".rodata");
+    int note_name = Assembler_add_name(shstrtab, ".note.GNU-stack");
+    int symtab_name = Assembler_add_name(shstrtab, ".symtab");
+    int strtab_name = Assembler_add_name(shstrtab, ".strtab");
+    int shstrtab_name = Assembler_add_name(shstrtab, ".shstrtab");
+    BinaryWriter *w = BinaryWriter_new();
+    BinaryWriter *parts[7];
+    size_t offsets[7];
+    parts[0] = Assembler_text(a);
+    parts[1] = a->sections[1];
+    parts[2] = a->sections[2];
+    parts[3] = rela;
+    parts[4] = symtab;
+    parts[5] = strtab;
+    parts[6] = shstrtab;
+    size_t offset = 64;
+    for (int i = 0; i < 7; i = i + 1) {
+        if (i == 3 || i == 4) {
+            offset = (offset + 7) / 8 * 8;
+        }
+        offsets[i] = offset;
+        offset = offset + BinaryWriter_len(parts[i]);
+    }
+    size_t shoff = (offset + 7) / 8 * 8;
+    Assembler_write_elf_header(w, shoff);
+    for (int i = 0; i < 7; i = i + 1) {
+        while (BinaryWriter_len(w) < offsets[i]) {
+            BinaryWriter_write_byte(w, 0);
+        }
+        BinaryWriter_write_bytes(
+            w, BinaryWriter_data(parts[i]), BinaryWriter_len(parts[i]));
+    }
+    Assembler_align(w, 8);
+    AssemblerSectionHeader h;
+    Assembler_section_header(&h, 0, 0, 0, 0, ((void *)0));
+    h.align = 0;
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h,
+        text_name,
+        1,
+        2 + 4,
+        offsets[0],
+        parts[0]);
+    h.align = 16;
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, rela_name, 4, 64, offsets[3], rela);
+    h.link = 6;
+    h.info = 1;
+    h.align = 8;
+    h.entsize = 24;
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h,
+        strings_name,
+        1,
+        2 + 16 + 32,
+        offsets[1],
+        parts[1]);
+    h.entsize = 1;
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, rodata_name, 1, 2, offsets[2], parts[2]);
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, note_name, 1, 0, offsets[3], ((void *)0));
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, symtab_name, 2, 0, offsets[4], symtab);
+    h.link = 7;
+    h.info = first_global;
+    h.align = 8;
+    h.entsize = 24;
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, strtab_name, 3, 0, offsets[5], strtab);
+    Assembler_write_section_header(w, &h);
+    Assembler_section_header(
+        &h, shstrtab_name, 3, 0, offsets[6], shstrtab);
+    Assembler_write_section_header(w, &h);
+    if (!BinaryWriter_save(w, path)) {
+        (exit(1));
+    }
+    BinaryWriter_delete(symtab);
+    BinaryWriter_delete(strtab);
+    BinaryWriter_delete(rela);
+    BinaryWriter_delete(shstrtab);
+    BinaryWriter_delete(w);
+}
+static Assembler *Assembler_parse(const char *text, size_t len) {
+    ((void)0);
+    Assembler *a = Assembler_new();
+    size_t start = 0;
+    while (start < len) {
+        size_t end = start;
+        while (end < len && text[end] != '\n') {
+            end = end + 1;
+        }
+        if (end - start + 1 > a->line_cap) {
+            while (end - start + 1 > a->line_cap) {
+                a->line_cap = a->line_cap * 2;
+            }
+            a->line = realloc(a->line, sizeof(char) * a->line_cap);
+        }
+        memcpy(a->line, &text[start], end - start);
+        a->line[end - start] = '\0';
+        a->p = a->line;
+        a->line_number = a->line_number + 1;
+        Assembler_line(a);
+        start = end + 1;
+    }
+    Assembler_patch_jumps(a);
+    return a;
+}
+void Assembler_assemble(const char *text, size_t len, const char *path) {
+    ((void)0);
+    ((void)0);
+    Assembler *a = Assembler_parse(text, len);
+    Assembler_write_object(a, path);
+    Assembler_delete(a);
+}
+int Assembler_run(const char *text, size_t len, int argc, char **argv) {
+    ((void)0);
+    ((void)0);
+    (exit(1));
+    return 0;
+}
@@ -1,49 +1,163 @@
 #include "mocc.h"
 
 void display_usage(const char *program) {
-    printf("%s <INPUT> <OUTPUT>\n", program);
+    printf(
+        "%s [-c] [-j <JOBS>] [--include-pch <PCH>] <INPUT> <OUTPUT>\n",
+        program);
+    printf(
+        "%s --time-report[=json] [-c] [-j <JOBS>] <INPUT> <OUTPUT>\n",
+        program);
+    printf("%s -E [--binary] <INPUT> <OUTPUT>\n", program);
+    printf("%s --emit-pch <HEADER> <PCH>\n", program);
+    printf(
+        "%s [-j <JOBS>] [--include-pch <PCH>] --run <INPUT> [ARGS]...\n",
+        program);
+    printf(
+        "%s [-c] [-j <JOBS>] [--include-pch <PCH>] <INPUT>... -o <DIR>\n",
+        program);
 }
 
 int main(int argc, char **argv) {
 #ifndef MOCC
     if (argc == 2 && strcmp(argv[1], "--test") == 0) {
         test_Vec();
+        test_Arena();
+        test_Intern();
+        test_HiddenSet();
         test_Path();
         test_File();
+        test_Binary();
         test_Ast();
+        test_Scan();
         test_Lexer();
+        test_SourceCache();
         test_Preprocessor();
+        test_TokenStream();
         test_Parser();
+        test_StringPool();
+        test_Emitter();
+        test_PrecompiledHeader();
         exit(0);
     }
-#endif
 
-    if (argc != 3) {
-        display_usage(argv[0]);
-        exit(1);
+    if (argc == 2 && strcmp(argv[1], "--bench") == 0) {
+        bench_Scope();
+        bench_Preprocessor();
+        bench_Lexer();
+        exit(0);
     }
+#endif
 
     Vec(String) *include_paths = Vec_new(String)();
-    const char *input = argv[1];
-    const char *output = argv[2];
 
-    const char *text = File_read(input);
-    if (text == (const char *)NULL) {
-        ERROR("cannot open file %s\n", input);
+    int arg = 1;
+    bool emit_pch = false;
+    bool preprocess_only = false;
+    bool binary = false;
+    bool object = false;
+    const char *pch_path = NULL;
+    const char *output_dir = NULL;
+    int num_jobs = 1;
+    int run_arg = 0;
+    bool time_report = false;
+    bool time_report_json = false;
+    Vec(String) *files = Vec_new(String)();
+
+    while (arg < argc && run_arg == 0) {
+        if (argv[arg][0] != '-') {
+            Vec_push(String)(files, argv[arg]);
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "--emit-pch") == 0) {
+            emit_pch = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "-E") == 0) {
+            preprocess_only = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "-c") == 0) {
+            object = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "--binary") == 0) {
+            binary = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "--include-pch") == 0 && arg + 1 < argc) {
+            pch_path = argv[arg + 1];
+            arg = arg + 2;
+        } else if (strcmp(argv[arg], "-j") == 0 && arg + 1 < argc) {
+            num_jobs = atoi(argv[arg + 1]);
+            arg = arg + 2;
+        } else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc) {
+            output_dir = argv[arg + 1];
+            arg = arg + 2;
+        } else if (strcmp(argv[arg], "--time-report") == 0) {
+            time_report = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "--time-report=json") == 0) {
+            time_report = true;
+            time_report_json = true;
+            arg = arg + 1;
+        } else if (strcmp(argv[arg], "--run") == 0 && arg + 1 < argc) {
+            // The rest of the arguments belong to the program
+            run_arg = arg + 1;
+        } else {
+            display_usage(argv[0]);
+            exit(1);
+        }
+    }
+
+    if (run_arg != 0) {
+        if (Vec_len(String)(files) != 0 || output_dir || num_jobs < 1 ||
+            emit_pch || preprocess_only || binary || object || time_report) {
+            display_usage(argv[0]);
+            exit(1);
+        }
+
+        return Driver_run(
+            include_paths,
+            pch_path,
+            argv[run_arg],
+            num_jobs,
+            argc - run_arg,
+            &argv[run_arg]);
+    }
+
+    if (output_dir) {
+        if (Vec_len(String)(files) == 0 || num_jobs < 1 || emit_pch ||
+            preprocess_only || binary || time_report) {
+            display_usage(argv[0]);
+            exit(1);
+        }
+
+        Driver_compile_all(
+            include_paths, pch_path, files, output_dir, num_jobs, object);
+        return 0;
     }
 
-    FILE *fp = fopen(output, "w");
-    if (fp == (FILE *)NULL) {
-        ERROR("cannot open file %s\n", output);
+    if (Vec_len(String)(files) != 2 || (binary && !preprocess_only) ||
+        ((object || time_report) && (preprocess_only || emit_pch)) ||
+        num_jobs < 1) {
+        display_usage(argv[0]);
+        exit(1);
     }
 
-    Vec(Token) *tokens = Preprocessor_read(include_paths, input, text);
-    Parser *p = Parser_new(tokens);
+    const char *input = Vec_get(String)(files, 0);
+    const char *output = Vec_get(String)(files, 1);
 
-    TranslationUnitNode *node = Parser_parse(p);
-    CodeGen_gen(node, fp);
+    if (emit_pch) {
+        PrecompiledHeader_emit(include_paths, input, output);
+    } else if (preprocess_only) {
+        Driver_preprocess(include_paths, pch_path, input, output, binary);
+    } else {
+        if (time_report) {
+            TimeReport_enable();
+        }
 
-    fclose(fp);
+        Driver_compile(
+            include_paths, pch_path, input, output, num_jobs, object);
+
+        if (time_report) {
+            TimeReport_print(time_report_json);
+        }
+    }
 
     return 0;
 }
@@ -32,6 +32,7 @@ typedef int size_t;
 // <stdlib.h>
 void *malloc(size_t size);
 void *realloc(void *ptr, size_t size);
+void free(void *ptr);
 void exit(int);
 int atoi(const char *s);
 
@@ -44,6 +45,7 @@ void fclose(FILE *fp);
 int fseek(FILE *fp, long off, int origin);
 long ftell(FILE *fp);
 size_t fread(void *buf, size_t size, size_t n, FILE *fp);
+size_t fwrite(const void *buf, size_t size, size_t n, FILE *fp);
 int fprintf(FILE *fp, const char *fmt, ...);
 int printf(const char *fmt, ...);
 int snprintf(char *buf, size_t size, const char *fmt, ...);
@@ -52,10 +54,13 @@ int remove(const char *path);
 // <string.h>
 size_t strlen(const char *s);
 int strcmp(const char *s1, const char *s2);
+int strncmp(const char *s1, const char *s2, size_t n);
 char *strcpy(char *s1, const char *s2);
 char *strcat(char *s1, const char *s2);
 char *strdup(const char *s);
 char *strndup(const char *s, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+void *memcpy(void *s1, const void *s2, size_t n);
 #endif
 
 typedef int bool;
@@ -78,6 +83,13 @@ typedef int bool;
 #define TODO(s) (exit(1))
 #endif
 
+// A variable of which each worker thread has its own copy
+#ifndef MOCC
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL
+#endif
+
 // Vec
 #define Vec(T) Vec_##T
 #define Vec_Element(T) Vec_Element_##T
@@ -91,6 +103,7 @@ typedef int bool;
 #define Vec_pop(T) Vec_pop_##T
 #define Vec_reserve(T) Vec_reserve_##T
 #define Vec_resize(T) Vec_resize_##T
+#define Vec_delete(T) Vec_delete_##T
 
 #define VEC_DECL(T, X)                                                         \
     typedef struct Vec(T) Vec(T);                                              \
@@ -105,7 +118,8 @@ typedef int bool;
     void Vec_push(T)(Vec(T) * v, Vec_Element(T) x);                            \
     Vec_Element(T) Vec_pop(T)(Vec(T) * v);                                     \
     void Vec_reserve(T)(Vec(T) * v, size_t cap);                               \
-    void Vec_resize(T)(Vec(T) * v, size_t len);
+    void Vec_resize(T)(Vec(T) * v, size_t len);                                \
+    void Vec_delete(T)(Vec(T) * v);
 
 #define VEC_DEFINE(T)                                                          \
     struct Vec(T) {                                                            \
@@ -119,6 +133,7 @@ typedef int bool;
         v->len = 0;                                                            \
         v->cap = 8;                                                            \
         v->ptr = malloc(sizeof(Vec_Element(T)) * v->cap);                      \
+        TimeReport_allocate(sizeof(*v) + sizeof(Vec_Element(T)) * v->cap);     \
         return v;                                                              \
     }                                                                          \
                                                                                \
@@ -169,6 +184,7 @@ typedef int bool;
         if (cap > v->cap) {                                                    \
             v->cap = cap;                                                      \
             v->ptr = realloc(v->ptr, sizeof(Vec_Element(T)) * v->cap);         \
+            TimeReport_allocate(sizeof(Vec_Element(T)) * v->cap);              \
         }                                                                      \
     }                                                                          \
                                                                                \
@@ -176,27 +192,274 @@ typedef int bool;
         assert(v);                                                             \
         Vec_reserve(T)(v, len);                                                \
         v->len = len;                                                          \
+    }                                                                          \
+                                                                               \
+    void Vec_delete(T)(Vec(T) * v) {                                           \
+        assert(v);                                                             \
+        free(v->ptr);                                                          \
+        free(v);                                                               \
     }
 
 VEC_DECL(String, const char *)
 VEC_DECL(size_t, size_t)
 VEC_DECL(Token, struct Token *)
-VEC_DECL(Macro, struct Macro *)
 VEC_DECL(Type, struct Type *)
 VEC_DECL(Symbol, struct Symbol *)
+VEC_DECL(Macro, struct Macro *)
 VEC_DECL(ExprNode, struct ExprNode *)
 VEC_DECL(StmtNode, struct StmtNode *)
 VEC_DECL(DeclaratorNode, struct DeclaratorNode *)
 VEC_DECL(DeclNode, struct DeclNode *)
 VEC_DECL(MemberDeclNode, struct MemberDeclNode *)
 VEC_DECL(EnumeratorDeclNode, struct EnumeratorDeclNode *)
+VEC_DECL(AssemblerSymbol, struct AssemblerSymbol *)
+
+// Map
+//  Open-addressing hash map keyed by interned strings. Elements must be
+//  non-null pointers; Map_find() returns NULL for missing keys. A removed
+//  entry keeps its key with a NULL element as a tombstone.
+//  Entries are visited with Map_value_at(m, i) for i < Map_cap(m), which
+//  returns NULL for empty slots and tombstones.
+#define Map(T) Map_##T
+#define Map_Element(T) Map_Element_##T
+#define Map_new(T) Map_new_##T
+#define Map_len(T) Map_len_##T
+#define Map_find(T) Map_find_##T
+#define Map_insert(T) Map_insert_##T
+#define Map_remove(T) Map_remove_##T
+#define Map_cap(T) Map_cap_##T
+#define Map_value_at(T) Map_value_at_##T
+#define Map_grow(T) Map_grow_##T
+
+#define MAP_DECL(T, X)                                                         \
+    typedef struct Map(T) Map(T);                                              \
+    typedef X Map_Element(T);                                                  \
+                                                                               \
+    Map(T) * Map_new(T)(void);                                                 \
+    size_t Map_len(T)(const Map(T) * m);                                       \
+    Map_Element(T) Map_find(T)(const Map(T) * m, const char *key);             \
+    bool Map_insert(T)(Map(T) * m, const char *key, Map_Element(T) x);         \
+    bool Map_remove(T)(Map(T) * m, const char *key);                           \
+    size_t Map_cap(T)(const Map(T) * m);                                       \
+    Map_Element(T) Map_value_at(T)(const Map(T) * m, size_t i);
+
+#define MAP_DEFINE(T)                                                          \
+    struct Map(T) {                                                            \
+        size_t len;                                                            \
+        size_t used;                                                           \
+        size_t cap;                                                            \
+        const char **keys;                                                     \
+        Map_Element(T) * values;                                               \
+    };                                                                         \
+                                                                               \
+    Map(T) * Map_new(T)(void) {                                                \
+        Map(T) *m = malloc(sizeof(*m));                                        \
+        TimeReport_allocate(sizeof(*m));                                       \
+        m->len = 0;                                                            \
+        m->used = 0;                                                           \
+        m->cap = 0;                                                            \
+        m->keys = NULL;                                                        \
+        m->values = NULL;                                                      \
+        return m;                                                              \
+    }                                                                          \
+                                                                               \
+    size_t Map_len(T)(const Map(T) * m) {                                      \
+        assert(m);                                                             \
+        return m->len;                                                         \
+    }                                                                          \
+                                                                               \
+    Map_Element(T) Map_find(T)(const Map(T) * m, const char *key) {            \
+        assert(m);                                                             \
+        assert(key);                                                           \
+        if (m->len == 0) {                                                     \
+            return NULL;                                                       \
+        }                                                                      \
+        size_t i = Intern_hash(key) & (m->cap - 1);                            \
+        while (m->keys[i]) {                                                   \
+            if (m->keys[i] == key) {                                           \
+                return m->values[i];                                           \
+            }                                                                  \
+            i = (i + 1) & (m->cap - 1);                                        \
+        }                                                                      \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    static void Map_grow(T)(Map(T) * m) {                                      \
+        assert(m);                                                             \
+        size_t cap = 8;                                                        \
+        while (cap < (m->len + 1) * 4) {                                       \
+            cap = cap * 2;                                                     \
+        }                                                                      \
+        const char **keys = malloc(sizeof(const char *) * cap);                \
+        Map_Element(T) *values = malloc(sizeof(Map_Element(T)) * cap);         \
+        TimeReport_allocate(                                                   \
+            (sizeof(const char *) + sizeof(Map_Element(T))) * cap);            \
+        for (size_t i = 0; i < cap; i = i + 1) {                               \
+            keys[i] = NULL;                                                    \
+        }                                                                      \
+        for (size_t i = 0; i < m->cap; i = i + 1) {                            \
+            if (m->keys[i] && m->values[i]) {                                  \
+                size_t j = Intern_hash(m->keys[i]) & (cap - 1);                \
+                while (keys[j]) {                                              \
+                    j = (j + 1) & (cap - 1);                                   \
+                }                                                              \
+                keys[j] = m->keys[i];                                          \
+                values[j] = m->values[i];                                      \
+            }                                                                  \
+        }                                                                      \
+        free(m->keys);                                                         \
+        free(m->values);                                                       \
+        m->used = m->len;                                                      \
+        m->cap = cap;                                                          \
+        m->keys = keys;                                                        \
+        m->values = values;                                                    \
+    }                                                                          \
+                                                                               \
+    bool Map_insert(T)(Map(T) * m, const char *key, Map_Element(T) x) {        \
+        assert(m);                                                             \
+        assert(key);                                                           \
+        assert(x);                                                             \
+        if ((m->used + 1) * 2 > m->cap) {                                      \
+            Map_grow(T)(m);                                                    \
+        }                                                                      \
+        size_t i = Intern_hash(key) & (m->cap - 1);                            \
+        while (m->keys[i]) {                                                   \
+            if (m->keys[i] == key) {                                           \
+                if (m->values[i]) {                                            \
+                    return false;                                              \
+                }                                                              \
+                m->values[i] = x;                                              \
+                m->len = m->len + 1;                                           \
+                return true;                                                   \
+            }                                                                  \
+            i = (i + 1) & (m->cap - 1);                                        \
+        }                                                                      \
+        m->keys[i] = key;                                                      \
+        m->values[i] = x;                                                      \
+        m->len = m->len + 1;                                                   \
+        m->used = m->used + 1;                                                 \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    bool Map_remove(T)(Map(T) * m, const char *key) {                          \
+        assert(m);                                                             \
+        assert(key);                                                           \
+        if (m->len == 0) {                                                     \
+            return false;                                                      \
+        }                                                                      \
+        size_t i = Intern_hash(key) & (m->cap - 1);                            \
+        while (m->keys[i]) {                                                   \
+            if (m->keys[i] == key) {                                           \
+                if (!m->values[i]) {                                           \
+                    return false;                                              \
+                }                                                              \
+                m->values[i] = NULL;                                           \
+                m->len = m->len - 1;                                           \
+                return true;                                                   \
+            }                                                                  \
+            i = (i + 1) & (m->cap - 1);                                        \
+        }                                                                      \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    size_t Map_cap(T)(const Map(T) * m) {                                      \
+        assert(m);                                                             \
+        return m->cap;                                                         \
+    }                                                                          \
+                                                                               \
+    Map_Element(T) Map_value_at(T)(const Map(T) * m, size_t i) {               \
+        assert(m);                                                             \
+        assert(i < m->cap);                                                    \
+        if (!m->keys[i]) {                                                     \
+            return NULL;                                                       \
+        }                                                                      \
+        return m->values[i];                                                   \
+    }
+
+MAP_DECL(Symbol, struct Symbol *)
+MAP_DECL(Macro, struct Macro *)
+MAP_DECL(SourceFile, struct SourceFile *)
+MAP_DECL(String, const char *)
+MAP_DECL(AssemblerSymbol, struct AssemblerSymbol *)
+
+// Arena
+typedef struct Arena Arena;
+
+Arena *Arena_new(void);
+void Arena_delete(Arena *a);
+void *Arena_alloc(Arena *a, size_t size);
+void Arena_release(Arena *a);
+
+// A position in an arena. Resetting an arena to a mark releases everything
+// allocated after it.
+typedef struct ArenaMark {
+    struct ArenaChunk *chunk;
+    size_t used;
+    size_t num_allocations;
+    size_t allocated_bytes;
+} ArenaMark;
+
+void Arena_mark(const Arena *a, ArenaMark *mark);
+void Arena_reset(Arena *a, const ArenaMark *mark);
+size_t Arena_num_allocations(const Arena *a);
+size_t Arena_allocated_bytes(const Arena *a);
+size_t Arena_reserved_bytes(const Arena *a);
+
+// Intern
+const char *Intern_string(const char *s);
+const char *Intern_substring(const char *s, size_t len);
+size_t Intern_hash(const char *interned);
+size_t Intern_length(const char *interned);
+
+// HiddenSet
+typedef struct HiddenSet HiddenSet;
+typedef struct HiddenSetTable HiddenSetTable;
+
+HiddenSetTable *HiddenSetTable_new(void);
+HiddenSet *HiddenSet_add(HiddenSetTable *t, HiddenSet *set, const char *name);
+bool HiddenSet_contains(const HiddenSet *set, const char *name);
+size_t HiddenSet_len(const HiddenSet *set);
 
 // Path
 char *Path_join(const char *dir, const char *rel_path);
 char *Path_dir(const char *path);
+char *Path_base(const char *path);
+
+// Folds '.', '..' and repeated '/' without looking at the file system, so
+// that every spelling of a file maps to one path. Symbolic links are not
+// resolved.
+char *Path_normalize(const char *path);
 
 // File
-char *File_read(const char *path);
+//  Returns a read-only view of the file contents followed by a NUL
+//  sentinel, or NULL if the file cannot be read. Large files are mapped.
+const char *File_read(const char *path);
+
+// Same as File_read(), also storing the file size for binary contents
+const char *File_read_with_size(const char *path, size_t *size);
+
+// Binary
+//  Little-endian encoding of ints and length-prefixed strings, used by the
+//  precompiled header format and by object files.
+typedef struct BinaryWriter BinaryWriter;
+typedef struct BinaryReader BinaryReader;
+
+BinaryWriter *BinaryWriter_new(void);
+void BinaryWriter_delete(BinaryWriter *w);
+void BinaryWriter_write_byte(BinaryWriter *w, int byte);
+void BinaryWriter_write_int(BinaryWriter *w, int x);
+void BinaryWriter_patch_int(BinaryWriter *w, size_t pos, int x); // Rewrites
+void BinaryWriter_write_bytes(BinaryWriter *w, const char *s, size_t len);
+void BinaryWriter_write_string(BinaryWriter *w, const char *s);
+const char *BinaryWriter_data(const BinaryWriter *w);
+size_t BinaryWriter_len(const BinaryWriter *w);
+bool BinaryWriter_save(const BinaryWriter *w, const char *path);
+
+BinaryReader *BinaryReader_new(const char *data, size_t size);
+int BinaryReader_read_int(BinaryReader *r);
+const char *BinaryReader_read_bytes(BinaryReader *r, size_t len);
+const char *BinaryReader_read_string(BinaryReader *r); // Interned
+bool BinaryReader_at_end(const BinaryReader *r);
 
 // Type
 typedef enum ValueCategory {
@@ -286,14 +549,31 @@ enum TokenKind {
 };
 
 typedef struct Token {
+#ifndef MOCC
+    // Packed into a single word
+    TokenKind kind : 16;
+    unsigned int is_bol : 1;
+    unsigned int has_spaces : 1;
+#else
     TokenKind kind;
-    char *text;
-    char *string; // For string
-    int string_len;
     bool is_bol;
     bool has_spaces;
+#endif
+    int string_len;
+
+    const char *text; // Interned
+
+    // The token spelling is source[offset] .. source[offset + length - 1]
+    const char *source;
+    size_t offset;
+    size_t length;
 
-    Vec(String) * hidden_set;
+    // For character and string: the decoded contents, without a terminating
+    // NUL. This points into `source` unless the literal contains escapes.
+    // The length is `string_len`.
+    const char *string;
+
+    HiddenSet *hidden_set; // NULL if empty
 } Token;
 
 // Symbol
@@ -330,6 +610,9 @@ Scope *Scope_parent_scope(const Scope *s);
 Symbol *Scope_find(Scope *s, const char *name, bool recursive);
 bool Scope_try_register(Scope *s, Symbol *symbol);
 
+// Symbols declared directly in the scope, in a stable order
+Vec(Symbol) * Scope_symbols(const Scope *s);
+
 // Ast
 typedef enum NodeKind {
 #define NODE(name, base) NodeKind_##name##base,
@@ -547,11 +830,55 @@ TranslationUnitNode *TranslationUnitNode_new(Vec(DeclNode) * declarations);
 
 void Node_dump(const Node *p, FILE *fp);
 
+Arena *Node_arena(void);
+void Node_release_arena(void);
+
+// Scan
+//  Lengths of the runs of characters at the start of a NUL-terminated text,
+//  used by the lexer. SSE2 or AVX2 versions are selected at runtime when
+//  the CPU supports them.
+typedef enum ScanLevel {
+    ScanLevel_scalar,
+    ScanLevel_sse2,
+    ScanLevel_avx2,
+} ScanLevel;
+
+ScanLevel Scan_max_level(void);
+ScanLevel Scan_level(void);
+void Scan_set_level(ScanLevel level); // Falls back to scalar if unsupported
+
+size_t Scan_spaces(const char *s);             // [ \t\v\f\r]*
+size_t Scan_digits(const char *s);             // [0-9]*
+size_t Scan_identifier(const char *s);         // [0-9A-Za-z_]*
+size_t Scan_literal(const char *s, char quote); // Up to quote, \\, \n or NUL
+
 // Lexer
 typedef struct Lexer Lexer;
 
+// Builds the tables shared by every lexer, which Lexer_new otherwise builds
+// on first use. Call it before lexing from more than one thread.
+void Lexer_init_tables(void);
+
 Lexer *Lexer_new(const char *filename, const char *text);
 Token *Lexer_read(Lexer *l);
+Vec(Token) * Lexer_read_all(Lexer *l);
+
+// Returns the name of the directive started by `tokens[i]`, or NULL
+const char *Lexer_directive_at(const Vec(Token) * tokens, size_t i);
+
+// SourceCache
+//  Process-wide cache of source files keyed by path. A file is read and lexed
+//  only once; its raw tokens are shared and must not be modified.
+typedef struct SourceFile {
+    const char *path; // Interned
+    const char *text;
+    Vec(Token) * tokens; // Ends with EOF
+
+    // X if the whole file is wrapped in `#ifndef X ... #endif`, else NULL
+    const char *guard_macro;
+} SourceFile;
+
+const SourceFile *SourceCache_load(const char *path);
 
 // Preprocessor
 typedef struct Macro {
@@ -560,24 +887,85 @@ typedef struct Macro {
     Vec(Token) * contents;
 } Macro;
 
+Macro *
+Macro_new(const char *name, Vec(String) * parameters, Vec(Token) * contents);
 Macro *Macro_new_simple(const char *name, Vec(Token) * contents);
 bool Macro_is_function(const Macro *m);
 
+typedef struct Preprocessor Preprocessor;
+
+Preprocessor *Preprocessor_new(Vec(String) * include_paths);
+
+// Starts preprocessing a main file. A preprocessor runs only once, but it
+// can be given macros and #pragma once files beforehand, and they can be read
+// back afterwards.
+void Preprocessor_begin(
+    Preprocessor *pp, const char *filename, const char *text);
+
+// Preprocesses just enough to return the next token. EOF is returned at the
+// end, and on every call after that.
+Token *Preprocessor_next(Preprocessor *pp);
+
+// Preprocesses a whole main file
+Vec(Token) *
+    Preprocessor_run(Preprocessor *pp, const char *filename, const char *text);
+
+void Preprocessor_define_macro(Preprocessor *pp, Macro *macro);
+const Map(Macro) * Preprocessor_macros(const Preprocessor *pp);
+void Preprocessor_mark_once(Preprocessor *pp, const char *path);
+const Map(String) * Preprocessor_once_files(const Preprocessor *pp);
+
 Vec(Token) *
     Preprocessor_read(
         Vec(String) * include_paths, const char *filename, const char *text);
 
+// TokenStream
+//  Binary serialization of preprocessed tokens, so that preprocessing can be
+//  cached apart from compilation. Spellings are stored once in a table.
+void TokenStream_write(BinaryWriter *w, const Vec(Token) * tokens);
+bool TokenStream_is_binary(const char *data, size_t size);
+Vec(Token) * TokenStream_read(const char *data, size_t size);
+
+// Writes the tokens as text
+void TokenStream_print(const Vec(Token) * tokens, FILE *fp);
+
+// TokenSource
+//  Hands out tokens one at a time, either from a vector or pulled from a
+//  preprocessor as they are needed. EOF is repeated at the end.
+typedef struct TokenSource TokenSource;
+
+TokenSource *TokenSource_from_vec(const Vec(Token) * tokens);
+TokenSource *TokenSource_from_preprocessor(Preprocessor *pp);
+Token *TokenSource_next(TokenSource *source);
+
+// Reads the remaining tokens up to and including EOF
+Vec(Token) * TokenSource_read_all(TokenSource *source);
+
 // Parser
 typedef struct Parser Parser;
 
 Parser *Parser_new(const Vec(Token) * tokens);
+Parser *Parser_new_from_source(TokenSource *source);
 TranslationUnitNode *Parser_parse(Parser *p);
 
+// Parses one top level declaration, or returns NULL at the end
+DeclNode *Parser_parse_next_decl(Parser *p);
+
+// Releases the body and the local variables of the function that was
+// returned last by Parser_parse_next_decl(). The node is released with them.
+void Parser_release_function_decl(Parser *p, FunctionDeclNode *node);
+struct Sema *Parser_sema(Parser *p);
+
 // Sema
 typedef struct Sema Sema;
 
 Sema *Sema_new(void);
 
+// File scopes of ordinary identifiers, struct tags and enum tags
+Scope *Sema_global_variable_scope(const Sema *s);
+Scope *Sema_global_struct_scope(const Sema *s);
+Scope *Sema_global_enum_scope(const Sema *s);
+
 // Types
 Type *Sema_act_on_struct_type_reference(Sema *s, const Token *identifier);
 Type *
@@ -699,17 +1087,184 @@ DeclNode *Sema_act_on_function_decl_end_of_body(
     DeclaratorNode *declarator,
     StmtNode *body);
 
+// Driver
+//  Compiles source files or binary token streams to assembly, or to object
+//  files with the built-in assembler, or runs them in memory. Several files
+//  can be compiled at once by `num_jobs` worker threads. Each file gets its
+//  own preprocessor, parser and code generator, while interned strings and
+//  the header cache are shared.
+void Driver_preprocess(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    bool binary);
+
+// With more than one job, the functions are generated in parallel
+void Driver_compile(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    const char *output,
+    int num_jobs,
+    bool object);
+
+// Compiles `input` in memory and returns the exit status of its main, called
+// with `argc` and `argv`
+int Driver_run(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    const char *input,
+    int num_jobs,
+    int argc,
+    char **argv);
+
+// Writes the assembly of each input to `output_dir`, named after the input
+// with ".s" appended, or the object with ".o" appended
+void Driver_compile_all(
+    Vec(String) * include_paths,
+    const char *pch_path,
+    Vec(String) * inputs,
+    const char *output_dir,
+    int num_jobs,
+    bool object);
+
+// TimeReport
+//  Wall time, CPU time and allocations of each phase of a compilation, for
+//  --time-report. Phases nest, and the time of a nested phase is not counted
+//  in the enclosing one. Nothing is measured until the report is enabled.
+typedef enum TimeReportPhase {
+    TimeReportPhase_other, // Outside of any phase
+    TimeReportPhase_read,
+    TimeReportPhase_lex,
+    TimeReportPhase_preprocess,
+    TimeReportPhase_expand,
+    TimeReportPhase_parse, // Including Sema
+    TimeReportPhase_codegen,
+    TimeReportPhase_assemble,
+    TimeReportPhase_count,
+} TimeReportPhase;
+
+void TimeReport_enable(void);
+bool TimeReport_is_enabled(void);
+void TimeReport_begin(TimeReportPhase phase);
+void TimeReport_end(TimeReportPhase phase);
+
+// Prints a table, or a JSON object on one line, to stderr
+void TimeReport_print(bool json);
+
+// Counts an allocation against the current phase. Called where mocc
+// allocates file contents, tokens, macros, AST nodes, symbols, types,
+// scopes, addresses, containers and output buffers; the few allocations of
+// the driver and of each parser, lexer or code generator are not counted
+void TimeReport_allocate(size_t size);
+
+// StringPool
+//  String literals of a translation unit, each kept once. After merging,
+//  a literal that is the tail of another one is placed inside it. Literals
+//  containing NUL are never merged.
+typedef struct StringPool StringPool;
+
+StringPool *StringPool_new(void);
+void StringPool_delete(StringPool *pool);
+size_t StringPool_add(StringPool *pool, const char *s, size_t len); // Entry
+size_t StringPool_len(const StringPool *pool);
+const char *StringPool_string(const StringPool *pool, size_t entry);
+size_t StringPool_length(const StringPool *pool, size_t entry);
+bool StringPool_has_nul(const StringPool *pool, size_t entry);
+void StringPool_merge_suffixes(StringPool *pool);
+
+// Returns the entry that holds the bytes of `entry` at `*offset`. It is
+// `entry` itself unless it is merged.
+size_t StringPool_root(const StringPool *pool, size_t entry, size_t *offset);
+
+// Emitter
+//  Buffered text output for the generated assembly. Pieces are appended
+//  without format strings, and the buffer is written to the file in large
+//  blocks. An emitter without a file keeps everything in memory.
+typedef struct Emitter Emitter;
+
+Emitter *Emitter_new(FILE *fp);
+void Emitter_delete(Emitter *e);
+void Emitter_flush(Emitter *e);
+void Emitter_write(Emitter *e, const char *s);
+void Emitter_write_bytes(Emitter *e, const char *s, size_t len);
+void Emitter_write_char(Emitter *e, char c);
+void Emitter_write_size(Emitter *e, size_t x);
+void Emitter_write_int(Emitter *e, int x);
+void Emitter_write_signed_int(Emitter *e, int x); // With '+' if not negative
+void Emitter_write_hex_byte(Emitter *e, int x);   // As 0x00 to 0xff
+void Emitter_append(Emitter *e, const Emitter *other);
+const char *Emitter_data(const Emitter *e, size_t *len); // Without a file
+
 // CodeGen
+//  Declarations can be generated one by one as they are parsed; string
+//  literals are pooled until the end.
+typedef struct CodeGen CodeGen;
+
+CodeGen *CodeGen_new(FILE *fp); // Keeps the output in memory if NULL
+void CodeGen_delete(CodeGen *g);
+void CodeGen_gen_decl(CodeGen *g, DeclNode *p);
+void CodeGen_finish(CodeGen *g);
+const char *CodeGen_output(const CodeGen *g, size_t *len); // In memory
+
 void CodeGen_gen(TranslationUnitNode *p, FILE *fp);
 
+// Generates the declarations into `g`, the functions on `num_jobs` worker
+// threads, each into its own buffer. The output is the same as generating
+// them one by one.
+void CodeGen_gen_parallel(CodeGen *g, TranslationUnitNode *p, int num_jobs);
+
+// Assembler
+//  Assembles the output of CodeGen into an ELF64 relocatable object for
+//  x86-64, or into executable memory.
+typedef struct AssemblerSymbol AssemblerSymbol;
+
+void Assembler_assemble(const char *text, size_t len, const char *path);
+
+// Loads the code into memory, resolving the undefined symbols in the running
+// process, and returns the exit status of its main. Supported on ELF hosts
+// only, and not when compiled by mocc itself.
+int Assembler_run(const char *text, size_t len, int argc, char **argv);
+
+// PrecompiledHeader
+//  Snapshot of the macros and the file-scope declarations after a header,
+//  so that translation units including it can skip processing it again.
+//  The header may declare types, typedefs, enumerators and functions, but
+//  must not define functions or variables.
+typedef struct PrecompiledHeader PrecompiledHeader;
+
+void PrecompiledHeader_emit(
+    Vec(String) * include_paths, const char *header_path, const char *output);
+
+PrecompiledHeader *PrecompiledHeader_load(const char *path);
+void PrecompiledHeader_define_macros(
+    const PrecompiledHeader *pch, Preprocessor *pp);
+void PrecompiledHeader_declare_symbols(const PrecompiledHeader *pch, Sema *s);
+
 // Tests
 void test_Vec(void);
+void test_Arena(void);
+void test_Intern(void);
+void test_HiddenSet(void);
 void test_Path(void);
 void test_File(void);
+void test_Binary(void);
 void test_Ast(void);
+void test_Scan(void);
 void test_Lexer(void);
+void test_SourceCache(void);
 void test_Preprocessor(void);
+void test_TokenStream(void);
 void test_Parser(void);
+void test_StringPool(void);
+void test_Emitter(void);
+void test_PrecompiledHeader(void);
+
+// Benchmarks
+void bench_Scope(void);
+void bench_Preprocessor(void);
+void bench_Lexer(void);
 
 void check_Node_dump(
     const char *test_name, const Node *p, const char *expected);
@@ -8,13 +8,21 @@ fi
 
 dir="$(cd "$(dirname "$0")" || exit 1; pwd)"
 
+# The built-in assembler writes ELF objects only
+elf=1
+if [ "$(uname -s)" = Darwin ]; then
+    elf=
+fi
+
 try() {
     local test_name=$1
     local input=$2
     local expected=$3
+    local flags=("${@:4}")
 
     local c="$dir/tmp/$test_name.c"
     local asm="$dir/tmp/$test_name.s"
+    local obj="$dir/tmp/$test_name.o"
     local bin="$dir/tmp/$test_name"
 
     local exit_code
@@ -23,7 +31,7 @@ try() {
 
     echo -n "$input" > "$c"
 
-    "$MOCC" "$c" "$asm"
+    "$MOCC" "${flags[@]}" "$c" "$asm"
     exit_code="$?"
     if [ "$exit_code" -ne 0 ]; then
         echo "$test_name: compilation failed with exit code $exit_code"
@@ -44,12 +52,49 @@ try() {
         exit 1
     fi
 
-    rm "$c" "$asm" "$bin"
+    # The object from the built-in assembler behaves the same
+    if [ -n "$elf" ]; then
+        "$MOCC" -c "${flags[@]}" "$c" "$obj"
+        exit_code="$?"
+        if [ "$exit_code" -ne 0 ]; then
+            echo "$test_name: compilation to object failed with exit code $exit_code"
+            exit 1
+        fi
+
+        gcc "$obj" -o "$bin"
+        exit_code="$?"
+        if [ "$exit_code" -ne 0 ]; then
+            echo "$test_name: link of object failed"
+            exit 1
+        fi
+
+        "$bin"
+        exit_code="$?"
+        if [ "$exit_code" -ne "$expected" ]; then
+            echo "$test_name: expected $expected with object, actual $exit_code"
+            exit 1
+        fi
+    fi
+
+    # Running in memory needs a mocc built by the host compiler for ELF
+    if [ -n "$MOCC_HOST" ] && [ -n "$elf" ]; then
+        "$MOCC" "${flags[@]}" --run "$c"
+        exit_code="$?"
+        if [ "$exit_code" -ne "$expected" ]; then
+            echo "$test_name: expected $expected with --run, actual $exit_code"
+            exit 1
+        fi
+    fi
+
+    rm -f "$c" "$asm" "$obj" "$bin"
 }
 
 try "c$LINENO" 'int main(void) { return 0; }' 0
 try "c$LINENO" 'int main(void) { return 42; }' 42
 try "c$LINENO" "int main(void) { return 'A'; }" 65
+try "c$LINENO" 'int main(void) { int x; x = -2147483648; return ((x & (-2147483647 - 1)) != 0) + (x == 0) * 2; }' 1
+try "c$LINENO" 'int main(void) { int x; x = -2147483648; return (x == 0) * 10 + ((x & (-2147483647 - 1)) != 0) + 1; }' 2
+try "c$LINENO" 'int main(void) { int a; int b; a = -128; b = -129; return a - b + 41; }' 42
 try "c$LINENO" "int main(void) { return '\0'; }" 0
 try "c$LINENO" "int main(void) { return '\n'; }" 10
 
@@ -321,6 +366,20 @@ try "c$LINENO" '
     int main(void) { return strcmp("world", &"hello, world"[7]); }
     ' 0
 
+# Equal literals and a literal at the tail of another share their bytes
+try "c$LINENO" '
+    int strcmp(const char *a, const char *b);
+    typedef int size_t;
+    size_t strlen(const char *s);
+    int main(void) {
+        const char *a = "world";
+        const char *b = "hello, world";
+        const char *c = "a\0world";
+        return (a == &b[7]) + (a == "world") * 2 + strcmp(b, "hello, world") +
+            strlen("") + strlen(&c[2]) * 4 + (c[1] == 0) * 32;
+    }
+    ' 55
+
 try "c$LINENO" '
     struct S { int x; int y, z; };
     int main(void) { struct S s; s.x=2; s.y=4; s.z=5; return s.x + s.y + s.z; }
@@ -365,3 +424,292 @@ try "c$LINENO" '
         return strcmp(buffer, "Hello, world! 42");
     }
     ' 0
+
+"$MOCC" --emit-pch "$dir/test/pch.h" "$dir/tmp/pch.pch"
+if [ "$?" -ne 0 ]; then
+    echo "pch.h: precompilation failed"
+    exit 1
+fi
+
+try "c$LINENO" '
+    #include "../test/pch.h"
+    int pch_sum(PchNode *node, ...) {
+        int sum = PCH_ZERO();
+        while (node) {
+            sum = sum + node->value;
+            node = node->next;
+        }
+        return sum;
+    }
+    int main(void) {
+        PchNode a;
+        struct PchNode b;
+        PchColor color = PchColor_green;
+        a.next = &b;
+        a.value = PCH_ANSWER + color;
+        b.next = PCH_NULL;
+        b.value = sizeof(a.name);
+        return abs(-pch_sum(&a, 0));
+    }
+    ' 63 --include-pch "$dir/tmp/pch.pch"
+
+rm "$dir/tmp/pch.pch"
+
+# Preprocess to a binary token stream, then compile the stream
+cat > "$dir/tmp/tokens.c" <<'EOF_TOKENS'
+#define ANSWER 42
+#define GREETING "Hello, world!"
+int strlen(const char *s);
+int main(void) {
+    return ANSWER + strlen(GREETING);
+}
+EOF_TOKENS
+
+"$MOCC" -E --binary "$dir/tmp/tokens.c" "$dir/tmp/tokens.tok" &&
+    "$MOCC" "$dir/tmp/tokens.tok" "$dir/tmp/tokens.s" &&
+    gcc "$dir/tmp/tokens.s" -o "$dir/tmp/tokens"
+if [ "$?" -ne 0 ]; then
+    echo "tokens.c: binary token stream compilation failed"
+    exit 1
+fi
+
+"$dir/tmp/tokens"
+exit_code="$?"
+if [ "$exit_code" -ne 55 ]; then
+    echo "tokens.c: expected 55, actual $exit_code"
+    exit 1
+fi
+
+rm "$dir/tmp/tokens.c" "$dir/tmp/tokens.tok" "$dir/tmp/tokens.s" \
+    "$dir/tmp/tokens"
+
+# Compile several files in one process
+cat > "$dir/tmp/multi_main.c" <<'EOF_MULTI'
+#include "../test/test.h"
+int multi_twice(int x);
+int main(void) {
+    return multi_twice(hello());
+}
+EOF_MULTI
+
+cat > "$dir/tmp/multi_lib.c" <<'EOF_MULTI'
+#include "../test/test.h"
+int hello(void) {
+    return 21;
+}
+int multi_twice(int x) {
+    return x * 2;
+}
+EOF_MULTI
+
+"$MOCC" -j 2 "$dir/tmp/multi_main.c" "$dir/tmp/multi_lib.c" -o "$dir/tmp/" &&
+    gcc "$dir/tmp/multi_main.c.s" "$dir/tmp/multi_lib.c.s" \
+        -o "$dir/tmp/multi"
+if [ "$?" -ne 0 ]; then
+    echo "multi_*.c: multi-file compilation failed"
+    exit 1
+fi
+
+"$dir/tmp/multi"
+exit_code="$?"
+if [ "$exit_code" -ne 42 ]; then
+    echo "multi_*.c: expected 42, actual $exit_code"
+    exit 1
+fi
+
+# The same files, assembled by mocc
+if [ -n "$elf" ]; then
+    "$MOCC" -c -j 2 "$dir/tmp/multi_main.c" "$dir/tmp/multi_lib.c" \
+        -o "$dir/tmp/" &&
+        gcc "$dir/tmp/multi_main.c.o" "$dir/tmp/multi_lib.c.o" \
+            -o "$dir/tmp/multi"
+    if [ "$?" -ne 0 ]; then
+        echo "multi_*.c: multi-file compilation to objects failed"
+        exit 1
+    fi
+
+    "$dir/tmp/multi"
+    exit_code="$?"
+    if [ "$exit_code" -ne 42 ]; then
+        echo "multi_*.c: expected 42 with objects, actual $exit_code"
+        exit 1
+    fi
+fi
+
+rm -f "$dir/tmp/multi_main.c" "$dir/tmp/multi_lib.c" \
+    "$dir/tmp/multi_main.c.s" "$dir/tmp/multi_lib.c.s" \
+    "$dir/tmp/multi_main.c.o" "$dir/tmp/multi_lib.c.o" "$dir/tmp/multi"
+
+# Inputs with the same base name would be written to the same output
+mkdir -p "$dir/tmp/same1" "$dir/tmp/same2"
+echo 'int same1(void) { return 1; }' > "$dir/tmp/same1/same.c"
+echo 'int same2(void) { return 2; }' > "$dir/tmp/same2/same.c"
+if "$MOCC" -j 2 "$dir/tmp/same1/same.c" "$dir/tmp/same2/same.c" \
+    -o "$dir/tmp/" 2> /dev/null; then
+    echo "same.c: expected an error for inputs with the same output"
+    exit 1
+fi
+
+rm -rf "$dir/tmp/same1" "$dir/tmp/same2" "$dir/tmp/same.c.s"
+
+# Generate the functions in parallel
+try "c$LINENO" '
+    int strcmp(const char *s1, const char *s2);
+    const char *name(int x) {
+        if (x == 1) {
+            return "one";
+        }
+        return "other";
+    }
+    int count(int n) {
+        int i;
+        int sum;
+        sum = 0;
+        for (i = 0; i < n; i = i + 1) {
+            sum = sum + i;
+        }
+        return sum;
+    }
+    int main(void) {
+        return count(5) + strcmp(name(1), "one") + strcmp(name(2), "other");
+    }
+    ' 10 -j 2
+
+# Parallel code generation writes the same output as serial
+cat > "$dir/tmp/jobs.c" <<'EOF_JOBS'
+int printf(const char *format, ...);
+const char *jobs_name(int x) {
+    if (x == 1) {
+        return "one";
+    } else if (x == 2) {
+        return "two";
+    }
+    return "many";
+}
+int jobs_sum(int n) {
+    int sum;
+    sum = 0;
+    while (n > 0) {
+        sum = sum + n;
+        n = n - 1;
+    }
+    return sum;
+}
+int jobs_print(int n) {
+    int i;
+    for (i = 0; i < n; i = i + 1) {
+        printf("%d %s\n", i, jobs_name(i));
+    }
+    return printf("done\n");
+}
+int main(void) {
+    jobs_print(3);
+    return jobs_sum(4) == 10 && printf("%s\n", "sum");
+}
+EOF_JOBS
+
+job_outputs=(s)
+if [ -n "$elf" ]; then
+    job_outputs+=(o)
+fi
+
+for ext in "${job_outputs[@]}"; do
+    job_flags=()
+    if [ "$ext" = o ]; then
+        job_flags=(-c)
+    fi
+
+    "$MOCC" "${job_flags[@]}" -j 1 "$dir/tmp/jobs.c" "$dir/tmp/jobs_1.$ext" &&
+        "$MOCC" "${job_flags[@]}" -j 4 "$dir/tmp/jobs.c" "$dir/tmp/jobs_4.$ext"
+    if [ "$?" -ne 0 ]; then
+        echo "jobs.c: compilation failed"
+        exit 1
+    fi
+
+    if ! cmp "$dir/tmp/jobs_1.$ext" "$dir/tmp/jobs_4.$ext"; then
+        echo "jobs.c: -j 4 output differs from -j 1"
+        exit 1
+    fi
+
+    rm -f "$dir/tmp/jobs_1.$ext" "$dir/tmp/jobs_4.$ext"
+done
+
+rm -f "$dir/tmp/jobs.c"
+
+# Run in memory with arguments
+if [ -n "$MOCC_HOST" ] && [ -n "$elf" ]; then
+    cat > "$dir/tmp/run.c" <<'EOF_RUN'
+int printf(const char *format, ...);
+int strcmp(const char *s1, const char *s2);
+int counter;
+int main(int argc, char **argv) {
+    counter = counter + argc;
+    printf("%s\n", argv[2]);
+    return counter * 10 + strcmp(argv[1], "one") + strcmp(argv[2], "two");
+}
+EOF_RUN
+
+    output="$("$MOCC" --run "$dir/tmp/run.c" one two)"
+    exit_code="$?"
+    if [ "$exit_code" -ne 30 ] || [ "$output" != "two" ]; then
+        echo "run.c: expected 30 and two, actual $exit_code and $output"
+        exit 1
+    fi
+
+    rm "$dir/tmp/run.c"
+fi
+
+# Report the time of each phase
+if [ -n "$MOCC_HOST" ]; then
+    cat > "$dir/tmp/time_report.c" <<'EOF_TIME_REPORT'
+#include "../test/test.h"
+#define HALF() 21
+#define ANSWER HALF() + HALF()
+int main(void) {
+    return ANSWER;
+}
+EOF_TIME_REPORT
+
+    # Assembly is timed too where objects can be written
+    report_flags=()
+    if [ -n "$elf" ]; then
+        report_flags=(-c)
+    fi
+
+    report="$("$MOCC" "${report_flags[@]}" --time-report=json \
+        "$dir/tmp/time_report.c" "$dir/tmp/time_report.o" 2>&1)"
+    if [ "$?" -ne 0 ]; then
+        echo "time_report.c: compilation failed"
+        exit 1
+    fi
+
+    for phase in read lex preprocess expand parse codegen assemble total; do
+        if [[ "$report" != *"\"$phase\""* ]]; then
+            echo "time_report.c: no $phase in the report: $report"
+            exit 1
+        fi
+    done
+
+    if [[ "$report" =~ \"parse\"[^}]*\"allocations\":\ 0, ]]; then
+        echo "time_report.c: no allocations counted in parse: $report"
+        exit 1
+    fi
+
+    "$MOCC" --time-report "$dir/tmp/time_report.c" "$dir/tmp/time_report.s" \
+        2> /dev/null &&
+        gcc "$dir/tmp/time_report.s" -o "$dir/tmp/time_report"
+    if [ "$?" -ne 0 ]; then
+        echo "time_report.c: compilation with the report failed"
+        exit 1
+    fi
+
+    "$dir/tmp/time_report"
+    exit_code="$?"
+    if [ "$exit_code" -ne 42 ]; then
+        echo "time_report.c: expected 42, actual $exit_code"
+        exit 1
+    fi
+
+    rm "$dir/tmp/time_report.c" "$dir/tmp/time_report.o" \
+        "$dir/tmp/time_report.s" "$dir/tmp/time_report"
+fi
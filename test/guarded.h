@@ -0,0 +1,6 @@
+#ifndef INCLUDE_guarded_h
+#define INCLUDE_guarded_h
+
+#define GUARDED guarded
+
+#endif
@@ -0,0 +1,5 @@
+#ifndef GUARDED_ELSE
+guarded_else_a
+#else
+guarded_else_b
+#endif
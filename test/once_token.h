@@ -0,0 +1,3 @@
+#pragma once
+
+once_token
@@ -0,0 +1,26 @@
+#ifndef INCLUDE_pch_h
+#define INCLUDE_pch_h
+
+#define PCH_ANSWER 42
+#define PCH_ZERO() (0)
+#define PCH_GREETING "hello\n"
+#define PCH_NULL ((void *)0)
+
+typedef struct PchNode PchNode;
+
+struct PchNode {
+    PchNode *next;
+    char name[16];
+    int value;
+};
+
+typedef enum PchColor {
+    PchColor_red,
+    PchColor_green = 5,
+} PchColor;
+
+int pch_sum(PchNode *node, ...);
+int puts(const char *s);
+int abs(int x);
+
+#endif
@@ -0,0 +1,80 @@
+#include "mocc.h"
+
+void test_Arena(void) {
+    Arena *a = Arena_new();
+    assert(a != NULL);
+
+    assert(Arena_num_allocations(a) == 0);
+    assert(Arena_allocated_bytes(a) == 0);
+    assert(Arena_reserved_bytes(a) == 0);
+
+    char *c = Arena_alloc(a, 1);
+    int *x = Arena_alloc(a, sizeof(int));
+    void **p = Arena_alloc(a, sizeof(void *));
+
+    *c = 'a';
+    *x = 42;
+    *p = x;
+
+    assert((char *)x - c == 8);
+    assert((char *)p - (char *)x == 8);
+    assert(*c == 'a');
+    assert(*x == 42);
+    assert(*p == x);
+
+    assert(Arena_num_allocations(a) == 3);
+    assert(Arena_allocated_bytes(a) == 24);
+
+    // Larger than a chunk
+    char *big = Arena_alloc(a, 1000000);
+    big[999999] = 'z';
+
+    assert(Arena_num_allocations(a) == 4);
+    assert(Arena_allocated_bytes(a) == 1000024);
+    assert(Arena_reserved_bytes(a) >= 1000024);
+
+    for (int i = 0; i < 100000; i = i + 1) {
+        int *y = Arena_alloc(a, sizeof(int));
+        *y = i;
+    }
+
+    assert(Arena_num_allocations(a) == 100004);
+
+    Arena_release(a);
+
+    assert(Arena_num_allocations(a) == 0);
+    assert(Arena_allocated_bytes(a) == 0);
+    assert(Arena_reserved_bytes(a) == 0);
+
+    // Reusable after release
+    int *z = Arena_alloc(a, sizeof(int));
+    *z = 7;
+    assert(*z == 7);
+
+    // Reset to a mark
+    ArenaMark mark;
+    Arena_mark(a, &mark);
+
+    size_t reserved = Arena_reserved_bytes(a);
+
+    Arena_alloc(a, 16);
+    Arena_alloc(a, 1000000);
+    for (int i = 0; i < 100000; i = i + 1) {
+        Arena_alloc(a, sizeof(int));
+    }
+
+    Arena_reset(a, &mark);
+
+    assert(Arena_num_allocations(a) == 1);
+    assert(Arena_allocated_bytes(a) == 8);
+    assert(Arena_reserved_bytes(a) == reserved);
+    (void)reserved;
+
+    // Allocations after the reset reuse the space after the mark
+    int *w = Arena_alloc(a, sizeof(int));
+    *w = 9;
+    assert((char *)w - (char *)z == 8);
+    assert(*z == 7);
+
+    Arena_delete(a);
+}
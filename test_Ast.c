@@ -16,7 +16,7 @@ void check_Node_dump(
     Node_dump(p, fp);
     fclose(fp);
 
-    char *actual = File_read(path);
+    const char *actual = File_read(path);
     if (!actual) {
         ERROR("could not read file %s", path);
     }
@@ -0,0 +1,55 @@
+#include "mocc.h"
+
+void test_Binary(void) {
+    BinaryWriter *w = BinaryWriter_new();
+
+    int ints[] = {0, 1, 255, 256, 65536, 2147483647, -1, -256, -2147483647 - 1};
+    size_t num_ints = sizeof(ints) / sizeof(ints[0]);
+
+    for (size_t i = 0; i < num_ints; i++) {
+        BinaryWriter_write_int(w, ints[i]);
+    }
+
+    BinaryWriter_write_string(w, "hello");
+    BinaryWriter_write_string(w, "");
+    BinaryWriter_write_bytes(w, "a\0b", 3);
+    BinaryWriter_write_byte(w, 200);
+    BinaryWriter_write_int(w, 0);
+    BinaryWriter_patch_int(w, BinaryWriter_len(w) - 4, 258);
+
+    assert(BinaryWriter_len(w) == num_ints * 4 + 9 + 4 + 3 + 5);
+    assert(memcmp(BinaryWriter_data(w), "\x00\x00\x00\x00\x01", 5) == 0);
+
+    const char *path = "tmp/test_Binary.bin";
+    bool saved = BinaryWriter_save(w, path);
+    (void)saved;
+    assert(saved);
+
+    size_t size;
+    const char *data = File_read_with_size(path, &size);
+    remove(path);
+
+    assert(data != NULL);
+    assert(size == BinaryWriter_len(w));
+
+    // Little-endian
+    assert(memcmp(&data[4], "\x01\x00\x00\x00", 4) == 0);
+    assert(memcmp(&data[12], "\x00\x01\x00\x00", 4) == 0);
+
+    BinaryReader *r = BinaryReader_new(data, size);
+
+    for (size_t i = 0; i < num_ints; i++) {
+        int x = BinaryReader_read_int(r);
+        (void)x;
+        assert(x == ints[i]);
+    }
+
+    assert(BinaryReader_read_string(r) == Intern_string("hello"));
+    assert(BinaryReader_read_string(r) == Intern_string(""));
+    assert(memcmp(BinaryReader_read_bytes(r, 3), "a\0b", 3) == 0);
+    assert((BinaryReader_read_bytes(r, 1)[0] & 255) == 200);
+    assert(BinaryReader_read_int(r) == 258);
+    assert(BinaryReader_at_end(r));
+
+    BinaryWriter_delete(w);
+}
@@ -0,0 +1,64 @@
+#include "mocc.h"
+
+void test_Emitter(void) {
+    const char *path = "tmp/test_Emitter.s";
+
+    FILE *fp = fopen(path, "w");
+    assert(fp != NULL);
+
+    Emitter *e = Emitter_new(fp);
+    Emitter *m = Emitter_new(NULL);
+
+    Emitter_write(e, "  push ");
+    Emitter_write_int(e, 0);
+    Emitter_write_char(e, '\n');
+    Emitter_write(e, "  push ");
+    Emitter_write_int(e, -2147483647);
+    Emitter_write_char(e, '\n');
+    Emitter_write(e, "  push ");
+    Emitter_write_int(e, -2147483647 - 1);
+    Emitter_write_char(e, '\n');
+
+    Emitter_write(m, "  lea rax, [rbp");
+    Emitter_write_signed_int(m, -16);
+    Emitter_write(m, "] [rbp");
+    Emitter_write_signed_int(m, 0);
+    Emitter_write(m, "]\n  .byte ");
+    Emitter_write_hex_byte(m, 10);
+    Emitter_write_char(m, ' ');
+    Emitter_write_hex_byte(m, 255);
+    Emitter_write_char(m, ' ');
+    Emitter_write_size(m, 1234567890);
+    Emitter_write_bytes(m, "\nxyz", 1);
+
+    Emitter_append(e, m);
+
+    // Larger than the buffer that is written at once
+    for (int i = 0; i < 300000; i++) {
+        Emitter_write(e, "  pop rdi\n");
+    }
+
+    Emitter_flush(e);
+    fclose(fp);
+
+    size_t size;
+    const char *text = File_read_with_size(path, &size);
+    remove(path);
+
+    const char *expected = "  push 0\n"
+                           "  push -2147483647\n"
+                           "  push -2147483648\n"
+                           "  lea rax, [rbp-16] [rbp+0]\n"
+                           "  .byte 0x0a 0xff 1234567890\n";
+    size_t expected_len = strlen(expected);
+
+    assert(text != NULL);
+    assert(size == expected_len + 300000 * 10);
+    assert(memcmp(text, expected, expected_len) == 0);
+    assert(memcmp(&text[size - 10], "  pop rdi\n", 10) == 0);
+    (void)text;
+    (void)expected_len;
+
+    Emitter_delete(e);
+    Emitter_delete(m);
+}
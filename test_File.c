@@ -2,7 +2,7 @@
 
 void test_File(void) {
     {
-        char *s = File_read("test/hello.c");
+        const char *s = File_read("test/hello.c");
         (void)s;
 
         assert(s != NULL);
@@ -15,9 +15,33 @@ void test_File(void) {
             "}\n"));
     }
     {
-        char *s = File_read("NO_SUCH_FILE");
+        const char *s = File_read("NO_SUCH_FILE");
         (void)s;
 
         assert(s == NULL);
     }
+    {
+        // Large enough to be mapped, with and without a partial last page
+        size_t sizes[] = {65536, 100001};
+
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+            char path[] = "/tmp/mocc_test_File_XXXXXX";
+            int fd = mkstemp(path);
+            assert(fd >= 0);
+
+            FILE *fp = fdopen(fd, "wb");
+            for (size_t j = 0; j < sizes[i]; j++) {
+                fputc('a' + (int)(j % 26), fp);
+            }
+            fclose(fp);
+
+            const char *s = File_read(path);
+            remove(path);
+
+            assert(s != NULL);
+            assert(strlen(s) == sizes[i]);
+            assert(s[sizes[i] - 1] == 'a' + (int)((sizes[i] - 1) % 26));
+            (void)s;
+        }
+    }
 }
@@ -0,0 +1,76 @@
+#include "mocc.h"
+
+void test_HiddenSet(void) {
+    HiddenSetTable *t = HiddenSetTable_new();
+
+    const char *a = Intern_string("A");
+    const char *b = Intern_string("B");
+    const char *c = Intern_string("C");
+
+    // NULL is the empty set
+    assert(HiddenSet_len(NULL) == 0);
+    assert(!HiddenSet_contains(NULL, a));
+
+    HiddenSet *sa = HiddenSet_add(t, NULL, a);
+    HiddenSet *sab = HiddenSet_add(t, sa, b);
+    HiddenSet *sb = HiddenSet_add(t, NULL, b);
+    HiddenSet *sba = HiddenSet_add(t, sb, a);
+    (void)sab;
+    (void)sba;
+
+    assert(HiddenSet_len(sa) == 1);
+    assert(HiddenSet_contains(sa, a));
+    assert(!HiddenSet_contains(sa, b));
+
+    // Equal sets are the same pointer whatever the insertion order
+    assert(HiddenSet_len(sab) == 2);
+    assert(sab == sba);
+    assert(HiddenSet_add(t, NULL, a) == sa);
+    assert(HiddenSet_add(t, sab, a) == sab);
+
+    assert(HiddenSet_contains(sab, a));
+    assert(HiddenSet_contains(sab, b));
+    assert(!HiddenSet_contains(sab, c));
+
+    // Extending a set leaves it unchanged
+    HiddenSet *sabc = HiddenSet_add(t, sab, c);
+    (void)sabc;
+
+    assert(HiddenSet_len(sabc) == 3);
+    assert(HiddenSet_contains(sabc, c));
+    assert(!HiddenSet_contains(sab, c));
+    assert(HiddenSet_add(t, HiddenSet_add(t, sb, c), a) == sabc);
+
+    // Many names
+    HiddenSet *s = NULL;
+    char buffer[32];
+
+    for (int i = 0; i < 200; i = i + 1) {
+        snprintf(buffer, sizeof(buffer), "M%d", i);
+        s = HiddenSet_add(t, s, Intern_string(buffer));
+    }
+
+    assert(HiddenSet_len(s) == 200);
+
+    for (int i = 0; i < 200; i = i + 1) {
+        snprintf(buffer, sizeof(buffer), "M%d", i);
+        assert(HiddenSet_contains(s, Intern_string(buffer)));
+    }
+
+    assert(!HiddenSet_contains(s, a));
+
+    // Many sets of one name are each found again
+    for (int i = 0; i < 200; i = i + 1) {
+        snprintf(buffer, sizeof(buffer), "M%d", i);
+        const char *name = Intern_string(buffer);
+        HiddenSet *single = HiddenSet_add(t, NULL, name);
+        (void)single;
+
+        assert(HiddenSet_len(single) == 1);
+        assert(HiddenSet_add(t, NULL, name) == single);
+        assert(HiddenSet_add(t, single, name) == single);
+    }
+
+    assert(HiddenSet_add(t, NULL, a) == sa);
+    assert(HiddenSet_add(t, sb, a) == sab);
+}
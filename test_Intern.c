@@ -0,0 +1,40 @@
+#include "mocc.h"
+
+void test_Intern(void) {
+    const char *a = Intern_string("hello");
+    const char *b = Intern_substring("hello, world", 5);
+    const char *c = Intern_string("world");
+    const char *e = Intern_string("");
+    (void)a;
+    (void)b;
+    (void)c;
+    (void)e;
+
+    assert(a == b);
+    assert(a != c);
+    assert(strcmp(a, "hello") == 0);
+    assert(strcmp(c, "world") == 0);
+    assert(strcmp(e, "") == 0);
+
+    assert(Intern_length(a) == 5);
+    assert(Intern_length(e) == 0);
+    assert(Intern_hash(a) == Intern_hash(b));
+
+    // Survive growing the table
+    char buffer[32];
+    const char *interned[5000];
+
+    for (int i = 0; i < 5000; i = i + 1) {
+        snprintf(buffer, sizeof(buffer), "name%d", i);
+        interned[i] = Intern_string(buffer);
+    }
+
+    for (int i = 0; i < 5000; i = i + 1) {
+        snprintf(buffer, sizeof(buffer), "name%d", i);
+        assert(Intern_string(buffer) == interned[i]);
+        assert(strcmp(interned[i], buffer) == 0);
+    }
+
+    assert(Intern_string("hello") == a);
+    (void)interned;
+}
@@ -50,9 +50,47 @@ static void check_lexer(
                 expected_tokens[i].is_bol,
                 t->is_bol);
         }
+        if (t->hidden_set != NULL) {
+            ERROR("%s[%d]: t->hidden_set != NULL\n", test_name, i);
+        }
     } while (expected_tokens[i++].kind != '\0');
 }
 
+static void check_literal(
+    const char *test_name,
+    const char *text,
+    TokenKind kind,
+    const char *expected_string,
+    int expected_len,
+    bool is_view) {
+    assert(test_name);
+    assert(text);
+    assert(expected_string);
+
+    Lexer *l = Lexer_new(test_name, text);
+    Token *t = Lexer_read(l);
+
+    if (t->kind != kind) {
+        ERROR("%s: t->kind != %d, actual %d\n", test_name, kind, t->kind);
+    }
+    if (t->source != text || t->offset != 0 || t->length != strlen(text)) {
+        ERROR("%s: t does not span the whole source\n", test_name);
+    }
+    if (t->string_len != expected_len ||
+        memcmp(t->string, expected_string, expected_len) != 0) {
+        ERROR("%s: t->string != %s\n", test_name, expected_string);
+    }
+    if ((t->string == &text[1]) != is_view) {
+        ERROR(
+            "%s: t->string must %sbe a view\n",
+            test_name,
+            is_view ? "" : "not ");
+    }
+    if (Lexer_read(l)->kind != '\0') {
+        ERROR("%s: tokens must be ended with EOF\n", test_name);
+    }
+}
+
 void test_Lexer(void) {
     check_lexer(
         "empty",
@@ -94,4 +132,60 @@ void test_Lexer(void) {
             {.kind = '-', "-", false},
             {.kind = '\0', "", true},
         });
+
+    check_lexer(
+        "punctuators",
+        "->- <=< >=> ==!=! &&&||| ....... ..\t.\n;",
+        (TestToken[]){
+            {.kind = TokenKind_arrow, "->", true},
+            {.kind = '-', "-", false},
+            {.kind = TokenKind_lesser_equal, "<=", false},
+            {.kind = '<', "<", false},
+            {.kind = TokenKind_greater_equal, ">=", false},
+            {.kind = '>', ">", false},
+            {.kind = TokenKind_equal, "==", false},
+            {.kind = TokenKind_not_equal, "!=", false},
+            {.kind = '!', "!", false},
+            {.kind = TokenKind_and_and, "&&", false},
+            {.kind = '&', "&", false},
+            {.kind = TokenKind_or_or, "||", false},
+            {.kind = '|', "|", false},
+            {.kind = TokenKind_var_arg, "...", false},
+            {.kind = TokenKind_var_arg, "...", false},
+            {.kind = '.', ".", false},
+            {.kind = TokenKind_dot_dot, "..", false},
+            {.kind = '.', ".", false},
+            {.kind = ';', ";", true},
+            {.kind = '\0', "", true},
+        });
+
+    check_literal("character", "'a'", TokenKind_character, "a", 1, true);
+    check_literal(
+        "character-escape", "'\\n'", TokenKind_character, "\n", 1, false);
+    check_literal("string", "\"abc\"", TokenKind_string, "abc", 3, true);
+    check_literal("string-empty", "\"\"", TokenKind_string, "", 0, true);
+    check_literal(
+        "string-escape",
+        "\"a\\0b\\\"\"",
+        TokenKind_string,
+        "a\0b\"",
+        4,
+        false);
+
+    // Literals are not limited by any fixed buffer
+    size_t long_len = 5000;
+    char *long_text = malloc(long_len + 3);
+    long_text[0] = '\"';
+    memset(&long_text[1], 'x', long_len);
+    long_text[long_len + 1] = '\"';
+    long_text[long_len + 2] = '\0';
+
+    check_literal(
+        "string-long",
+        long_text,
+        TokenKind_string,
+        &long_text[1],
+        (int)long_len,
+        true);
+    free(long_text);
 }
@@ -27,4 +27,26 @@ void test_Path(void) {
     assert(strcmp(Path_dir("/"), "/") == 0);
     assert(strcmp(Path_dir("/a/b"), "/a/") == 0);
     assert(strcmp(Path_dir("/a/b/"), "/a/b/") == 0);
+
+    assert(strcmp(Path_base(""), "") == 0);
+    assert(strcmp(Path_base("test.c"), "test.c") == 0);
+    assert(strcmp(Path_base("./test.c"), "test.c") == 0);
+    assert(strcmp(Path_base("a/b/c"), "c") == 0);
+    assert(strcmp(Path_base("a/b/"), "") == 0);
+    assert(strcmp(Path_base("/a"), "a") == 0);
+
+    assert(strcmp(Path_normalize(""), ".") == 0);
+    assert(strcmp(Path_normalize("."), ".") == 0);
+    assert(strcmp(Path_normalize("./test.c"), "test.c") == 0);
+    assert(strcmp(Path_normalize("a//b/./c"), "a/b/c") == 0);
+    assert(strcmp(Path_normalize("a/b/"), "a/b") == 0);
+    assert(strcmp(Path_normalize("a/../b"), "b") == 0);
+    assert(strcmp(Path_normalize("a/.."), ".") == 0);
+    assert(strcmp(Path_normalize("../a"), "../a") == 0);
+    assert(strcmp(Path_normalize("a/../../b"), "../b") == 0);
+    assert(strcmp(Path_normalize("../../a/.."), "../..") == 0);
+    assert(strcmp(Path_normalize("/"), "/") == 0);
+    assert(strcmp(Path_normalize("/.."), "/") == 0);
+    assert(strcmp(Path_normalize("/a/../../b"), "/b") == 0);
+    assert(strcmp(Path_normalize("/a/./b/../c"), "/a/c") == 0);
 }
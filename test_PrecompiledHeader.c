@@ -0,0 +1,81 @@
+#include "mocc.h"
+
+void test_PrecompiledHeader(void) {
+    const char *pch_path = "tmp/test_PrecompiledHeader.pch";
+
+    PrecompiledHeader_emit(Vec_new(String)(), "test/pch.h", pch_path);
+    PrecompiledHeader *pch = PrecompiledHeader_load(pch_path);
+    remove(pch_path);
+
+    Preprocessor *pp = Preprocessor_new(Vec_new(String)());
+    PrecompiledHeader_define_macros(pch, pp);
+
+    const Map(Macro) *macros = Preprocessor_macros(pp);
+    const Macro *zero = Map_find(Macro)(macros, Intern_string("PCH_ZERO"));
+    (void)macros;
+    (void)zero;
+
+    assert(Map_find(Macro)(macros, Intern_string("INCLUDE_pch_h")));
+    assert(zero != NULL);
+    assert(Macro_is_function(zero));
+    assert(Vec_len(String)(zero->parameters) == 0);
+    assert(Vec_len(Token)(zero->contents) == 3);
+
+    // The header is skipped by its include guard, and everything it declares
+    // is available to the translation unit
+    Vec(Token) *tokens = Preprocessor_run(
+        pp,
+        "test/main.c",
+        "#include \"pch.h\"\n"
+        "int pch_sum(PchNode *node, ...) {\n"
+        "    int sum = 0;\n"
+        "    while (node) {\n"
+        "        sum = sum + node->value + PCH_ZERO();\n"
+        "        node = node->next;\n"
+        "    }\n"
+        "    return sum;\n"
+        "}\n"
+        "int main(void) {\n"
+        "    PchNode node;\n"
+        "    PchColor color = PchColor_green;\n"
+        "    struct PchNode *p = &node;\n"
+        "    p->next = PCH_NULL;\n"
+        "    p->value = PCH_ANSWER + color;\n"
+        "    puts(PCH_GREETING);\n"
+        "    return sizeof(node.name) + pch_sum(p, 0);\n"
+        "}\n");
+
+    Parser *p = Parser_new(tokens);
+    PrecompiledHeader_declare_symbols(pch, Parser_sema(p));
+
+    TranslationUnitNode *node = Parser_parse(p);
+    (void)node;
+
+    assert(Vec_len(DeclNode)(node->declarations) == 2);
+
+    Scope *scope = Sema_global_variable_scope(Parser_sema(p));
+    Symbol *green = Scope_find(scope, Intern_string("PchColor_green"), false);
+    Symbol *sum = Scope_find(scope, Intern_string("pch_sum"), false);
+    (void)green;
+    (void)sum;
+
+    assert(green->storage_class == StorageClass_enum);
+    assert(green->enum_value == 5);
+    assert(sum->has_body);
+    assert(FunctionType_is_var_arg(sum->type));
+
+    Symbol *node_symbol = Scope_find(
+        Sema_global_struct_scope(Parser_sema(p)),
+        Intern_string("PchNode"),
+        false);
+    (void)node_symbol;
+
+    assert(Type_sizeof(node_symbol->type) == 28);
+
+    // The pointer member refers back to the same struct type
+    Symbol *next = StructType_find_member(
+        node_symbol->type, Intern_string("next"));
+    (void)next;
+
+    assert(PointerType_pointee_type(next->type) == node_symbol->type);
+}
@@ -51,6 +51,43 @@ static void check_pp(
     }
 }
 
+// Pulls tokens one at a time, stopping before the rest of the text
+static void check_pp_next(
+    const char *test_name,
+    const char *text,
+    const TestToken expected_tokens[],
+    size_t num_tokens) {
+    assert(test_name);
+    assert(text);
+    assert(expected_tokens);
+
+    Vec(String) *include_paths = Vec_new(String)();
+    Vec_push(String)(include_paths, "test");
+
+    Preprocessor *pp = Preprocessor_new(include_paths);
+    Preprocessor_begin(pp, test_name, text);
+
+    for (size_t i = 0; i < num_tokens; i++) {
+        const Token *t = Preprocessor_next(pp);
+        if (t->kind != expected_tokens[i].kind) {
+            ERROR(
+                "%s: tokens[%zu]->kind != %d, actual %d\n",
+                test_name,
+                i,
+                expected_tokens[i].kind,
+                t->kind);
+        }
+        if (strcmp(t->text, expected_tokens[i].text) != 0) {
+            ERROR(
+                "%s: tokens[%zu]->text != %s, actual %s\n",
+                test_name,
+                i,
+                expected_tokens[i].text,
+                t->text);
+        }
+    }
+}
+
 void test_Preprocessor(void) {
     check_pp(
         "empty",
@@ -84,6 +121,40 @@ void test_Preprocessor(void) {
             {.kind = '\0', ""},
         });
 
+    check_pp(
+        "keywords",
+        "static typedef const void char int struct enum sizeof if else while "
+        "do for break continue goto switch case default return "
+        "Return cases do_ in",
+        (TestToken[]){
+            {.kind = TokenKind_kw_static, "static"},
+            {.kind = TokenKind_kw_typedef, "typedef"},
+            {.kind = TokenKind_kw_const, "const"},
+            {.kind = TokenKind_kw_void, "void"},
+            {.kind = TokenKind_kw_char, "char"},
+            {.kind = TokenKind_kw_int, "int"},
+            {.kind = TokenKind_kw_struct, "struct"},
+            {.kind = TokenKind_kw_enum, "enum"},
+            {.kind = TokenKind_kw_sizeof, "sizeof"},
+            {.kind = TokenKind_kw_if, "if"},
+            {.kind = TokenKind_kw_else, "else"},
+            {.kind = TokenKind_kw_while, "while"},
+            {.kind = TokenKind_kw_do, "do"},
+            {.kind = TokenKind_kw_for, "for"},
+            {.kind = TokenKind_kw_break, "break"},
+            {.kind = TokenKind_kw_continue, "continue"},
+            {.kind = TokenKind_kw_goto, "goto"},
+            {.kind = TokenKind_kw_switch, "switch"},
+            {.kind = TokenKind_kw_case, "case"},
+            {.kind = TokenKind_kw_default, "default"},
+            {.kind = TokenKind_kw_return, "return"},
+            {.kind = TokenKind_identifier, "Return"},
+            {.kind = TokenKind_identifier, "cases"},
+            {.kind = TokenKind_identifier, "do_"},
+            {.kind = TokenKind_identifier, "in"},
+            {.kind = '\0', ""},
+        });
+
     check_pp(
         "operators",
         "+ -",
@@ -143,6 +214,26 @@ void test_Preprocessor(void) {
             {.kind = '\0', ""},
         });
 
+    check_pp(
+        "undef-directive",
+        "#define A a\n"
+        "#define B b\n"
+        "A B\n"
+        "#undef A\n"
+        "#undef C\n"
+        "A B\n"
+        "#define A c\n"
+        "A B",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "a"},
+            {.kind = TokenKind_identifier, "b"},
+            {.kind = TokenKind_identifier, "A"},
+            {.kind = TokenKind_identifier, "b"},
+            {.kind = TokenKind_identifier, "c"},
+            {.kind = TokenKind_identifier, "b"},
+            {.kind = '\0', ""},
+        });
+
     check_pp(
         "function-macro",
         "#define F() f(x)\n"
@@ -172,4 +263,175 @@ void test_Preprocessor(void) {
             {.kind = TokenKind_identifier, "test_h"},
             {.kind = '\0', ""},
         });
+
+    check_pp(
+        "if-directive",
+        "#define ONE 1\n"
+        "#define TWO ONE + ONE\n"
+        "#if TWO * 2 == 3 && !UNDEFINED\n"
+        "a\n"
+        "#elif 1\n"
+        "b\n"
+        "#else\n"
+        "c\n"
+        "#endif\n"
+        "#if 0\n"
+        "d\n"
+        "#elif (3 - 1) % 2 || 'x' == 120 ? 0 : 1\n"
+        "e\n"
+        "#elif defined ONE && defined(TWO)\n"
+        "f\n"
+        "#else\n"
+        "g\n"
+        "#endif\n"
+        "#if 1 > 2\n"
+        "h\n"
+        "#else\n"
+        "i\n"
+        "#endif",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "a"},
+            {.kind = TokenKind_identifier, "f"},
+            {.kind = TokenKind_identifier, "i"},
+            {.kind = '\0', ""},
+        });
+
+    check_pp(
+        "ifdef-directive",
+        "#define A\n"
+        "#ifdef A\n"
+        "a\n"
+        "#endif\n"
+        "#ifdef B\n"
+        "b\n"
+        "#endif\n"
+        "#ifndef B\n"
+        "#ifndef A\n"
+        "c\n"
+        "#else\n"
+        "d\n"
+        "#endif\n"
+        "#endif",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "a"},
+            {.kind = TokenKind_identifier, "d"},
+            {.kind = '\0', ""},
+        });
+
+    check_pp(
+        "skip-groups",
+        "#if 0\n"
+        "#unknown directive\n"
+        "#if 1\n"
+        "a\n"
+        "#else\n"
+        "b\n"
+        "#endif\n"
+        "#include \"NO_SUCH_FILE\"\n"
+        "#else\n"
+        "c\n"
+        "#endif\n"
+        "#if 1\n"
+        "d\n"
+        "#elif 1 / 0\n"
+        "#unknown directive\n"
+        "#else\n"
+        "e\n"
+        "#endif",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "c"},
+            {.kind = TokenKind_identifier, "d"},
+            {.kind = '\0', ""},
+        });
+
+    // Division by zero is only an error in an evaluated operand
+    check_pp(
+        "if-unevaluated",
+        "#if defined(N) && 10 / N > 1\n"
+        "a\n"
+        "#endif\n"
+        "#if 0 && 1 / 0\n"
+        "b\n"
+        "#endif\n"
+        "#if 1 || 1 % 0\n"
+        "c\n"
+        "#endif\n"
+        "#if 1 ? 2 : 1 / 0\n"
+        "d\n"
+        "#endif\n"
+        "#if 0 ? 1 / 0 : 0 || (1 && 3)\n"
+        "e\n"
+        "#endif",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "c"},
+            {.kind = TokenKind_identifier, "d"},
+            {.kind = TokenKind_identifier, "e"},
+            {.kind = '\0', ""},
+        });
+
+    check_pp(
+        "include-guard",
+        "#include \"guarded.h\"\n"
+        "#include \"guarded.h\"\n"
+        "#include \"once.h\"\n"
+        "#include \"once.h\"\n"
+        "GUARDED ONCE",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "guarded"},
+            {.kind = TokenKind_identifier, "once"},
+            {.kind = '\0', ""},
+        });
+
+    // Every spelling of a path names the same file
+    check_pp(
+        "include-once-spelling",
+        "#include \"once_token.h\"\n"
+        "#include \"../test/./once_token.h\"\n"
+        "#include \"test/../once_token.h\"",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "once_token"},
+            {.kind = '\0', ""},
+        });
+
+    // The #else group is not an include guard
+    check_pp(
+        "include-guard-else",
+        "#define GUARDED_ELSE\n"
+        "#include \"guarded_else.h\"\n"
+        "#include \"guarded_else.h\"",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "guarded_else_b"},
+            {.kind = TokenKind_identifier, "guarded_else_b"},
+            {.kind = '\0', ""},
+        });
+
+    // The missing file would be an error if it were reached
+    check_pp_next(
+        "next-lazy",
+        "#include \"test.h\"\n"
+        "a DEFINED_IN_test_h\n"
+        "#include \"NO_SUCH_FILE\"\n",
+        (TestToken[]){
+            {.kind = TokenKind_kw_int, "int"},
+            {.kind = TokenKind_identifier, "hello"},
+            {.kind = '(', "("},
+            {.kind = TokenKind_kw_void, "void"},
+            {.kind = ')', ")"},
+            {.kind = ';', ";"},
+            {.kind = TokenKind_identifier, "a"},
+            {.kind = TokenKind_identifier, "defined"},
+            {.kind = TokenKind_identifier, "in"},
+            {.kind = TokenKind_identifier, "test_h"},
+        },
+        10);
+
+    check_pp_next(
+        "next-eof",
+        "x",
+        (TestToken[]){
+            {.kind = TokenKind_identifier, "x"},
+            {.kind = '\0', ""},
+            {.kind = '\0', ""},
+        },
+        3);
 }
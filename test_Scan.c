@@ -0,0 +1,96 @@
+#include "mocc.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Checks every implementation against the scalar one
+static void check_scan(const char *s) {
+    ScanLevel max_level = Scan_max_level();
+
+    Scan_set_level(ScanLevel_scalar);
+    size_t spaces = Scan_spaces(s);
+    size_t digits = Scan_digits(s);
+    size_t identifier = Scan_identifier(s);
+    size_t string = Scan_literal(s, '\"');
+    size_t character = Scan_literal(s, '\'');
+
+    for (int level = ScanLevel_sse2; level <= (int)max_level; level++) {
+        Scan_set_level((ScanLevel)level);
+
+        if (Scan_spaces(s) != spaces || Scan_digits(s) != digits ||
+            Scan_identifier(s) != identifier ||
+            Scan_literal(s, '\"') != string ||
+            Scan_literal(s, '\'') != character) {
+            ERROR("test_Scan: level %d differs for \"%s\"\n", level, s);
+        }
+    }
+
+    Scan_set_level(max_level);
+}
+
+void test_Scan(void) {
+    Scan_set_level(ScanLevel_scalar);
+    assert(Scan_level() == ScanLevel_scalar);
+
+    assert(Scan_spaces(" \t\r\v\fx") == 5);
+    assert(Scan_spaces("  \n ") == 2);
+    assert(Scan_digits("0123456789a") == 10);
+    assert(Scan_identifier("foo_Bar9+") == 8);
+    assert(Scan_identifier("\xe3\x81\x82") == 0);
+    assert(Scan_literal("abc\\\"", '\"') == 3);
+    assert(Scan_literal("ab\"c'", '\'') == 4);
+    assert(Scan_literal("ab\ncd", '\"') == 2);
+    assert(Scan_literal("", '\"') == 0);
+
+    Scan_set_level(Scan_max_level());
+    assert(Scan_level() == Scan_max_level());
+
+    // Runs of every length at every alignment
+    const char *patterns[] = {
+        "        ",
+        "0123456789",
+        "identifier_0123_ABCZ",
+        "string literal contents",
+    };
+    char buffer[256];
+
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+        for (size_t offset = 0; offset < 64; offset++) {
+            for (size_t len = 0; len < 100; len++) {
+                for (size_t j = 0; j < len; j++) {
+                    buffer[offset + j] =
+                        patterns[i][j % strlen(patterns[i])];
+                }
+
+                buffer[offset + len] = '\0';
+                check_scan(&buffer[offset]);
+
+                buffer[offset + len] = '\"';
+                buffer[offset + len + 1] = '\0';
+                check_scan(&buffer[offset]);
+            }
+        }
+    }
+
+    // The NUL at the very end of a page is found without touching the next
+    // page
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    char *pages = mmap(
+        NULL,
+        page_size * 2,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+    assert(pages != MAP_FAILED);
+    mprotect(&pages[page_size], page_size, PROT_NONE);
+
+    memset(pages, 'a', page_size);
+    pages[page_size - 1] = '\0';
+
+    for (size_t len = 0; len < 100; len++) {
+        check_scan(&pages[page_size - 1 - len]);
+    }
+
+    munmap(pages, page_size * 2);
+}
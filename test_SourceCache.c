@@ -0,0 +1,35 @@
+#include "mocc.h"
+
+void test_SourceCache(void) {
+    const SourceFile *a = SourceCache_load("test/test.h");
+    const SourceFile *b = SourceCache_load("test/test.h");
+    (void)a;
+    (void)b;
+
+    assert(a != NULL);
+    assert(a == b);
+    assert(a->path == Intern_string("test/test.h"));
+    assert(strncmp(a->text, "#define DEFINED_IN_test_h", 25) == 0);
+
+    // The raw tokens end with EOF
+    size_t len = Vec_len(Token)(a->tokens);
+    (void)len;
+
+    assert(len > 0);
+    assert(Vec_get(Token)(a->tokens, 0)->kind == '#');
+    assert(Vec_get(Token)(a->tokens, len - 1)->kind == '\0');
+
+    // Include guards
+    const SourceFile *guarded = SourceCache_load("test/guarded.h");
+    const SourceFile *guarded_else = SourceCache_load("test/guarded_else.h");
+    (void)guarded;
+    (void)guarded_else;
+
+    assert(a->guard_macro == NULL);
+    assert(guarded->guard_macro == Intern_string("INCLUDE_guarded_h"));
+    assert(guarded_else->guard_macro == NULL);
+
+    // Failed probes are cached too
+    assert(SourceCache_load("test/NO_SUCH_FILE") == NULL);
+    assert(SourceCache_load("test/NO_SUCH_FILE") == NULL);
+}
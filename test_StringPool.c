@@ -0,0 +1,66 @@
+#include "mocc.h"
+
+static void check_root(
+    const char *test_name,
+    const StringPool *pool,
+    size_t entry,
+    size_t expected_root,
+    size_t expected_offset) {
+    size_t offset;
+    size_t root = StringPool_root(pool, entry, &offset);
+
+    if (root != expected_root || offset != expected_offset) {
+        fprintf(
+            stderr,
+            "%s: expected entry %zu at %zu, but got entry %zu at %zu\n",
+            test_name,
+            expected_root,
+            expected_offset,
+            root,
+            offset);
+        exit(1);
+    }
+}
+
+void test_StringPool(void) {
+    StringPool *pool = StringPool_new();
+
+    size_t lo = StringPool_add(pool, "lo", 2);
+    size_t hello = StringPool_add(pool, "hello", 5);
+    size_t empty = StringPool_add(pool, "", 0);
+    size_t llo = StringPool_add(pool, "llo", 3);
+    size_t nul = StringPool_add(pool, "a\0lo", 4);
+    size_t world = StringPool_add(pool, "world", 5);
+    size_t hello_world = StringPool_add(pool, "hello world", 11);
+
+    assert(StringPool_add(pool, "hello", 5) == hello);
+    assert(StringPool_add(pool, "a\0lo", 4) == nul);
+    assert(StringPool_add(pool, "a\0lp", 4) != nul);
+    assert(StringPool_len(pool) == 8);
+    assert(StringPool_length(pool, hello_world) == 11);
+    assert(strcmp(StringPool_string(pool, world), "world") == 0);
+    assert(StringPool_has_nul(pool, nul));
+    assert(!StringPool_has_nul(pool, empty));
+
+    // Many entries make the table grow
+    char buffer[16];
+    for (int i = 0; i < 1000; i++) {
+        sprintf(buffer, "s%d", i);
+        StringPool_add(pool, Intern_string(buffer), strlen(buffer));
+    }
+
+    assert(StringPool_add(pool, "s999", 4) == StringPool_len(pool) - 1);
+    assert(StringPool_add(pool, "lo", 2) == lo);
+
+    StringPool_merge_suffixes(pool);
+
+    check_root("suffix", pool, lo, hello, 3);
+    check_root("suffix-of-suffix", pool, llo, hello, 2);
+    check_root("empty", pool, empty, hello, 5);
+    check_root("root", pool, hello, hello, 0);
+    check_root("nul", pool, nul, nul, 0);
+    check_root("later", pool, world, hello_world, 6);
+    check_root("not-suffix", pool, hello_world, hello_world, 0);
+
+    StringPool_delete(pool);
+}
@@ -0,0 +1,60 @@
+#include "mocc.h"
+
+void test_TokenStream(void) {
+    Vec(Token) *tokens = Preprocessor_read(
+        Vec_new(String)(),
+        "token_stream",
+        "#define GREETING \"hello\\n\"\n"
+        "int main(void) {\n"
+        "    puts(GREETING);\n"
+        "    return 'a' + 0;\n"
+        "}\n");
+
+    BinaryWriter *w = BinaryWriter_new();
+    TokenStream_write(w, tokens);
+
+    const char *path = "tmp/test_TokenStream.bin";
+    bool saved = BinaryWriter_save(w, path);
+    (void)saved;
+    assert(saved);
+
+    size_t size;
+    const char *data = File_read_with_size(path, &size);
+    remove(path);
+
+    assert(TokenStream_is_binary(data, size));
+    assert(!TokenStream_is_binary("int main(void);", 15));
+
+    Vec(Token) *actual = TokenStream_read(data, size);
+    size_t len = Vec_len(Token)(tokens);
+    (void)actual;
+    (void)len;
+
+    assert(Vec_len(Token)(actual) == len);
+
+    for (size_t i = 0; i < len; i++) {
+        const Token *expected_token = Vec_get(Token)(tokens, i);
+        const Token *actual_token = Vec_get(Token)(actual, i);
+        (void)expected_token;
+        (void)actual_token;
+
+        assert(actual_token->kind == expected_token->kind);
+        assert(actual_token->text == expected_token->text);
+        assert(actual_token->is_bol == expected_token->is_bol);
+        assert(actual_token->has_spaces == expected_token->has_spaces);
+        assert(actual_token->string_len == expected_token->string_len);
+        assert(
+            actual_token->string == NULL ||
+            memcmp(
+                actual_token->string,
+                expected_token->string,
+                expected_token->string_len) == 0);
+        assert(actual_token->hidden_set == NULL);
+    }
+
+    // Keywords and decoded literals survive
+    assert(Vec_get(Token)(actual, 0)->kind == TokenKind_kw_int);
+    assert(Vec_get(Token)(actual, 8)->kind == TokenKind_string);
+    assert(Vec_get(Token)(actual, 8)->string_len == 6);
+    assert(Vec_get(Token)(actual, len - 1)->kind == '\0');
+}